@@ -29,7 +29,8 @@ public class EasyUserInterfaceManagement : ModuleRules
 				"CommonUI",
 				"CommonInput",
 				"UMG",
-				"GameplayTags"
+				"GameplayTags",
+				"DeveloperSettings"
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -42,6 +43,8 @@ public class EasyUserInterfaceManagement : ModuleRules
 				"Engine",
 				"Slate",
 				"SlateCore",
+				"Json",
+				"AssetRegistry",
 				// ... add private dependencies that you statically link with here ...	
 			}
 			);
@@ -2,6 +2,9 @@
 
 #include "EasyUserInterfaceManagement.h"
 
+#include "Engine/World.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
+
 #define LOCTEXT_NAMESPACE "FEasyUserInterfaceManagementModule"
 
 // Initialize Log Category for Easy User Interface Management
@@ -10,12 +13,14 @@ DEFINE_LOG_CATEGORY(LogEasyUserInterfaceManagement);
 void FEasyUserInterfaceManagementModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+	StartGameInstanceHandle = FWorldDelegates::OnStartGameInstance.AddStatic(&UEasyUserInterfaceManager::HandleStartGameInstance);
 }
 
 void FEasyUserInterfaceManagementModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FWorldDelegates::OnStartGameInstance.Remove(StartGameInstanceHandle);
 }
 
 #undef LOCTEXT_NAMESPACE
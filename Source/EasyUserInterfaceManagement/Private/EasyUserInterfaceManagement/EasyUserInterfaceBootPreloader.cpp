@@ -0,0 +1,160 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagement/EasyUserInterfaceBootPreloader.h"
+
+#include "EasyUserInterfaceManagement.h"
+#include "Dom/JsonObject.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceJson.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSettings.h"
+#include "Engine/AssetManager.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/StreamableManager.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+void FEasyUserInterfaceBootPreloader::Initialize(UEasyUserInterfaceManager& InManager)
+{
+	const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+	// Split screen players share the boot, the first one records it
+	const ULocalPlayer* LocalPlayer = InManager.GetLocalPlayer();
+	if (!Settings->bUseBootPreloadList || !LocalPlayer || LocalPlayer->GetLocalPlayerIndex() != 0)
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> PreloadAssets;
+	if (LoadList(PreloadAssets) && PreloadAssets.Num() > 0)
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Log, TEXT("Preloading %d User Interface asset(s) requested at boot by the previous session."), PreloadAssets.Num());
+		NumPreloadedAssets = PreloadAssets.Num();
+		PreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(PreloadAssets), FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+	}
+
+	bIsRecording = true;
+	RecordedAssets.Reset();
+	RecordingTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FEasyUserInterfaceBootPreloader::TickRecording), Settings->BootPreloadRecordSeconds);
+}
+
+void FEasyUserInterfaceBootPreloader::Deinitialize()
+{
+	// Sessions shorter than the recorded duration still save what they requested
+	if (bIsRecording)
+	{
+		StopRecording();
+	}
+
+	if (PreloadHandle.IsValid())
+	{
+		PreloadHandle->CancelHandle();
+		PreloadHandle.Reset();
+	}
+}
+
+void FEasyUserInterfaceBootPreloader::RecordAsset(const FSoftObjectPath& AssetPath)
+{
+	if (!bIsRecording || !AssetPath.IsValid() || FPackageName::IsScriptPackage(AssetPath.GetLongPackageName()))
+	{
+		return;
+	}
+
+	if (RecordedAssets.Num() < UEasyUserInterfaceSettings::Get()->BootPreloadMaxAssets)
+	{
+		RecordedAssets.AddUnique(AssetPath);
+	}
+}
+
+bool FEasyUserInterfaceBootPreloader::SaveList() const
+{
+	TArray<TSharedPtr<FJsonValue>> AssetValues;
+	for (const FSoftObjectPath& AssetPath : RecordedAssets)
+	{
+		AssetValues.Add(MakeShared<FJsonValueString>(AssetPath.ToString()));
+	}
+
+	TSharedRef<FJsonObject> List = MakeShared<FJsonObject>();
+	List->SetStringField(TEXT("Build"), GetBuildId());
+	List->SetArrayField(TEXT("Assets"), AssetValues);
+	return FEasyUserInterfaceJson::WriteToFile(List, GetListPath());
+}
+
+bool FEasyUserInterfaceBootPreloader::LoadList(TArray<FSoftObjectPath>& OutAssets)
+{
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *GetListPath()))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> List;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), List) || !List.IsValid())
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Warning, TEXT("Failed to parse the boot preload list %s, nothing is preloaded."), *GetListPath());
+		return false;
+	}
+
+	// The assets of another build may have been moved or removed
+	if (List->GetStringField(TEXT("Build")) != GetBuildId())
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Log, TEXT("The boot preload list was recorded by another build, nothing is preloaded."));
+		return false;
+	}
+
+	for (const TSharedPtr<FJsonValue>& AssetValue : List->GetArrayField(TEXT("Assets")))
+	{
+		const FSoftObjectPath AssetPath(AssetValue->AsString());
+		if (AssetPath.IsValid())
+		{
+			OutAssets.AddUnique(AssetPath);
+		}
+	}
+	return true;
+}
+
+FString FEasyUserInterfaceBootPreloader::GetListPath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyUI"), TEXT("BootPreload.json"));
+}
+
+FString FEasyUserInterfaceBootPreloader::GetBuildId()
+{
+	return FString::Printf(TEXT("%s %s"), FApp::GetBuildVersion(), *FApp::GetBuildDate());
+}
+
+bool FEasyUserInterfaceBootPreloader::TickRecording(float DeltaTime)
+{
+	RecordingTickerHandle.Reset();
+	StopRecording();
+
+	// The widgets displayed by now hold the assets they use, the others are not needed at boot
+	if (PreloadHandle.IsValid())
+	{
+		PreloadHandle->ReleaseHandle();
+		PreloadHandle.Reset();
+	}
+	return false;
+}
+
+void FEasyUserInterfaceBootPreloader::StopRecording()
+{
+	bIsRecording = false;
+	if (RecordingTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(RecordingTickerHandle);
+		RecordingTickerHandle.Reset();
+	}
+
+	// A session that requested nothing keeps the previous list
+	if (RecordedAssets.Num() > 0)
+	{
+		if (SaveList())
+		{
+			UE_LOG(LogEasyUserInterfaceManagement, Log, TEXT("Saved %d User Interface asset(s) requested at boot to %s."), RecordedAssets.Num(), *GetListPath());
+		}
+	}
+}
@@ -0,0 +1,226 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagement/EasyUserInterfaceCostStats.h"
+
+#include "EasyUserInterfaceManagement.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+CSV_DEFINE_CATEGORY(EasyUICost, true);
+
+bool FEasyUserInterfaceCostStats::bIsEnabled = false;
+FSimpleMulticastDelegate FEasyUserInterfaceCostStats::EnabledChangedEvent;
+
+namespace EasyUserInterfaceCostStats
+{
+	constexpr int32 NumPhases = static_cast<int32>(EEasyUserInterfaceCostPhase::Num);
+
+	struct FClassCost
+	{
+		FName LayerTag;
+		double TotalSeconds[NumPhases] = {};
+		double MaxFrameSeconds[NumPhases] = {};
+		int32 NumFrames = 0;
+
+		/** Cost of the frame being measured, a class may be recorded several times per frame (several windows or notifications) */
+		uint64 CurrentFrame = 0;
+		double FrameSeconds[NumPhases] = {};
+		bool bHasFrame = false;
+#if CSV_PROFILER
+		FName CsvStatNames[NumPhases];
+#endif
+
+		void FlushFrame()
+		{
+			if (!bHasFrame)
+			{
+				return;
+			}
+
+			for (int32 PhaseIndex = 0; PhaseIndex < NumPhases; ++PhaseIndex)
+			{
+				TotalSeconds[PhaseIndex] += FrameSeconds[PhaseIndex];
+				MaxFrameSeconds[PhaseIndex] = FMath::Max(MaxFrameSeconds[PhaseIndex], FrameSeconds[PhaseIndex]);
+				FrameSeconds[PhaseIndex] = 0.0;
+			}
+			++NumFrames;
+			bHasFrame = false;
+		}
+	};
+	TMap<FName, FClassCost> ClassCosts;
+
+	EEasyUserInterfaceCostPhase ParsePhase(const FString& PhaseName)
+	{
+		for (int32 PhaseIndex = 0; PhaseIndex < NumPhases; ++PhaseIndex)
+		{
+			const EEasyUserInterfaceCostPhase Phase = static_cast<EEasyUserInterfaceCostPhase>(PhaseIndex);
+			if (PhaseName.Equals(FEasyUserInterfaceCostStats::LexToString(Phase), ESearchCase::IgnoreCase))
+			{
+				return Phase;
+			}
+		}
+		return EEasyUserInterfaceCostPhase::Num;
+	}
+
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice CostCommand(
+		TEXT("EasyUI.Cost"),
+		TEXT("Attributes the prepass, paint and tick time of the User Interface layers to the class of the widget owning them.\n")
+		TEXT("Usage: EasyUI.Cost On | Off | Reset | Print [Sort=Total|Prepass|Paint|Tick] [Count=20]"),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			const FString Action = Args.Num() > 0 ? Args[0] : TEXT("Print");
+			if (Action.Equals(TEXT("On"), ESearchCase::IgnoreCase) || Action.Equals(TEXT("Off"), ESearchCase::IgnoreCase))
+			{
+				FEasyUserInterfaceCostStats::SetEnabled(Action.Equals(TEXT("On"), ESearchCase::IgnoreCase));
+				return;
+			}
+			if (Action.Equals(TEXT("Reset"), ESearchCase::IgnoreCase))
+			{
+				FEasyUserInterfaceCostStats::Reset();
+				return;
+			}
+
+			FString SortName;
+			int32 MaxEntries = 20;
+			for (const FString& Arg : Args)
+			{
+				FParse::Value(*Arg, TEXT("Sort="), SortName);
+				FParse::Value(*Arg, TEXT("Count="), MaxEntries);
+			}
+			FEasyUserInterfaceCostStats::PrintTable(Ar, ParsePhase(SortName), MaxEntries);
+		}));
+#endif
+}
+
+double FEasyUserInterfaceCostEntry::GetTotalAvgMs() const
+{
+	double TotalMs = 0.0;
+	for (const double PhaseAvgMs : AvgMs)
+	{
+		TotalMs += PhaseAvgMs;
+	}
+	return TotalMs;
+}
+
+void FEasyUserInterfaceCostStats::SetEnabled(bool bEnabled)
+{
+	if (bIsEnabled == bEnabled)
+	{
+		return;
+	}
+
+	bIsEnabled = bEnabled;
+	UE_LOG(LogEasyUserInterfaceManagement, Display, TEXT("User Interface cost attribution %s."), bEnabled ? TEXT("enabled") : TEXT("disabled"));
+	EnabledChangedEvent.Broadcast();
+}
+
+void FEasyUserInterfaceCostStats::Record(FName OwnerClass, FName LayerTag, EEasyUserInterfaceCostPhase Phase, double Seconds)
+{
+	using namespace EasyUserInterfaceCostStats;
+
+	if (!bIsEnabled || OwnerClass.IsNone())
+	{
+		return;
+	}
+
+	const int32 PhaseIndex = static_cast<int32>(Phase);
+	FClassCost* ClassCost = ClassCosts.Find(OwnerClass);
+	if (!ClassCost)
+	{
+		ClassCost = &ClassCosts.Add(OwnerClass);
+#if CSV_PROFILER
+		for (int32 Index = 0; Index < NumPhases; ++Index)
+		{
+			ClassCost->CsvStatNames[Index] = FName(FString::Printf(TEXT("%s/%s"), *OwnerClass.ToString(), LexToString(static_cast<EEasyUserInterfaceCostPhase>(Index))));
+		}
+#endif
+	}
+
+	if (ClassCost->CurrentFrame != GFrameCounter)
+	{
+		ClassCost->FlushFrame();
+		ClassCost->CurrentFrame = GFrameCounter;
+	}
+	ClassCost->FrameSeconds[PhaseIndex] += Seconds;
+	ClassCost->bHasFrame = true;
+	if (!LayerTag.IsNone())
+	{
+		ClassCost->LayerTag = LayerTag;
+	}
+
+#if CSV_PROFILER
+	FCsvProfiler::RecordCustomStat(ClassCost->CsvStatNames[PhaseIndex], CSV_CATEGORY_INDEX(EasyUICost), static_cast<float>(Seconds * 1000.0), ECsvCustomStatOp::Accumulate);
+#endif
+}
+
+TArray<FEasyUserInterfaceCostEntry> FEasyUserInterfaceCostStats::GetEntries(EEasyUserInterfaceCostPhase SortPhase)
+{
+	using namespace EasyUserInterfaceCostStats;
+
+	TArray<FEasyUserInterfaceCostEntry> Entries;
+	Entries.Reserve(ClassCosts.Num());
+	for (TPair<FName, FClassCost>& ClassCostPair : ClassCosts)
+	{
+		FClassCost& ClassCost = ClassCostPair.Value;
+		ClassCost.FlushFrame();
+		if (ClassCost.NumFrames == 0)
+		{
+			continue;
+		}
+
+		FEasyUserInterfaceCostEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.OwnerClass = ClassCostPair.Key;
+		Entry.LayerTag = ClassCost.LayerTag;
+		Entry.NumFrames = ClassCost.NumFrames;
+		for (int32 PhaseIndex = 0; PhaseIndex < NumPhases; ++PhaseIndex)
+		{
+			Entry.AvgMs[PhaseIndex] = ClassCost.TotalSeconds[PhaseIndex] * 1000.0 / ClassCost.NumFrames;
+			Entry.MaxMs[PhaseIndex] = ClassCost.MaxFrameSeconds[PhaseIndex] * 1000.0;
+		}
+	}
+
+	const int32 SortIndex = static_cast<int32>(SortPhase);
+	Entries.Sort([SortIndex](const FEasyUserInterfaceCostEntry& A, const FEasyUserInterfaceCostEntry& B)
+	{
+		return SortIndex < NumPhases ? A.AvgMs[SortIndex] > B.AvgMs[SortIndex] : A.GetTotalAvgMs() > B.GetTotalAvgMs();
+	});
+	return Entries;
+}
+
+void FEasyUserInterfaceCostStats::PrintTable(FOutputDevice& Ar, EEasyUserInterfaceCostPhase SortPhase, int32 MaxEntries)
+{
+	const TArray<FEasyUserInterfaceCostEntry> Entries = GetEntries(SortPhase);
+	Ar.Logf(TEXT("User Interface cost per frame in ms, sorted by %s (%d class(es)%s):"),
+		SortPhase == EEasyUserInterfaceCostPhase::Num ? TEXT("Total") : LexToString(SortPhase), Entries.Num(), bIsEnabled ? TEXT("") : TEXT(", attribution disabled"));
+	Ar.Logf(TEXT("%-40s %-28s %8s %9s %9s %9s %9s %9s"), TEXT("Class"), TEXT("Layer"), TEXT("Frames"), TEXT("Prepass"), TEXT("Paint"), TEXT("Tick"), TEXT("Total"), TEXT("MaxPaint"));
+
+	for (int32 Index = 0; Index < FMath::Min(Entries.Num(), MaxEntries); ++Index)
+	{
+		const FEasyUserInterfaceCostEntry& Entry = Entries[Index];
+		Ar.Logf(TEXT("%-40s %-28s %8d %9.3f %9.3f %9.3f %9.3f %9.3f"), *Entry.OwnerClass.ToString(), *Entry.LayerTag.ToString(), Entry.NumFrames,
+			Entry.AvgMs[static_cast<int32>(EEasyUserInterfaceCostPhase::Prepass)],
+			Entry.AvgMs[static_cast<int32>(EEasyUserInterfaceCostPhase::Paint)],
+			Entry.AvgMs[static_cast<int32>(EEasyUserInterfaceCostPhase::Tick)],
+			Entry.GetTotalAvgMs(),
+			Entry.MaxMs[static_cast<int32>(EEasyUserInterfaceCostPhase::Paint)]);
+	}
+}
+
+void FEasyUserInterfaceCostStats::Reset()
+{
+	EasyUserInterfaceCostStats::ClassCosts.Empty();
+}
+
+const TCHAR* FEasyUserInterfaceCostStats::LexToString(EEasyUserInterfaceCostPhase Phase)
+{
+	switch (Phase)
+	{
+	case EEasyUserInterfaceCostPhase::Prepass: return TEXT("Prepass");
+	case EEasyUserInterfaceCostPhase::Paint: return TEXT("Paint");
+	case EEasyUserInterfaceCostPhase::Tick: return TEXT("Tick");
+	default: return TEXT("Unknown");
+	}
+}
@@ -0,0 +1,403 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagement/EasyUserInterfaceDebugger.h"
+
+#include "EasyUserInterfaceManagement.h"
+#include "CommonInputModeTypes.h"
+#include "Debug/DebugDrawService.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Canvas.h"
+#include "Engine/Engine.h"
+#include "Engine/Font.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceJson.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSyncLoadDetector.h"
+#include "ExtensionCommonUI/EasyUserInterfaceRootWidget.h"
+#include "ExtensionCommonUI/ActivatableWidget/EasyActivatableWidgetBase.h"
+#include "ExtensionCommonUI/Notification/EasyNotificationWidget.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Input/CommonUIActionRouterBase.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectHash.h"
+
+namespace EasyUserInterfaceDebugger
+{
+	/** Seconds between two rebuilds of the overlay lines */
+	float OverlayRefreshInterval = 0.25f;
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleVariableRef CVarOverlayRefreshInterval(
+		TEXT("EasyUI.Debug.RefreshInterval"),
+		OverlayRefreshInterval,
+		TEXT("Seconds between two refreshes of the EasyUI.Debug overlay."));
+#endif
+
+	struct FOverlayCache
+	{
+		TArray<FString> Lines;
+		double LastBuildTime = -1.0;
+	};
+
+	FDelegateHandle OverlayDrawHandle;
+	TMap<TWeakObjectPtr<const UEasyUserInterfaceManager>, FOverlayCache> OverlayCaches;
+
+	template <typename TEnum>
+	FString EnumToString(TEnum Value)
+	{
+		return StaticEnum<TEnum>()->GetNameStringByValue(static_cast<int64>(Value));
+	}
+
+	TSharedRef<FJsonObject> MakeInputConfigObject(const FUIInputConfig& InputConfig)
+	{
+		TSharedRef<FJsonObject> InputObject = MakeShared<FJsonObject>();
+		InputObject->SetStringField(TEXT("InputMode"), EnumToString(InputConfig.GetInputMode()));
+		InputObject->SetStringField(TEXT("MouseCaptureMode"), EnumToString(InputConfig.GetMouseCaptureMode()));
+		return InputObject;
+	}
+
+	TSharedRef<FJsonObject> MakeWidgetObject(const UUserWidget& Widget)
+	{
+		TSharedRef<FJsonObject> WidgetObject = MakeShared<FJsonObject>();
+		WidgetObject->SetStringField(TEXT("Name"), Widget.GetName());
+		WidgetObject->SetStringField(TEXT("Class"), Widget.GetClass()->GetName());
+		return WidgetObject;
+	}
+
+	TSharedRef<FJsonObject> MakePendingLoadObject(const FEasyUserInterfacePendingLoad& PendingLoad, double Now)
+	{
+		TSharedRef<FJsonObject> LoadObject = MakeShared<FJsonObject>();
+		LoadObject->SetStringField(TEXT("Layer"), PendingLoad.LayerTag.ToString());
+		LoadObject->SetStringField(TEXT("Class"), PendingLoad.ClassPath.ToString());
+		LoadObject->SetNumberField(TEXT("ElapsedSeconds"), Now - PendingLoad.RequestTime);
+		return LoadObject;
+	}
+
+	const UCommonUIActionRouterBase* FindActionRouter(const UEasyUserInterfaceManager& Manager)
+	{
+		const ULocalPlayer* LocalPlayer = Manager.GetLocalPlayer();
+		return LocalPlayer ? LocalPlayer->GetSubsystem<UCommonUIActionRouterBase>() : nullptr;
+	}
+
+	template <typename FunctorType>
+	void ForEachLocalManager(const UWorld* World, FunctorType&& Functor)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+		{
+			const ULocalPlayer* LocalPlayer = Iterator->IsValid() ? (*Iterator)->GetLocalPlayer() : nullptr;
+			if (const UEasyUserInterfaceManager* Manager = LocalPlayer ? LocalPlayer->GetSubsystem<UEasyUserInterfaceManager>() : nullptr)
+			{
+				Functor(*Manager);
+			}
+		}
+	}
+
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleCommandWithWorldAndArgs DumpCommand(
+		TEXT("EasyUI.Dump"),
+		TEXT("Writes the state of the User Interface Manager of every local player as JSON.\n")
+		TEXT("Usage: EasyUI.Dump [Output=Path.json]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			FString OutputPath = FEasyUserInterfaceDebugger::GetDefaultDumpPath();
+			for (const FString& Arg : Args)
+			{
+				FParse::Value(*Arg, TEXT("Output="), OutputPath);
+			}
+
+			TArray<TSharedPtr<FJsonValue>> Players;
+			ForEachLocalManager(World, [&Players](const UEasyUserInterfaceManager& Manager)
+			{
+				Players.Add(MakeShared<FJsonValueObject>(FEasyUserInterfaceDebugger::DumpState(Manager)));
+			});
+
+			const TSharedRef<FJsonObject> Dump = MakeShared<FJsonObject>();
+			Dump->SetStringField(TEXT("Time"), FDateTime::UtcNow().ToIso8601());
+			Dump->SetArrayField(TEXT("Players"), Players);
+			if (FEasyUserInterfaceJson::WriteToFile(Dump, OutputPath))
+			{
+				UE_LOG(LogEasyUserInterfaceManagement, Display, TEXT("User Interface state of %d local player(s) written to %s"), Players.Num(), *OutputPath);
+			}
+		}));
+
+	FAutoConsoleCommand DebugCommand(
+		TEXT("EasyUI.Debug"),
+		TEXT("Toggles the User Interface Manager debug overlay.\n")
+		TEXT("Usage: EasyUI.Debug [0|1]"),
+		FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+		{
+			const bool bEnable = Args.Num() > 0 ? FCString::ToBool(*Args[0]) : !FEasyUserInterfaceDebugger::IsOverlayEnabled();
+			FEasyUserInterfaceDebugger::SetOverlayEnabled(bEnable);
+		}));
+#endif
+}
+
+TSharedRef<FJsonObject> FEasyUserInterfaceDebugger::DumpState(const UEasyUserInterfaceManager& Manager)
+{
+	using namespace EasyUserInterfaceDebugger;
+
+	const TSharedRef<FJsonObject> State = MakeShared<FJsonObject>();
+	const ULocalPlayer* LocalPlayer = Manager.GetLocalPlayer();
+	State->SetNumberField(TEXT("LocalPlayerIndex"), LocalPlayer ? LocalPlayer->GetLocalPlayerIndex() : INDEX_NONE);
+	State->SetBoolField(TEXT("IsShuttingDown"), UEasyUserInterfaceManager::IsUserInterfaceShuttingDown());
+
+	TSharedRef<FJsonObject> InputObject = MakeShared<FJsonObject>();
+	if (const UCommonUIActionRouterBase* ActionRouter = FindActionRouter(Manager))
+	{
+		InputObject->SetStringField(TEXT("ActiveInputMode"), EnumToString(ActionRouter->GetActiveInputMode()));
+		InputObject->SetStringField(TEXT("ActiveMouseCaptureMode"), EnumToString(ActionRouter->GetActiveMouseCaptureMode()));
+	}
+	State->SetObjectField(TEXT("Input"), InputObject);
+
+	const double Now = FPlatformTime::Seconds();
+	TArray<TSharedPtr<FJsonValue>> PendingLoads;
+	for (const FEasyUserInterfacePendingLoad& PendingLoad : Manager.GetPendingLoads())
+	{
+		PendingLoads.Add(MakeShared<FJsonValueObject>(MakePendingLoadObject(PendingLoad, Now)));
+	}
+	State->SetNumberField(TEXT("PrefetchedClasses"), Manager.GetPrefetcher().GetNumPrefetchedClasses());
+	State->SetNumberField(TEXT("PrefetchHits"), Manager.GetPrefetcher().GetNumHits());
+	State->SetNumberField(TEXT("PrefetchMisses"), Manager.GetPrefetcher().GetNumMisses());
+	State->SetNumberField(TEXT("PooledNotifications"), Manager.GetNumPooledNotifications());
+	State->SetNumberField(TEXT("CoalescedNotifications"), Manager.GetNotificationThrottle().GetNumCoalesced());
+	State->SetNumberField(TEXT("RateLimitedNotifications"), Manager.GetNotificationThrottle().GetNumRateLimited());
+	State->SetNumberField(TEXT("ExpiredNotifications"), Manager.GetNotificationBacklog().GetNumExpired());
+	State->SetNumberField(TEXT("EvictedNotifications"), Manager.GetNotificationBacklog().GetNumEvicted());
+	State->SetNumberField(TEXT("TimedNotifications"), Manager.GetNotificationTimingWheel().GetNumScheduled());
+	State->SetNumberField(TEXT("BootPreloadedAssets"), Manager.GetBootPreloader().GetNumPreloadedAssets());
+	State->SetNumberField(TEXT("SyncLoads"), FEasyUserInterfaceSyncLoadDetector::GetNumDetections());
+
+	const UEasyUserInterfaceRootWidget* RootWidget = Manager.RootWidget;
+	if (!IsValid(RootWidget))
+	{
+		State->SetField(TEXT("RootWidget"), MakeShared<FJsonValueNull>());
+		State->SetArrayField(TEXT("PendingLoads"), PendingLoads);
+		return State;
+	}
+	State->SetStringField(TEXT("RootWidget"), RootWidget->GetClass()->GetName());
+
+	for (const FEasyUserInterfacePendingLoad& PendingLoad : RootWidget->GetPendingLoads())
+	{
+		PendingLoads.Add(MakeShared<FJsonValueObject>(MakePendingLoadObject(PendingLoad, Now)));
+	}
+	State->SetArrayField(TEXT("PendingLoads"), PendingLoads);
+
+	// Stacks, their widgets and the input config each top widget asks for
+	TArray<TSharedPtr<FJsonValue>> Stacks;
+	TSet<const UObject*> StackedWidgets;
+	TSet<UObject*> StackOuters;
+	for (const FGameplayTag& LayerTag : RootWidget->GetRegisteredStackLayers())
+	{
+		const TSharedRef<FJsonObject> StackObject = MakeShared<FJsonObject>();
+		StackObject->SetStringField(TEXT("Layer"), LayerTag.ToString());
+
+		const UCommonActivatableWidgetStack* Stack = RootWidget->FindWidgetStack(LayerTag);
+		const FEasyUserInterfaceLayerState* LayerState = RootWidget->FindLayerState(LayerTag);
+		StackObject->SetBoolField(TEXT("IsTransitioning"), LayerState && LayerState->bIsTransitioning);
+
+		TArray<TSharedPtr<FJsonValue>> Widgets;
+		if (Stack)
+		{
+			StackOuters.Add(Stack->GetOuter());
+			const UCommonActivatableWidget* ActiveWidget = Stack->GetActiveWidget();
+			for (const UCommonActivatableWidget* Widget : Stack->GetWidgetList())
+			{
+				if (!Widget)
+				{
+					continue;
+				}
+				StackedWidgets.Add(Widget);
+
+				const TSharedRef<FJsonObject> WidgetObject = MakeWidgetObject(*Widget);
+				WidgetObject->SetBoolField(TEXT("IsActivated"), Widget->IsActivated());
+				WidgetObject->SetBoolField(TEXT("IsDisplayed"), Widget == ActiveWidget);
+				if (const UEasyActivatableWidgetBase* EasyWidget = Cast<UEasyActivatableWidgetBase>(Widget))
+				{
+					WidgetObject->SetNumberField(TEXT("NumBindings"), EasyWidget->GetNumRegisteredBindings());
+				}
+				if (const TOptional<FUIInputConfig> InputConfig = Widget->GetDesiredInputConfig())
+				{
+					WidgetObject->SetObjectField(TEXT("DesiredInputConfig"), MakeInputConfigObject(InputConfig.GetValue()));
+				}
+				Widgets.Add(MakeShared<FJsonValueObject>(WidgetObject));
+			}
+		}
+		StackObject->SetNumberField(TEXT("NumWidgets"), Widgets.Num());
+		StackObject->SetArrayField(TEXT("Widgets"), Widgets);
+		Stacks.Add(MakeShared<FJsonValueObject>(StackObject));
+	}
+	State->SetArrayField(TEXT("Stacks"), Stacks);
+
+	// Stacks create their widgets in the widget tree they live in, so instances kept there but not on any stack are pooled
+	TArray<TSharedPtr<FJsonValue>> PooledWidgets;
+	TArray<UObject*> OuterObjects;
+	for (UObject* StackOuter : StackOuters)
+	{
+		OuterObjects.Reset();
+		GetObjectsWithOuter(StackOuter, OuterObjects, false);
+		for (const UObject* Object : OuterObjects)
+		{
+			const UCommonActivatableWidget* Widget = Cast<UCommonActivatableWidget>(Object);
+			if (IsValid(Widget) && !StackedWidgets.Contains(Widget))
+			{
+				PooledWidgets.Add(MakeShared<FJsonValueObject>(MakeWidgetObject(*Widget)));
+			}
+		}
+	}
+	State->SetArrayField(TEXT("PooledWidgets"), PooledWidgets);
+
+	// Notification panels and the remaining lifetime of their notifications
+	TArray<TSharedPtr<FJsonValue>> Panels;
+	TArray<UUserWidget*> LayerWidgets;
+	for (const FGameplayTag& LayerTag : RootWidget->GetRegisteredNotificationLayers())
+	{
+		const TSharedRef<FJsonObject> PanelObject = MakeShared<FJsonObject>();
+		PanelObject->SetStringField(TEXT("Layer"), LayerTag.ToString());
+		PanelObject->SetStringField(TEXT("Panel"), GetNameSafe(RootWidget->GetNotificationPanel(LayerTag)));
+		PanelObject->SetNumberField(TEXT("ActiveNotifications"), RootWidget->GetActiveNotificationCount(LayerTag));
+		PanelObject->SetNumberField(TEXT("QueuedNotifications"), Manager.GetQueuedNotificationCount(LayerTag));
+
+		TArray<TSharedPtr<FJsonValue>> Notifications;
+		LayerWidgets.Reset();
+		RootWidget->GetLayerWidgets(LayerTag, LayerWidgets);
+		for (const UUserWidget* Widget : LayerWidgets)
+		{
+			const UEasyNotificationWidget* Notification = Cast<UEasyNotificationWidget>(Widget);
+			if (!Notification)
+			{
+				continue;
+			}
+
+			const TSharedRef<FJsonObject> NotificationObject = MakeWidgetObject(*Notification);
+			NotificationObject->SetNumberField(TEXT("CoalescedCount"), Notification->GetCoalescedCount());
+			float TimeRemaining = 0.0f;
+			float Ratio = 0.0f;
+			if (Notification->GetTimeRemaining(TimeRemaining, Ratio))
+			{
+				NotificationObject->SetNumberField(TEXT("RemainingSeconds"), TimeRemaining);
+			}
+			else
+			{
+				// Dismissed manually
+				NotificationObject->SetField(TEXT("RemainingSeconds"), MakeShared<FJsonValueNull>());
+			}
+			Notifications.Add(MakeShared<FJsonValueObject>(NotificationObject));
+		}
+		PanelObject->SetArrayField(TEXT("Notifications"), Notifications);
+		Panels.Add(MakeShared<FJsonValueObject>(PanelObject));
+	}
+	State->SetArrayField(TEXT("NotificationPanels"), Panels);
+
+	return State;
+}
+
+FString FEasyUserInterfaceDebugger::GetDefaultDumpPath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyUI"), TEXT("Dump.json"));
+}
+
+void FEasyUserInterfaceDebugger::SetOverlayEnabled(bool bEnabled)
+{
+	using namespace EasyUserInterfaceDebugger;
+
+	if (bEnabled == IsOverlayEnabled())
+	{
+		return;
+	}
+
+	if (bEnabled)
+	{
+		OverlayDrawHandle = UDebugDrawService::Register(TEXT("Game"), FDebugDrawDelegate::CreateStatic(&FEasyUserInterfaceDebugger::DrawOverlay));
+	}
+	else
+	{
+		UDebugDrawService::Unregister(OverlayDrawHandle);
+		OverlayDrawHandle.Reset();
+		OverlayCaches.Empty();
+	}
+}
+
+bool FEasyUserInterfaceDebugger::IsOverlayEnabled()
+{
+	return EasyUserInterfaceDebugger::OverlayDrawHandle.IsValid();
+}
+
+void FEasyUserInterfaceDebugger::DrawOverlay(UCanvas* Canvas, APlayerController* PlayerController)
+{
+	using namespace EasyUserInterfaceDebugger;
+
+	const ULocalPlayer* LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+	const UEasyUserInterfaceManager* Manager = LocalPlayer ? LocalPlayer->GetSubsystem<UEasyUserInterfaceManager>() : nullptr;
+	if (!Canvas || !Manager)
+	{
+		return;
+	}
+
+	FOverlayCache& Cache = OverlayCaches.FindOrAdd(Manager);
+	const double Now = FPlatformTime::Seconds();
+	if (Cache.LastBuildTime < 0.0 || Now - Cache.LastBuildTime >= OverlayRefreshInterval)
+	{
+		Cache.Lines.Reset();
+		BuildOverlayLines(*Manager, Cache.Lines);
+		Cache.LastBuildTime = Now;
+	}
+
+	const UFont* Font = GEngine->GetSmallFont();
+	const float LineHeight = Font->GetMaxCharHeight();
+	FFontRenderInfo RenderInfo;
+	RenderInfo.bEnableShadow = true;
+
+	float Y = Canvas->ClipY * 0.1f;
+	Canvas->SetDrawColor(FColor::White);
+	for (const FString& Line : Cache.Lines)
+	{
+		Canvas->DrawText(Font, Line, 20.0f, Y, 1.0f, 1.0f, RenderInfo);
+		Y += LineHeight;
+	}
+}
+
+void FEasyUserInterfaceDebugger::BuildOverlayLines(const UEasyUserInterfaceManager& Manager, TArray<FString>& OutLines)
+{
+	using namespace EasyUserInterfaceDebugger;
+
+	FString InputMode = TEXT("-");
+	if (const UCommonUIActionRouterBase* ActionRouter = FindActionRouter(Manager))
+	{
+		InputMode = EnumToString(ActionRouter->GetActiveInputMode());
+	}
+
+	const UEasyUserInterfaceRootWidget* RootWidget = Manager.RootWidget;
+	const int32 NumPendingLoads = Manager.GetPendingLoads().Num() + (IsValid(RootWidget) ? RootWidget->GetPendingLoads().Num() : 0);
+	OutLines.Add(FString::Printf(TEXT("Easy UI | Input: %s | Pending loads: %d"), *InputMode, NumPendingLoads));
+
+	if (!IsValid(RootWidget))
+	{
+		OutLines.Add(TEXT("  No root widget"));
+		return;
+	}
+
+	for (const FGameplayTag& LayerTag : RootWidget->GetRegisteredStackLayers())
+	{
+		const FEasyUserInterfaceLayerState* LayerState = RootWidget->FindLayerState(LayerTag);
+		if (!LayerState)
+		{
+			continue;
+		}
+		const UCommonActivatableWidget* TopWidget = LayerState->TopWidget.Get();
+		OutLines.Add(FString::Printf(TEXT("  %s: %d widget(s), top: %s%s"), *LayerTag.ToString(), LayerState->NumWidgets,
+			TopWidget ? *TopWidget->GetClass()->GetName() : TEXT("-"), LayerState->bIsTransitioning ? TEXT(" (transitioning)") : TEXT("")));
+	}
+
+	for (const FGameplayTag& LayerTag : RootWidget->GetRegisteredNotificationLayers())
+	{
+		OutLines.Add(FString::Printf(TEXT("  %s: %d notification(s), %d queued"), *LayerTag.ToString(), RootWidget->GetActiveNotificationCount(LayerTag),
+			Manager.GetQueuedNotificationCount(LayerTag)));
+	}
+}
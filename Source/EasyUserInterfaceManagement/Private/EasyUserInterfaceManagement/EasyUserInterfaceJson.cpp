@@ -0,0 +1,29 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagement/EasyUserInterfaceJson.h"
+
+#include "EasyUserInterfaceManagement.h"
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+bool FEasyUserInterfaceJson::WriteToFile(const TSharedRef<FJsonObject>& Object, const FString& OutputPath)
+{
+	FString JsonString;
+	const TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&JsonString);
+	if (!FJsonSerializer::Serialize(Object, JsonWriter))
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("Failed to serialize the JSON of %s"), *OutputPath);
+		return false;
+	}
+
+	if (!FFileHelper::SaveStringToFile(JsonString, *OutputPath))
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("Failed to write %s"), *OutputPath);
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,251 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagement/EasyUserInterfaceLeakTracker.h"
+
+#include "EasyUserInterfaceManagement.h"
+#include "Blueprint/UserWidget.h"
+#include "Containers/Ticker.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
+#include "ExtensionCommonUI/EasyUserInterfaceRootWidget.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/ReferenceChainSearch.h"
+#include "UObject/ReferencerFinder.h"
+#include "UObject/UObjectGlobals.h"
+#include "Widgets/CommonActivatableWidgetContainer.h"
+
+bool FEasyUserInterfaceLeakTracker::bIsTracking = false;
+
+namespace EasyUserInterfaceLeakTracker
+{
+	struct FTrackedWidget
+	{
+		TWeakObjectPtr<UUserWidget> Widget;
+		TWeakObjectPtr<const UEasyUserInterfaceRootWidget> RootWidget;
+		/** Garbage collections survived while released */
+		int32 NumCollectionsReleased = 0;
+		bool bHasBeenReported = false;
+	};
+	TArray<FTrackedWidget> TrackedWidgets;
+	int32 NumLeakedWidgets = 0;
+	FDelegateHandle PostGarbageCollectHandle;
+	bool bIsCheckPending = false;
+	/** Collections seen while tracking, a released widget ages once per collection however many checks run */
+	uint32 NumCollections = 0;
+	uint32 LastCheckedCollection = 0;
+
+	bool bTrackingRequested = false;
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleVariableRef CVarLeakTracking(
+		TEXT("EasyUI.LeakTracking"),
+		bTrackingRequested,
+		TEXT("Tracks the widgets created by the plugin and reports the ones still alive after they are released."),
+		FConsoleVariableDelegate::CreateLambda([](IConsoleVariable*)
+		{
+			FEasyUserInterfaceLeakTracker::SetTrackingEnabled(bTrackingRequested);
+		}));
+#endif
+
+	int32 GraceCollections = 2;
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleVariableRef CVarLeakTrackingGraceCollections(
+		TEXT("EasyUI.LeakTracking.GraceCollections"),
+		GraceCollections,
+		TEXT("Garbage collections a released widget may survive before it is reported, covers Slate and timers letting go of it a bit late."));
+#endif
+
+	/** Checks if the widget is still in use: on a stack, in a notification panel or in the viewport */
+	bool IsInUse(const UUserWidget& Widget, const UEasyUserInterfaceRootWidget* RootWidget)
+	{
+		return (RootWidget && RootWidget->FindWidgetLayer(&Widget).IsValid()) || Widget.GetParent() || Widget.IsInViewport();
+	}
+
+	/** Checks if the widget is only kept by the widget pools of stacks or the notification pools of the manager, waiting to be reused */
+	bool IsPooled(const TArray<UObject*>& Referencers)
+	{
+		if (Referencers.IsEmpty())
+		{
+			return false;
+		}
+
+		for (const UObject* Referencer : Referencers)
+		{
+			if (!Referencer->IsA<UCommonActivatableWidgetContainerBase>() && !Referencer->IsA<UEasyUserInterfaceManager>())
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	void ReportLeak(UUserWidget& Widget, const TArray<UObject*>& Referencers)
+	{
+		++NumLeakedWidgets;
+
+		FString ReferencerNames;
+		for (const UObject* Referencer : Referencers)
+		{
+			ReferencerNames += FString::Printf(TEXT("\n\t%s (%s)"), *Referencer->GetFullName(), *Referencer->GetClass()->GetName());
+		}
+		UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("Leaked widget %s is still alive after being released, direct referencers:%s"),
+			*Widget.GetFullName(), ReferencerNames.IsEmpty() ? TEXT(" none, kept by a native reference (FGCObject or root set)") : *ReferencerNames);
+
+		// Prints the shortest chain from a root to the widget, the holder of the delegate or lambda is usually its last link
+		FReferenceChainSearch(&Widget, EReferenceChainSearchMode::Shortest | EReferenceChainSearchMode::PrintResults);
+	}
+}
+
+void FEasyUserInterfaceLeakTracker::SetTrackingEnabled(bool bEnabled)
+{
+	using namespace EasyUserInterfaceLeakTracker;
+
+	if (bIsTracking == bEnabled)
+	{
+		return;
+	}
+
+	bIsTracking = bEnabled;
+	bTrackingRequested = bEnabled;
+	if (bEnabled)
+	{
+		PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddStatic(&FEasyUserInterfaceLeakTracker::HandlePostGarbageCollect);
+	}
+	else
+	{
+		FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+		PostGarbageCollectHandle.Reset();
+		TrackedWidgets.Empty();
+	}
+
+	UE_LOG(LogEasyUserInterfaceManagement, Display, TEXT("Widget leak tracking %s."), bEnabled ? TEXT("enabled") : TEXT("disabled"));
+}
+
+void FEasyUserInterfaceLeakTracker::TrackWidget(UUserWidget& Widget, const UEasyUserInterfaceRootWidget* RootWidget)
+{
+	if (!bIsTracking)
+	{
+		return;
+	}
+
+	// Reused widgets are tracked once, and start over as in use
+	for (EasyUserInterfaceLeakTracker::FTrackedWidget& TrackedWidget : EasyUserInterfaceLeakTracker::TrackedWidgets)
+	{
+		if (TrackedWidget.Widget.Get() == &Widget)
+		{
+			TrackedWidget.RootWidget = RootWidget;
+			TrackedWidget.NumCollectionsReleased = 0;
+			return;
+		}
+	}
+
+	EasyUserInterfaceLeakTracker::FTrackedWidget& TrackedWidget = EasyUserInterfaceLeakTracker::TrackedWidgets.AddDefaulted_GetRef();
+	TrackedWidget.Widget = &Widget;
+	TrackedWidget.RootWidget = RootWidget;
+}
+
+int32 FEasyUserInterfaceLeakTracker::CheckNow()
+{
+	CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+	CheckTrackedWidgets();
+	return EasyUserInterfaceLeakTracker::NumLeakedWidgets;
+}
+
+int32 FEasyUserInterfaceLeakTracker::GetNumLeakedWidgets()
+{
+	return EasyUserInterfaceLeakTracker::NumLeakedWidgets;
+}
+
+void FEasyUserInterfaceLeakTracker::ResetLeakCount()
+{
+	EasyUserInterfaceLeakTracker::NumLeakedWidgets = 0;
+}
+
+void FEasyUserInterfaceLeakTracker::CheckTrackedWidgets()
+{
+	using namespace EasyUserInterfaceLeakTracker;
+
+	if (LastCheckedCollection == NumCollections)
+	{
+		return;
+	}
+	LastCheckedCollection = NumCollections;
+
+	TrackedWidgets.RemoveAllSwap([](const FTrackedWidget& TrackedWidget)
+	{
+		return !TrackedWidget.Widget.IsValid();
+	});
+
+	for (FTrackedWidget& TrackedWidget : TrackedWidgets)
+	{
+		UUserWidget* Widget = TrackedWidget.Widget.Get();
+		if (TrackedWidget.bHasBeenReported || IsInUse(*Widget, TrackedWidget.RootWidget.Get()))
+		{
+			TrackedWidget.NumCollectionsReleased = 0;
+			continue;
+		}
+
+		const TArray<UObject*> Referencers = FReferencerFinder::GetAllReferencers(TArray<UObject*>{ Widget }, nullptr, EReferencerFinderFlags::SkipInnerReferences);
+		if (IsPooled(Referencers))
+		{
+			TrackedWidget.NumCollectionsReleased = 0;
+			continue;
+		}
+
+		if (++TrackedWidget.NumCollectionsReleased > GraceCollections)
+		{
+			TrackedWidget.bHasBeenReported = true;
+			ReportLeak(*Widget, Referencers);
+		}
+	}
+}
+
+void FEasyUserInterfaceLeakTracker::HandlePostGarbageCollect()
+{
+	++EasyUserInterfaceLeakTracker::NumCollections;
+	if (EasyUserInterfaceLeakTracker::bIsCheckPending)
+	{
+		return;
+	}
+
+	EasyUserInterfaceLeakTracker::bIsCheckPending = true;
+	FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([](float DeltaTime)
+	{
+		EasyUserInterfaceLeakTracker::bIsCheckPending = false;
+		if (bIsTracking)
+		{
+			CheckTrackedWidgets();
+		}
+		return false;
+	}));
+}
+
+namespace EasyUserInterfaceLeakTracker
+{
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleCommandWithWorldAndArgs LeaksCommand(
+		TEXT("EasyUI.Leaks"),
+		TEXT("Checks the widgets tracked by EasyUI.LeakTracking for leaks after a full garbage collection, or resets the leak counter.\n")
+		TEXT("Usage: EasyUI.Leaks [Check|Reset]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (Args.Num() > 0 && Args[0].Equals(TEXT("Reset"), ESearchCase::IgnoreCase))
+			{
+				FEasyUserInterfaceLeakTracker::ResetLeakCount();
+				return;
+			}
+
+			if (!FEasyUserInterfaceLeakTracker::IsTracking())
+			{
+				UE_LOG(LogEasyUserInterfaceManagement, Warning, TEXT("Leaks: widget leak tracking is disabled, enable it with EasyUI.LeakTracking 1 before creating the widgets to check."));
+				return;
+			}
+
+			// A single check only catches the widgets already past their grace collections
+			for (int32 Collection = 0; Collection <= GraceCollections; ++Collection)
+			{
+				FEasyUserInterfaceLeakTracker::CheckNow();
+			}
+			UE_LOG(LogEasyUserInterfaceManagement, Display, TEXT("Leaks: %d leaked widget(s) found, %d widget(s) tracked."), FEasyUserInterfaceLeakTracker::GetNumLeakedWidgets(), TrackedWidgets.Num());
+		}));
+#endif
+}
@@ -6,9 +6,75 @@
 #include "EasyUserInterfaceManagement.h"
 #include "Engine/AssetManager.h"
 #include "Engine/StreamableManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceLeakTracker.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceMemory.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceReplay.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSettings.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceStats.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSyncLoadDetector.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceTrace.h"
 #include "ExtensionCommonUI/EasyUserInterfaceRootWidget.h"
+#include "ExtensionCommonUI/Localization/EasyLocalizedWidgetInterface.h"
 #include "Input/CommonUIActionRouterBase.h"
+#include "Internationalization/Internationalization.h"
+#include "UObject/UObjectHash.h"
 
+bool UEasyUserInterfaceManager::bIsUserInterfaceShuttingDown = false;
+
+void UEasyUserInterfaceManager::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	FInternationalization::Get().OnCultureChanged().AddUObject(this, &UEasyUserInterfaceManager::HandleCultureChanged);
+	Prefetcher.Initialize(*this);
+	BootPreloader.Initialize(*this);
+	NotificationThrottle.Initialize(*this);
+	NotificationBacklog.Initialize(*this);
+	NotificationTimingWheel.Initialize(*this);
+}
+
+void UEasyUserInterfaceManager::Deinitialize()
+{
+#if EASYUI_TRACE_ENABLED
+	if (UCommonUIActionRouterBase* ActionRouter = GetLocalPlayer()->GetSubsystem<UCommonUIActionRouterBase>())
+	{
+		ActionRouter->OnActiveInputModeChanged().RemoveAll(this);
+	}
+#endif
+
+	ReleaseManagerState();
+
+	Super::Deinitialize();
+}
+
+void UEasyUserInterfaceManager::ReleaseManagerState()
+{
+	FInternationalization::Get().OnCultureChanged().RemoveAll(this);
+	if (LocalizedTextRefreshTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(LocalizedTextRefreshTickerHandle);
+		LocalizedTextRefreshTickerHandle.Reset();
+	}
+	PendingLocalizedTextRefresh.Empty();
+	Prefetcher.Deinitialize();
+	BootPreloader.Deinitialize();
+	NotificationThrottle.Deinitialize();
+	NotificationBacklog.Deinitialize();
+	NotificationTimingWheel.Deinitialize();
+
+	if (NotificationPoolPrewarmHandle.IsValid())
+	{
+		NotificationPoolPrewarmHandle->CancelHandle();
+		NotificationPoolPrewarmHandle.Reset();
+	}
+	NotificationPools.Empty();
+}
+
+void UEasyUserInterfaceManager::HandleStartGameInstance(UGameInstance* GameInstance)
+{
+	// A previous (PIE) session may have quit through a fast exit, every player of the new session tears down normally
+	bIsUserInterfaceShuttingDown = false;
+}
 
 void UEasyUserInterfaceManager::AddRootWidgetToViewport(TSoftClassPtr<UEasyUserInterfaceRootWidget> InRootWidget, int32 ZOrder)
 {
@@ -25,21 +91,53 @@ void UEasyUserInterfaceManager::AddRootWidgetToViewport(TSoftClassPtr<UEasyUserI
 		return;
 	}
 	
+	FEasyUserInterfaceStats::RecordRequest(EEasyUserInterfaceOperation::AddRootWidget);
+	BootPreloader.RecordAsset(InRootWidget.ToSoftObjectPath());
+	INC_DWORD_STAT(STAT_EasyUI_PendingLoads);
+	EASYUI_TRACE_LOAD_STARTED(FGameplayTag(), InRootWidget.ToSoftObjectPath());
+	const double RequestTime = FPlatformTime::Seconds();
+	PendingLoads.Emplace(FGameplayTag(), InRootWidget.ToSoftObjectPath(), RequestTime);
+
 	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
 
 	TSharedPtr<FStreamableHandle> Handle = Streamable.RequestAsyncLoad(
 		InRootWidget.ToSoftObjectPath(),
 		FStreamableDelegate::CreateWeakLambda(
 			this,
-			[this, InRootWidget, ZOrder]()
+			[this, InRootWidget, ZOrder, RequestTime]()
 			{
+				DEC_DWORD_STAT(STAT_EasyUI_PendingLoads);
+				PendingLoads.RemoveSingle(FEasyUserInterfacePendingLoad(FGameplayTag(), InRootWidget.ToSoftObjectPath(), RequestTime));
+				FEasyUserInterfaceStats::RecordLatency(EEasyUserInterfaceOperation::AddRootWidget, EEasyUserInterfaceLatencyPhase::LoadWait, FPlatformTime::Seconds() - RequestTime);
+
 				// At this point, the asset is loaded; get the loaded class via the soft pointer.
 				UClass* LoadedClass = InRootWidget.Get();
+				EASYUI_TRACE_LOAD_FINISHED(FGameplayTag(), InRootWidget.ToSoftObjectPath(), LoadedClass != nullptr);
 				if (LoadedClass)
 				{
 					// Create the widget instance
-					RootWidget = CreateWidget<UEasyUserInterfaceRootWidget>(GetLocalPlayer()->GetPlayerController(GetWorld()), LoadedClass);
-					RootWidget->AddToViewport(ZOrder);
+					{
+						SCOPE_CYCLE_COUNTER(STAT_EasyUI_AddRootWidget_Construct);
+						LLM_SCOPE_BYTAG(EasyUI);
+						FEasyUserInterfaceLatencyScope LatencyScope(EEasyUserInterfaceOperation::AddRootWidget, EEasyUserInterfaceLatencyPhase::Construct);
+						FEasyUserInterfaceSyncLoadScope SyncLoadScope(LoadedClass, TEXT("AddRootWidget"));
+						RootWidget = CreateWidget<UEasyUserInterfaceRootWidget>(GetLocalPlayer()->GetPlayerController(GetWorld()), LoadedClass);
+					}
+					BindRootWidgetEvents();
+#if EASYUI_TRACE_ENABLED
+					if (UCommonUIActionRouterBase* ActionRouter = GetLocalPlayer()->GetSubsystem<UCommonUIActionRouterBase>())
+					{
+						ActionRouter->OnActiveInputModeChanged().AddUObject(this, &UEasyUserInterfaceManager::HandleActiveInputModeChanged);
+					}
+#endif
+					{
+						SCOPE_CYCLE_COUNTER(STAT_EasyUI_AddRootWidget_Activate);
+						FEasyUserInterfaceLatencyScope LatencyScope(EEasyUserInterfaceOperation::AddRootWidget, EEasyUserInterfaceLatencyPhase::Activate);
+						FEasyUserInterfaceSyncLoadScope SyncLoadScope(LoadedClass, TEXT("AddRootWidget"));
+						RootWidget->AddToViewport(ZOrder);
+					}
+					FEasyUserInterfaceStats::RecordLatency(EEasyUserInterfaceOperation::AddRootWidget, EEasyUserInterfaceLatencyPhase::Total, FPlatformTime::Seconds() - RequestTime);
+					PrewarmNotificationPools();
 					OnRootWidgetAddedToViewport.Broadcast(RootWidget);
 				}
 				else
@@ -53,14 +151,70 @@ void UEasyUserInterfaceManager::AddRootWidgetToViewport(TSoftClassPtr<UEasyUserI
 	if (!Handle.IsValid())
 	{
 		UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("Failed to start async load for root widget class."));
+
+		// The completion never runs, so the load is no longer pending
+		if (PendingLoads.RemoveSingle(FEasyUserInterfacePendingLoad(FGameplayTag(), InRootWidget.ToSoftObjectPath(), RequestTime)) > 0)
+		{
+			DEC_DWORD_STAT(STAT_EasyUI_PendingLoads);
+			EASYUI_TRACE_LOAD_FINISHED(FGameplayTag(), InRootWidget.ToSoftObjectPath(), false);
+		}
 	}
 }
 
+void UEasyUserInterfaceManager::BeginFastExit()
+{
+	if (bIsUserInterfaceShuttingDown)
+	{
+		return;
+	}
+
+	UE_LOG(LogEasyUserInterfaceManagement, Log, TEXT("Fast exit requested, skipping User Interface teardown."));
+	bIsUserInterfaceShuttingDown = true;
+
+	ReleaseManagerState();
+}
+
 UEasyUserInterfaceRootWidget* UEasyUserInterfaceManager::GetRootWidget()
 {
 	return RootWidget;
 }
 
+void UEasyUserInterfaceManager::BindRootWidgetEvents()
+{
+	RootWidget->OnLayerWidgetPushed().AddUObject(this, &UEasyUserInterfaceManager::HandleLayerWidgetPushed);
+	RootWidget->OnLayerWidgetPopped().AddUObject(this, &UEasyUserInterfaceManager::HandleLayerWidgetPopped);
+	RootWidget->OnLayerTopWidgetChanged().AddUObject(this, &UEasyUserInterfaceManager::HandleLayerTopWidgetChanged);
+	RootWidget->OnNotificationCountChanged().AddUObject(this, &UEasyUserInterfaceManager::HandleNotificationCountChanged);
+}
+
+void UEasyUserInterfaceManager::HandleLayerWidgetPushed(const FGameplayTag& LayerTag, UCommonActivatableWidget* Widget)
+{
+	Prefetcher.HandleLayerWidgetPushed(LayerTag, Widget);
+	OnLayerWidgetPushed.Broadcast(LayerTag, Widget);
+}
+
+void UEasyUserInterfaceManager::HandleLayerWidgetPopped(const FGameplayTag& LayerTag, UCommonActivatableWidget* Widget)
+{
+	OnLayerWidgetPopped.Broadcast(LayerTag, Widget);
+}
+
+void UEasyUserInterfaceManager::HandleLayerTopWidgetChanged(const FGameplayTag& LayerTag, UCommonActivatableWidget* Widget)
+{
+	Prefetcher.HandleLayerTopWidgetChanged(LayerTag, Widget);
+	OnLayerTopWidgetChanged.Broadcast(LayerTag, Widget);
+}
+
+void UEasyUserInterfaceManager::HandleNotificationCountChanged(const FGameplayTag& LayerTag, int32 NotificationCount)
+{
+	NotificationBacklog.HandleNotificationCountChanged(LayerTag, NotificationCount);
+	OnNotificationCountChanged.Broadcast(LayerTag, NotificationCount);
+}
+
+void UEasyUserInterfaceManager::HandleActiveInputModeChanged(ECommonInputMode NewInputMode)
+{
+	EASYUI_TRACE_EVENT(InputModeChanged, FGameplayTag(), nullptr, StaticEnum<ECommonInputMode>()->GetNameStringByValue(static_cast<int64>(NewInputMode)));
+}
+
 bool UEasyUserInterfaceManager::PushWidgetToStackAsync(FGameplayTag LayerTag,
 	TSoftClassPtr<UCommonActivatableWidget> InWidget, FOnWidgetUpdatedOnStack OnWidgetAdded)
 {
@@ -69,11 +223,36 @@ bool UEasyUserInterfaceManager::PushWidgetToStackAsync(FGameplayTag LayerTag,
 		UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("Root widget is not registered. Cannot push widget to stack."));
 		return false;
 	}
-	
+
+	Prefetcher.RecordWidgetRequest(InWidget.ToSoftObjectPath());
+	BootPreloader.RecordAsset(InWidget.ToSoftObjectPath());
 	RootWidget->PushWidgetToStackAsync(LayerTag, InWidget, OnWidgetAdded);
 	return true;
 }
 
+UCommonActivatableWidget* UEasyUserInterfaceManager::PopWidgetFromStack(FGameplayTag LayerTag)
+{
+	const UCommonActivatableWidgetStack* WidgetStack = GetWidgetStackFromRoot(LayerTag);
+	UCommonActivatableWidget* TopWidget = WidgetStack ? WidgetStack->GetActiveWidget() : nullptr;
+	if (!TopWidget)
+	{
+		return nullptr;
+	}
+
+	return RootWidget->RemoveWidgetFromStack(LayerTag, TopWidget) ? TopWidget : nullptr;
+}
+
+bool UEasyUserInterfaceManager::RemoveWidgetFromStack(FGameplayTag LayerTag, UCommonActivatableWidget* Widget)
+{
+	if (!RootWidget)
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("Root widget is not registered. Cannot remove widget from stack."));
+		return false;
+	}
+
+	return RootWidget->RemoveWidgetFromStack(LayerTag, Widget);
+}
+
 UCommonActivatableWidgetStack* UEasyUserInterfaceManager::GetWidgetStackFromRoot(FGameplayTag LayerTag) const
 {
 	if (!RootWidget)
@@ -91,11 +270,61 @@ UCommonActivatableWidgetStack* UEasyUserInterfaceManager::GetWidgetStackFromRoot
 	return nullptr;
 }
 
+UCommonActivatableWidgetStack* UEasyUserInterfaceManager::FindWidgetStack(FGameplayTag LayerTag) const
+{
+	return RootWidget ? RootWidget->FindWidgetStack(LayerTag) : nullptr;
+}
+
+UCommonActivatableWidget* UEasyUserInterfaceManager::GetLayerTopWidget(FGameplayTag LayerTag) const
+{
+	const FEasyUserInterfaceLayerState* LayerState = RootWidget ? RootWidget->FindLayerState(LayerTag) : nullptr;
+	return LayerState ? LayerState->TopWidget.Get() : nullptr;
+}
+
+int32 UEasyUserInterfaceManager::GetLayerWidgetCount(FGameplayTag LayerTag) const
+{
+	const FEasyUserInterfaceLayerState* LayerState = RootWidget ? RootWidget->FindLayerState(LayerTag) : nullptr;
+	return LayerState ? LayerState->NumWidgets : 0;
+}
+
+UWidget* UEasyUserInterfaceManager::FindNotificationPanel(FGameplayTag LayerTag) const
+{
+	return RootWidget ? RootWidget->GetNotificationPanel(LayerTag) : nullptr;
+}
+
+TArray<FEasyUserInterfaceLayerMemoryReport> UEasyUserInterfaceManager::GetLayerMemoryReport() const
+{
+	if (!IsRootWidgetReady())
+	{
+		return TArray<FEasyUserInterfaceLayerMemoryReport>();
+	}
+	return FEasyUserInterfaceMemory::BuildReport(*RootWidget);
+}
+
+int32 UEasyUserInterfaceManager::GetActiveNotificationCount(FGameplayTag LayerTag) const
+{
+	return RootWidget ? RootWidget->GetActiveNotificationCount(LayerTag) : 0;
+}
+
+int32 UEasyUserInterfaceManager::GetQueuedNotificationCount(FGameplayTag LayerTag) const
+{
+	return NotificationBacklog.GetNumQueued(LayerTag);
+}
+
 bool UEasyUserInterfaceManager::AddNotificationToPanel(
 	FGameplayTag LayerTag,
 	TSoftClassPtr<UEasyNotificationWidget> NotificationWidgetClass,
 	const FEasyNotificationWidgetInfo& NotificationInfo,
 	FOnNotificationAddedToPanel OnNotificationAdded)
+{
+	return AddNotificationToPanel(LayerTag, NotificationWidgetClass, MakeShared<const FEasyNotificationWidgetInfo>(NotificationInfo), OnNotificationAdded);
+}
+
+bool UEasyUserInterfaceManager::AddNotificationToPanel(
+	FGameplayTag LayerTag,
+	TSoftClassPtr<UEasyNotificationWidget> NotificationWidgetClass,
+	const FEasyNotificationWidgetInfoRef& NotificationInfo,
+	FOnNotificationAddedToPanel OnNotificationAdded)
 {
 	if (!RootWidget)
 	{
@@ -103,28 +332,45 @@ bool UEasyUserInterfaceManager::AddNotificationToPanel(
 		return false;
 	}
 
-	// Make a copy of the soft class pointer so we can resolve it inside the lambda
-	TSoftClassPtr<UEasyNotificationWidget> ClassToLoad = NotificationWidgetClass;
+	if (FEasyUserInterfaceReplay::IsRecording())
+	{
+		FEasyUserInterfaceReplay::RecordAddNotification(GetLocalPlayer(), FGameplayTagContainer(LayerTag), NotificationWidgetClass.ToSoftObjectPath(), *NotificationInfo);
+	}
+
+	FEasyUserInterfaceStats::RecordRequest(EEasyUserInterfaceOperation::AddNotification);
+	RecordBootPreloadNotification(NotificationWidgetClass, *NotificationInfo);
+	INC_DWORD_STAT(STAT_EasyUI_PendingLoads);
+	EASYUI_TRACE_LOAD_STARTED(LayerTag, NotificationWidgetClass.ToSoftObjectPath());
+	const double RequestTime = FPlatformTime::Seconds();
+	PendingLoads.Emplace(LayerTag, NotificationWidgetClass.ToSoftObjectPath(), RequestTime);
 
 	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
 	Streamable.RequestAsyncLoad(
-		ClassToLoad.ToSoftObjectPath(),
-		FStreamableDelegate::CreateWeakLambda(this, [this, ClassToLoad, LayerTag, NotificationInfo, OnNotificationAdded]()
+		NotificationWidgetClass.ToSoftObjectPath(),
+		FStreamableDelegate::CreateWeakLambda(this, [this, NotificationWidgetClass, LayerTag, NotificationInfo, OnNotificationAdded = MoveTemp(OnNotificationAdded), RequestTime]()
 		{
+			DEC_DWORD_STAT(STAT_EasyUI_PendingLoads);
+			PendingLoads.RemoveSingle(FEasyUserInterfacePendingLoad(LayerTag, NotificationWidgetClass.ToSoftObjectPath(), RequestTime));
+			FEasyUserInterfaceStats::RecordLatency(EEasyUserInterfaceOperation::AddNotification, EEasyUserInterfaceLatencyPhase::LoadWait, FPlatformTime::Seconds() - RequestTime);
+
 			if (!IsValid(RootWidget))
 			{
 				UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("Root widget is not registered. Cannot add notification to panel."));
 				return;
 			}
 
-			UClass* LoadedClass = ClassToLoad.Get(); // Loaded class now available
+			UClass* LoadedClass = NotificationWidgetClass.Get(); // Loaded class now available
+			EASYUI_TRACE_LOAD_FINISHED(LayerTag, NotificationWidgetClass.ToSoftObjectPath(), LoadedClass != nullptr);
 
 			if (IsValid(LoadedClass))
 			{
-				UEasyNotificationWidget* NotificationWidget = CreateWidget<UEasyNotificationWidget>(GetLocalPlayer()->GetPlayerController(GetWorld()), LoadedClass);
-				RootWidget->AddNotificationWidgetToPanel(LayerTag, NotificationWidget, NotificationInfo);
-				OnNotificationAdded.ExecuteIfBound(LayerTag, NotificationWidget);
-				return;
+				// Merged, rate limited and queued notifications are not shown by this request
+				bool bCreated = false;
+				SpawnNotificationWidget(LayerTag, LoadedClass, *NotificationInfo, MakeArrayView(&OnNotificationAdded, 1), &bCreated);
+				if (bCreated)
+				{
+					FEasyUserInterfaceStats::RecordLatency(EEasyUserInterfaceOperation::AddNotification, EEasyUserInterfaceLatencyPhase::Total, FPlatformTime::Seconds() - RequestTime);
+				}
 			}
 			else
 			{
@@ -135,6 +381,271 @@ bool UEasyUserInterfaceManager::AddNotificationToPanel(
 	return true;
 }
 
+bool UEasyUserInterfaceManager::AddNotificationToPanels(
+	const FGameplayTagContainer& LayerTags,
+	TSoftClassPtr<UEasyNotificationWidget> NotificationWidgetClass,
+	const FEasyNotificationWidgetInfo& NotificationInfo,
+	FOnNotificationAddedToPanel OnNotificationAdded)
+{
+	return AddNotificationToPanels(LayerTags, NotificationWidgetClass, MakeShared<const FEasyNotificationWidgetInfo>(NotificationInfo), OnNotificationAdded);
+}
+
+bool UEasyUserInterfaceManager::AddNotificationToPanels(
+	const FGameplayTagContainer& LayerTags,
+	TSoftClassPtr<UEasyNotificationWidget> NotificationWidgetClass,
+	const FEasyNotificationWidgetInfoRef& NotificationInfo,
+	FOnNotificationAddedToPanel OnNotificationAdded)
+{
+	if (!RootWidget)
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("Root widget is not registered. Cannot add notification to panels."));
+		return false;
+	}
+
+	if (LayerTags.IsEmpty())
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Warning, TEXT("No notification layers provided. Cannot add notification to panels."));
+		return false;
+	}
+
+	if (FEasyUserInterfaceReplay::IsRecording())
+	{
+		FEasyUserInterfaceReplay::RecordAddNotification(GetLocalPlayer(), LayerTags, NotificationWidgetClass.ToSoftObjectPath(), *NotificationInfo);
+	}
+
+	FEasyUserInterfaceStats::RecordRequest(EEasyUserInterfaceOperation::AddNotification);
+	RecordBootPreloadNotification(NotificationWidgetClass, *NotificationInfo);
+	INC_DWORD_STAT(STAT_EasyUI_PendingLoads);
+	EASYUI_TRACE_LOAD_STARTED(LayerTags.First(), NotificationWidgetClass.ToSoftObjectPath());
+	const double RequestTime = FPlatformTime::Seconds();
+	PendingLoads.Emplace(LayerTags.First(), NotificationWidgetClass.ToSoftObjectPath(), RequestTime);
+
+	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
+	Streamable.RequestAsyncLoad(
+		NotificationWidgetClass.ToSoftObjectPath(),
+		FStreamableDelegate::CreateWeakLambda(this, [this, NotificationWidgetClass, LayerTags, NotificationInfo, OnNotificationAdded = MoveTemp(OnNotificationAdded), RequestTime]()
+		{
+			DEC_DWORD_STAT(STAT_EasyUI_PendingLoads);
+			PendingLoads.RemoveSingle(FEasyUserInterfacePendingLoad(LayerTags.First(), NotificationWidgetClass.ToSoftObjectPath(), RequestTime));
+			FEasyUserInterfaceStats::RecordLatency(EEasyUserInterfaceOperation::AddNotification, EEasyUserInterfaceLatencyPhase::LoadWait, FPlatformTime::Seconds() - RequestTime);
+
+			if (!IsValid(RootWidget))
+			{
+				UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("Root widget is not registered. Cannot add notification to panels."));
+				return;
+			}
+
+			UClass* LoadedClass = NotificationWidgetClass.Get();
+			EASYUI_TRACE_LOAD_FINISHED(LayerTags.First(), NotificationWidgetClass.ToSoftObjectPath(), LoadedClass != nullptr);
+			if (!IsValid(LoadedClass))
+			{
+				UE_LOG(LogEasyUserInterfaceManagement, Warning, TEXT("Failed to load notification widget class for tags %s"), *LayerTags.ToStringSimple());
+				return;
+			}
+
+			bool bAnyCreated = false;
+			for (const FGameplayTag& LayerTag : LayerTags)
+			{
+				bool bCreated = false;
+				SpawnNotificationWidget(LayerTag, LoadedClass, *NotificationInfo, MakeArrayView(&OnNotificationAdded, 1), &bCreated);
+				bAnyCreated |= bCreated;
+			}
+			if (bAnyCreated)
+			{
+				FEasyUserInterfaceStats::RecordLatency(EEasyUserInterfaceOperation::AddNotification, EEasyUserInterfaceLatencyPhase::Total, FPlatformTime::Seconds() - RequestTime);
+			}
+		})
+	);
+	return true;
+}
+
+UEasyNotificationWidget* UEasyUserInterfaceManager::AcquireNotificationWidget(UClass* NotificationClass)
+{
+	APlayerController* PlayerController = GetLocalPlayer()->GetPlayerController(GetWorld());
+	if (FEasyNotificationWidgetPool* Pool = NotificationPools.Find(NotificationClass))
+	{
+		while (Pool->FreeWidgets.Num() > 0)
+		{
+			UEasyNotificationWidget* PooledWidget = Pool->FreeWidgets.Pop();
+			// Widgets owned by the player controller of a previous level are left to the garbage collector
+			if (IsValid(PooledWidget) && PooledWidget->GetOwningPlayer() == PlayerController)
+			{
+				PooledWidget->bIsInPool = false;
+				PooledWidget->OnNotificationTakenFromPool();
+				return PooledWidget;
+			}
+		}
+	}
+
+	UEasyNotificationWidget* NotificationWidget = CreateWidget<UEasyNotificationWidget>(PlayerController, NotificationClass);
+	if (NotificationWidget && UEasyUserInterfaceSettings::Get()->bPoolNotificationWidgets && !bIsUserInterfaceShuttingDown)
+	{
+		// The pool of the class exists from the first widget it can take back
+		NotificationPools.FindOrAdd(NotificationClass);
+		NotificationWidget->OwningPoolManager = this;
+	}
+	return NotificationWidget;
+}
+
+void UEasyUserInterfaceManager::ReleaseNotificationWidget(UEasyNotificationWidget& NotificationWidget)
+{
+	// The pools are gone once the manager is torn down, a widget released after that is left to the garbage collector
+	FEasyNotificationWidgetPool* Pool = bIsUserInterfaceShuttingDown ? nullptr : NotificationPools.Find(NotificationWidget.GetClass());
+	if (!Pool || Pool->FreeWidgets.Num() >= UEasyUserInterfaceSettings::Get()->NotificationPoolCapacity)
+	{
+		NotificationWidget.OwningPoolManager.Reset();
+		return;
+	}
+
+	NotificationWidget.ResetForPool();
+	Pool->FreeWidgets.Add(&NotificationWidget);
+}
+
+int32 UEasyUserInterfaceManager::GetNumPooledNotifications() const
+{
+	int32 NumPooledNotifications = 0;
+	for (const TPair<TObjectPtr<UClass>, FEasyNotificationWidgetPool>& PoolPair : NotificationPools)
+	{
+		NumPooledNotifications += PoolPair.Value.FreeWidgets.Num();
+	}
+	return NumPooledNotifications;
+}
+
+void UEasyUserInterfaceManager::PrewarmNotificationPools()
+{
+	const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+	if (!Settings->bPoolNotificationWidgets || Settings->NotificationPoolPrewarmCounts.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> PrewarmClasses;
+	for (const TPair<TSoftClassPtr<UEasyNotificationWidget>, int32>& PrewarmPair : Settings->NotificationPoolPrewarmCounts)
+	{
+		PrewarmClasses.AddUnique(PrewarmPair.Key.ToSoftObjectPath());
+	}
+
+	NotificationPoolPrewarmHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(PrewarmClasses, FStreamableDelegate::CreateWeakLambda(this, [this]()
+	{
+		const UEasyUserInterfaceSettings* PoolSettings = UEasyUserInterfaceSettings::Get();
+		APlayerController* PlayerController = GetLocalPlayer()->GetPlayerController(GetWorld());
+		LLM_SCOPE_BYTAG(EasyUI_Notifications);
+		for (const TPair<TSoftClassPtr<UEasyNotificationWidget>, int32>& PrewarmPair : PoolSettings->NotificationPoolPrewarmCounts)
+		{
+			UClass* NotificationClass = PrewarmPair.Key.Get();
+			if (!NotificationClass)
+			{
+				UE_LOG(LogEasyUserInterfaceManagement, Warning, TEXT("Failed to load the notification class %s to pre-warm its pool."), *PrewarmPair.Key.ToString());
+				continue;
+			}
+
+			FEasyNotificationWidgetPool& Pool = NotificationPools.FindOrAdd(NotificationClass);
+			const int32 NumWidgets = FMath::Min(PrewarmPair.Value, PoolSettings->NotificationPoolCapacity);
+			while (Pool.FreeWidgets.Num() < NumWidgets)
+			{
+				UEasyNotificationWidget* NotificationWidget = CreateWidget<UEasyNotificationWidget>(PlayerController, NotificationClass);
+				if (!NotificationWidget)
+				{
+					break;
+				}
+				NotificationWidget->OwningPoolManager = this;
+				NotificationWidget->bIsInPool = true;
+				Pool.FreeWidgets.Add(NotificationWidget);
+			}
+		}
+		NotificationPoolPrewarmHandle.Reset();
+	}));
+}
+
+void UEasyUserInterfaceManager::RecordBootPreloadNotification(const TSoftClassPtr<UEasyNotificationWidget>& NotificationWidgetClass, const FEasyNotificationWidgetInfo& NotificationInfo)
+{
+	if (BootPreloader.IsRecording())
+	{
+		BootPreloader.RecordAsset(NotificationWidgetClass.ToSoftObjectPath());
+		BootPreloader.RecordAsset(NotificationInfo.NotificationIconWidgetClass.ToSoftObjectPath());
+		BootPreloader.RecordAsset(NotificationInfo.NotificationIcon.ToSoftObjectPath());
+	}
+}
+
+UEasyNotificationWidget* UEasyUserInterfaceManager::SpawnNotificationWidget(const FGameplayTag& LayerTag, UClass* LoadedClass,
+	const FEasyNotificationWidgetInfo& NotificationInfo, TConstArrayView<FOnNotificationAddedToPanel> OnNotificationAdded, bool* bOutCreated)
+{
+	// An identical notification shown a moment ago is extended instead of stacking a copy
+	if (UEasyNotificationWidget* CoalescedWidget = NotificationThrottle.FindCoalescableNotification(LayerTag, LoadedClass, NotificationInfo))
+	{
+		CoalescedWidget->CoalesceNotification();
+		NotificationThrottle.RecordCoalesced();
+		for (const FOnNotificationAddedToPanel& AddedDelegate : OnNotificationAdded)
+		{
+			AddedDelegate.ExecuteIfBound(LayerTag, CoalescedWidget);
+		}
+		return CoalescedWidget;
+	}
+	if (!NotificationThrottle.TryAdmitNotification(LayerTag, LoadedClass, NotificationInfo, OnNotificationAdded))
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Verbose, TEXT("Notification of class %s rate limited on layer %s, it is counted in the layer summary."),
+			*GetNameSafe(LoadedClass), *LayerTag.ToString());
+		return nullptr;
+	}
+	if (NotificationBacklog.ShouldQueueNotification(LayerTag))
+	{
+		NotificationBacklog.EnqueueNotification(LayerTag, LoadedClass, NotificationInfo, OnNotificationAdded);
+		return nullptr;
+	}
+
+	UEasyNotificationWidget* NotificationWidget = CreateNotificationWidget(LayerTag, LoadedClass, NotificationInfo, OnNotificationAdded);
+	if (bOutCreated)
+	{
+		*bOutCreated = NotificationWidget != nullptr;
+	}
+	return NotificationWidget;
+}
+
+UEasyNotificationWidget* UEasyUserInterfaceManager::CreateNotificationWidget(const FGameplayTag& LayerTag, UClass* LoadedClass,
+	const FEasyNotificationWidgetInfo& NotificationInfo, TConstArrayView<FOnNotificationAddedToPanel> OnNotificationAdded)
+{
+	UEasyNotificationWidget* NotificationWidget;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_EasyUI_AddNotification_Construct);
+		LLM_SCOPE_BYTAG(EasyUI_Notifications);
+		FEasyUserInterfaceLatencyScope LatencyScope(EEasyUserInterfaceOperation::AddNotification, EEasyUserInterfaceLatencyPhase::Construct);
+		FEasyUserInterfaceSyncLoadScope SyncLoadScope(LoadedClass, TEXT("AddNotification"));
+		NotificationWidget = AcquireNotificationWidget(LoadedClass);
+	}
+	if (!NotificationWidget)
+	{
+		return nullptr;
+	}
+
+	bool bIsInPanel;
+	{
+		SCOPE_CYCLE_COUNTER(STAT_EasyUI_AddNotification_Activate);
+		LLM_SCOPE_BYTAG(EasyUI_Notifications);
+		FEasyUserInterfaceLatencyScope LatencyScope(EEasyUserInterfaceOperation::AddNotification, EEasyUserInterfaceLatencyPhase::Activate);
+		FEasyUserInterfaceSyncLoadScope SyncLoadScope(LoadedClass, TEXT("AddNotification"));
+		bIsInPanel = RootWidget->AddNotificationWidgetToPanel(LayerTag, NotificationWidget, NotificationInfo);
+	}
+	if (!bIsInPanel)
+	{
+		// Never displayed, so it goes straight back to its pool and nobody is told it was added
+		if (NotificationWidget->OwningPoolManager.Get() == this)
+		{
+			ReleaseNotificationWidget(*NotificationWidget);
+		}
+		return nullptr;
+	}
+
+	if (FEasyUserInterfaceLeakTracker::IsTracking())
+	{
+		FEasyUserInterfaceLeakTracker::TrackWidget(*NotificationWidget, RootWidget);
+	}
+	for (const FOnNotificationAddedToPanel& AddedDelegate : OnNotificationAdded)
+	{
+		AddedDelegate.ExecuteIfBound(LayerTag, NotificationWidget);
+	}
+	return NotificationWidget;
+}
+
 UEasyPromptQuestion* UEasyUserInterfaceManager::PushQuestionPromptToLayer(
 	TSubclassOf<UEasyPromptQuestion> PromptWidgetClass, FGameplayTag StackLayer,
 	const FPromptQuestionBodyInfo& InQuestionBodyInfo, FPromtResultEventDelegate OnPromptResult)
@@ -151,18 +662,46 @@ UEasyPromptQuestion* UEasyUserInterfaceManager::PushQuestionPromptToLayer(
 		{
 			if (IsValid(PromptWidgetClass))
 			{
-				UEasyPromptQuestion* PromptWidget = CreateWidget<UEasyPromptQuestion>(GetLocalPlayer()->GetPlayerController(GetWorld()), PromptWidgetClass);
+				if (FEasyUserInterfaceReplay::IsRecording())
+				{
+					FEasyUserInterfaceReplay::RecordPushPrompt(GetLocalPlayer(), StackLayer, PromptWidgetClass, InQuestionBodyInfo);
+				}
+
+				// The prompt class is already loaded, so there is no load wait to record
+				FEasyUserInterfaceStats::RecordRequest(EEasyUserInterfaceOperation::PushPrompt);
+				BootPreloader.RecordAsset(FSoftObjectPath(PromptWidgetClass.Get()));
+				const double RequestTime = FPlatformTime::Seconds();
+
+				UEasyPromptQuestion* PromptWidget;
+				{
+					SCOPE_CYCLE_COUNTER(STAT_EasyUI_PushPrompt_Construct);
+					LLM_SCOPE_BYTAG(EasyUI_Prompts);
+					FEasyUserInterfaceLatencyScope LatencyScope(EEasyUserInterfaceOperation::PushPrompt, EEasyUserInterfaceLatencyPhase::Construct);
+					FEasyUserInterfaceSyncLoadScope SyncLoadScope(PromptWidgetClass, TEXT("PushQuestionPrompt"));
+					PromptWidget = CreateWidget<UEasyPromptQuestion>(GetLocalPlayer()->GetPlayerController(GetWorld()), PromptWidgetClass);
+				}
 				if (!PromptWidget)
 				{
 					UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("Failed to create PromptWidget of class %s"), *PromptWidgetClass->GetName());
 					return nullptr;
 				}
+				if (FEasyUserInterfaceLeakTracker::IsTracking())
+				{
+					FEasyUserInterfaceLeakTracker::TrackWidget(*PromptWidget, CurrentRootWidget);
+				}
 				PromptWidget->QuestionBodyInfo = InQuestionBodyInfo;
 				PromptWidget->RefreshWidget();
 
 				PromptWidget->OnPromptQuestionResult.Add(OnPromptResult);
 
-				Stack->AddWidgetInstance(*PromptWidget);
+				{
+					SCOPE_CYCLE_COUNTER(STAT_EasyUI_PushPrompt_Activate);
+					LLM_SCOPE_BYTAG(EasyUI_Prompts);
+					FEasyUserInterfaceLatencyScope LatencyScope(EEasyUserInterfaceOperation::PushPrompt, EEasyUserInterfaceLatencyPhase::Activate);
+					FEasyUserInterfaceSyncLoadScope SyncLoadScope(PromptWidgetClass, TEXT("PushQuestionPrompt"));
+					Stack->AddWidgetInstance(*PromptWidget);
+				}
+				FEasyUserInterfaceStats::RecordLatency(EEasyUserInterfaceOperation::PushPrompt, EEasyUserInterfaceLatencyPhase::Total, FPlatformTime::Seconds() - RequestTime);
 				
 				return PromptWidget;
 			}
@@ -192,6 +731,11 @@ void UEasyUserInterfaceManager::SetCommonInputMode(APlayerController* PlayerCont
 		return;
 	}
 
+	if (FEasyUserInterfaceReplay::IsRecording())
+	{
+		FEasyUserInterfaceReplay::RecordInputModeChanged(LocalPlayer, CommonInputMode, MouseCaptureMode, bHideMouse);
+	}
+
 	FUIInputConfig InputConfig;
 	if (CommonInputMode == ECommonInputMode::Game)
 	{
@@ -235,3 +779,63 @@ ECommonInputMode UEasyUserInterfaceManager::GetCurrentCommonInputMode(const APla
 
 	return ActionRouter->GetActiveInputMode();
 }
+
+void UEasyUserInterfaceManager::RefreshLocalizedText()
+{
+	PendingLocalizedTextRefresh.Reset();
+	NextLocalizedTextRefreshIndex = 0;
+
+	// Collect this player's live widgets, class defaults and archetypes are excluded
+	const ULocalPlayer* LocalPlayer = GetLocalPlayer();
+	ForEachObjectOfClass(UUserWidget::StaticClass(), [this, LocalPlayer](UObject* Object)
+	{
+		UUserWidget* Widget = static_cast<UUserWidget*>(Object);
+		if (Widget->GetOwningLocalPlayer() == LocalPlayer && Widget->Implements<UEasyLocalizedWidgetInterface>())
+		{
+			PendingLocalizedTextRefresh.Add(Widget);
+		}
+	}, true, RF_ClassDefaultObject | RF_ArchetypeObject, EInternalObjectFlags::Garbage);
+
+	if (PendingLocalizedTextRefresh.IsEmpty())
+	{
+		return;
+	}
+
+	if (!LocalizedTextRefreshTickerHandle.IsValid())
+	{
+		LocalizedTextRefreshTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UEasyUserInterfaceManager::TickLocalizedTextRefresh));
+	}
+}
+
+void UEasyUserInterfaceManager::HandleCultureChanged()
+{
+	if (UEasyUserInterfaceSettings::Get()->bRefreshLocalizedTextOnCultureChange)
+	{
+		RefreshLocalizedText();
+	}
+}
+
+bool UEasyUserInterfaceManager::TickLocalizedTextRefresh(float DeltaTime)
+{
+	int32 RemainingBudget = FMath::Max(1, UEasyUserInterfaceSettings::Get()->LocalizedTextRefreshWidgetsPerFrame);
+	while (RemainingBudget > 0 && PendingLocalizedTextRefresh.IsValidIndex(NextLocalizedTextRefreshIndex))
+	{
+		// Widgets destroyed since the culture change are skipped without consuming the budget
+		if (UUserWidget* Widget = PendingLocalizedTextRefresh[NextLocalizedTextRefreshIndex++].Get())
+		{
+			IEasyLocalizedWidgetInterface::Execute_RefreshLocalizedText(Widget);
+			--RemainingBudget;
+		}
+	}
+
+	if (PendingLocalizedTextRefresh.IsValidIndex(NextLocalizedTextRefreshIndex))
+	{
+		return true;
+	}
+
+	PendingLocalizedTextRefresh.Reset();
+	NextLocalizedTextRefreshIndex = 0;
+	LocalizedTextRefreshTickerHandle.Reset();
+	return false;
+}
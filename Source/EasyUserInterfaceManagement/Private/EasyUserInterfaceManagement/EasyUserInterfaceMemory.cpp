@@ -0,0 +1,156 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagement/EasyUserInterfaceMemory.h"
+
+#include "EasyUserInterfaceManagement.h"
+#include "Blueprint/UserWidget.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/Texture.h"
+#include "Engine/World.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSettings.h"
+#include "ExtensionCommonUI/EasyUserInterfaceRootWidget.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Serialization/ArchiveCountMem.h"
+#include "UObject/UObjectHash.h"
+
+LLM_DEFINE_TAG(EasyUI);
+LLM_DEFINE_TAG(EasyUI_Widgets, TEXT("Widgets"), TEXT("EasyUI"));
+LLM_DEFINE_TAG(EasyUI_Notifications, TEXT("Notifications"), TEXT("EasyUI"));
+LLM_DEFINE_TAG(EasyUI_Prompts, TEXT("Prompts"), TEXT("EasyUI"));
+
+namespace EasyUserInterfaceMemory
+{
+	constexpr double BytesPerMB = 1024.0 * 1024.0;
+
+	void LogReport(const UEasyUserInterfaceManager& Manager, FOutputDevice& Ar)
+	{
+		const ULocalPlayer* LocalPlayer = Manager.GetLocalPlayer();
+		Ar.Logf(TEXT("Easy UI memory of local player %d:"), LocalPlayer ? LocalPlayer->GetLocalPlayerIndex() : INDEX_NONE);
+		Ar.Logf(TEXT("%-40s %8s %8s %10s %10s %8s %10s"), TEXT("Layer"), TEXT("Widgets"), TEXT("Objects"), TEXT("ObjectsMB"), TEXT("TexturesMB"), TEXT("Textures"), TEXT("BudgetMB"));
+
+		int32 NumOverBudget = 0;
+		for (const FEasyUserInterfaceLayerMemoryReport& Report : Manager.GetLayerMemoryReport())
+		{
+			const FString Budget = Report.BudgetBytes > 0 ? FString::Printf(TEXT("%.2f"), Report.BudgetBytes / BytesPerMB) : FString(TEXT("-"));
+			Ar.Logf(TEXT("%-40s %8d %8d %10.2f %10.2f %8d %10s%s"),
+				*Report.LayerTag.ToString(), Report.NumWidgets, Report.NumObjects, Report.ObjectBytes / BytesPerMB, Report.TextureBytes / BytesPerMB,
+				Report.NumTextures, *Budget, Report.bIsOverBudget ? TEXT(" OVER BUDGET") : TEXT(""));
+
+			if (Report.ResidentClasses.Num() > 0)
+			{
+				Ar.Logf(TEXT("    Classes: %s"), *FString::JoinBy(Report.ResidentClasses, TEXT(", "), [](const FName& ClassName) { return ClassName.ToString(); }));
+			}
+			NumOverBudget += Report.bIsOverBudget ? 1 : 0;
+		}
+
+		if (NumOverBudget > 0)
+		{
+			UE_LOG(LogEasyUserInterfaceManagement, Warning, TEXT("%d User Interface layer(s) over their memory budget."), NumOverBudget);
+		}
+	}
+
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleCommandWithWorldArgsAndOutputDevice MemReportCommand(
+		TEXT("EasyUI.MemReport"),
+		TEXT("Logs the widget count, UObject count, referenced texture memory and resident classes of every User Interface layer of each local player."),
+		FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+		{
+			if (!World)
+			{
+				return;
+			}
+
+			for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+			{
+				const ULocalPlayer* LocalPlayer = Iterator->IsValid() ? (*Iterator)->GetLocalPlayer() : nullptr;
+				const UEasyUserInterfaceManager* Manager = LocalPlayer ? LocalPlayer->GetSubsystem<UEasyUserInterfaceManager>() : nullptr;
+				if (Manager && Manager->IsRootWidgetReady())
+				{
+					LogReport(*Manager, Ar);
+				}
+			}
+		}));
+#endif
+}
+
+FEasyUserInterfaceLayerMemoryReport FEasyUserInterfaceMemory::BuildLayerReport(const UEasyUserInterfaceRootWidget& RootWidget, const FGameplayTag& LayerTag)
+{
+	FEasyUserInterfaceLayerMemoryReport Report;
+	Report.LayerTag = LayerTag;
+
+	TArray<UUserWidget*> LayerWidgets;
+	RootWidget.GetLayerWidgets(LayerTag, LayerWidgets);
+	Report.NumWidgets = LayerWidgets.Num();
+
+	// Widgets own their widget tree and everything in it, nested user widgets included
+	TArray<UObject*> LayerObjects;
+	for (UUserWidget* Widget : LayerWidgets)
+	{
+		LayerObjects.Add(Widget);
+		GetObjectsWithOuter(Widget, LayerObjects, true);
+	}
+	Report.NumObjects = LayerObjects.Num();
+
+	TSet<UClass*> ResidentClasses;
+	TSet<const UTexture*> Textures;
+	TArray<UObject*> References;
+	for (UObject* Object : LayerObjects)
+	{
+		const FArchiveCountMem CountMem(Object);
+		Report.ObjectBytes += CountMem.GetMax() + Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+
+		if (Object->IsA<UUserWidget>())
+		{
+			ResidentClasses.Add(Object->GetClass());
+		}
+
+		// Brushes and styles reference their textures directly
+		References.Reset();
+		FReferenceFinder ReferenceFinder(References, nullptr, false, true, false, false);
+		ReferenceFinder.FindReferences(Object);
+		for (const UObject* Reference : References)
+		{
+			if (const UTexture* Texture = Cast<UTexture>(Reference))
+			{
+				Textures.Add(Texture);
+			}
+		}
+	}
+
+	for (const UTexture* Texture : Textures)
+	{
+		Report.TextureBytes += Texture->CalcTextureMemorySizeEnum(TMC_ResidentMips);
+	}
+	Report.NumTextures = Textures.Num();
+
+	for (const UClass* Class : ResidentClasses)
+	{
+		Report.ResidentClasses.Add(Class->GetFName());
+	}
+	Report.ResidentClasses.Sort(FNameLexicalLess());
+
+	if (const float* BudgetMB = UEasyUserInterfaceSettings::Get()->LayerMemoryBudgetsMB.Find(LayerTag))
+	{
+		Report.BudgetBytes = static_cast<int64>(*BudgetMB * EasyUserInterfaceMemory::BytesPerMB);
+		Report.bIsOverBudget = Report.BudgetBytes > 0 && Report.GetTotalBytes() > Report.BudgetBytes;
+	}
+
+	return Report;
+}
+
+TArray<FEasyUserInterfaceLayerMemoryReport> FEasyUserInterfaceMemory::BuildReport(const UEasyUserInterfaceRootWidget& RootWidget)
+{
+	TArray<FEasyUserInterfaceLayerMemoryReport> Reports;
+	for (const FGameplayTag& LayerTag : RootWidget.GetRegisteredStackLayers())
+	{
+		Reports.Add(BuildLayerReport(RootWidget, LayerTag));
+	}
+	for (const FGameplayTag& LayerTag : RootWidget.GetRegisteredNotificationLayers())
+	{
+		Reports.Add(BuildLayerReport(RootWidget, LayerTag));
+	}
+	return Reports;
+}
@@ -0,0 +1,32 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagement/EasyUserInterfaceNavigationGraph.h"
+
+#include "Blueprint/UserWidget.h"
+
+void UEasyUserInterfaceNavigationGraph::GetReachableWidgetClasses(const UClass* WidgetClass, TArray<FSoftObjectPath>& OutWidgetClasses) const
+{
+	if (!WidgetClass)
+	{
+		return;
+	}
+
+	if (const FEasyUserInterfaceNavigationNode* Node = Nodes.Find(TSoftClassPtr<UUserWidget>(FSoftObjectPath(WidgetClass))))
+	{
+		for (const FEasyUserInterfaceNavigationEdge& Edge : Node->Edges)
+		{
+			OutWidgetClasses.AddUnique(Edge.WidgetClass.ToSoftObjectPath());
+		}
+	}
+}
+
+int32 UEasyUserInterfaceNavigationGraph::GetNumEdges() const
+{
+	int32 NumEdges = 0;
+	for (const TPair<TSoftClassPtr<UUserWidget>, FEasyUserInterfaceNavigationNode>& NodePair : Nodes)
+	{
+		NumEdges += NodePair.Value.Edges.Num();
+	}
+	return NumEdges;
+}
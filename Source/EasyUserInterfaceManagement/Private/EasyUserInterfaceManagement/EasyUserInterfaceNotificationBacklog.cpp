@@ -0,0 +1,201 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagement/EasyUserInterfaceNotificationBacklog.h"
+
+#include "EasyUserInterfaceManagement.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSettings.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceStats.h"
+#include "ExtensionCommonUI/EasyUserInterfaceRootWidget.h"
+
+void FEasyUserInterfaceNotificationBacklog::Initialize(UEasyUserInterfaceManager& InManager)
+{
+	Manager = &InManager;
+}
+
+void FEasyUserInterfaceNotificationBacklog::Deinitialize()
+{
+	if (PromotionTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PromotionTickerHandle);
+		PromotionTickerHandle.Reset();
+	}
+	RemoveQueued(GetNumQueued());
+	Queues.Empty();
+}
+
+bool FEasyUserInterfaceNotificationBacklog::ShouldQueueNotification(const FGameplayTag& LayerTag) const
+{
+	const int32* MaxVisibleNotifications = UEasyUserInterfaceSettings::Get()->LayerMaxVisibleNotifications.Find(LayerTag);
+	const UEasyUserInterfaceManager* ManagerPtr = Manager.Get();
+	if (!MaxVisibleNotifications || !ManagerPtr)
+	{
+		return false;
+	}
+
+	// Waiting notifications go first, even if a slot was freed this frame
+	return GetNumQueued(LayerTag) > 0 || ManagerPtr->GetActiveNotificationCount(LayerTag) >= *MaxVisibleNotifications;
+}
+
+void FEasyUserInterfaceNotificationBacklog::EnqueueNotification(const FGameplayTag& LayerTag, UClass* NotificationClass,
+	const FEasyNotificationWidgetInfo& NotificationInfo, TConstArrayView<FOnNotificationAddedToPanel> OnNotificationAdded)
+{
+	const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+	TArray<FQueuedNotification>& Queue = Queues.FindOrAdd(LayerTag);
+	RemoveExpired(Queue, FPlatformTime::Seconds());
+
+	FQueuedNotification QueuedNotification;
+	QueuedNotification.NotificationClass.Reset(NotificationClass);
+	QueuedNotification.NotificationInfo = NotificationInfo;
+	for (const FOnNotificationAddedToPanel& AddedDelegate : OnNotificationAdded)
+	{
+		if (AddedDelegate.IsBound())
+		{
+			QueuedNotification.OnNotificationAdded.Add(AddedDelegate);
+		}
+	}
+	QueuedNotification.QueuedTime = FPlatformTime::Seconds();
+	QueuedNotification.Sequence = NextSequence++;
+
+	if (Queue.Num() >= FMath::Max(Settings->NotificationBacklogCapacity, 1))
+	{
+		// Drop the entry that would be shown last, which may be the new one
+		int32 LastIndex = 0;
+		for (int32 Index = 1; Index < Queue.Num(); ++Index)
+		{
+			if (IsShownBefore(Queue[LastIndex], Queue[Index]))
+			{
+				LastIndex = Index;
+			}
+		}
+
+		++NumEvicted;
+		if (!IsShownBefore(QueuedNotification, Queue[LastIndex]))
+		{
+			UE_LOG(LogEasyUserInterfaceManagement, Log, TEXT("Notification backlog of layer %s is full, dropping the new notification, its added delegate is not called."), *LayerTag.ToString());
+			return;
+		}
+		UE_LOG(LogEasyUserInterfaceManagement, Log, TEXT("Notification backlog of layer %s is full, dropping its lowest priority notification, its added delegate is not called."), *LayerTag.ToString());
+		Queue.HeapRemoveAt(LastIndex, &FEasyUserInterfaceNotificationBacklog::IsShownBefore);
+		RemoveQueued(1);
+	}
+
+	Queue.HeapPush(MoveTemp(QueuedNotification), &FEasyUserInterfaceNotificationBacklog::IsShownBefore);
+	INC_DWORD_STAT(STAT_EasyUI_QueuedNotifications);
+
+	// A slot may have been freed without the previous promotion filling it
+	if (const UEasyUserInterfaceManager* ManagerPtr = Manager.Get())
+	{
+		HandleNotificationCountChanged(LayerTag, ManagerPtr->GetActiveNotificationCount(LayerTag));
+	}
+}
+
+void FEasyUserInterfaceNotificationBacklog::HandleNotificationCountChanged(const FGameplayTag& LayerTag, int32 NotificationCount)
+{
+	const int32* MaxVisibleNotifications = UEasyUserInterfaceSettings::Get()->LayerMaxVisibleNotifications.Find(LayerTag);
+	const bool bHasFreeSlot = !MaxVisibleNotifications || NotificationCount < *MaxVisibleNotifications;
+
+	// Removals are reported while the panel releases the notification, the next one is shown once it is done
+	if (bHasFreeSlot && GetNumQueued(LayerTag) > 0 && !PromotionTickerHandle.IsValid())
+	{
+		PromotionTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FEasyUserInterfaceNotificationBacklog::TickPromotions));
+	}
+}
+
+int32 FEasyUserInterfaceNotificationBacklog::GetNumQueued(const FGameplayTag& LayerTag) const
+{
+	const TArray<FQueuedNotification>* Queue = Queues.Find(LayerTag);
+	return Queue ? Queue->Num() : 0;
+}
+
+int32 FEasyUserInterfaceNotificationBacklog::GetNumQueued() const
+{
+	int32 NumQueued = 0;
+	for (const TPair<FGameplayTag, TArray<FQueuedNotification>>& QueuePair : Queues)
+	{
+		NumQueued += QueuePair.Value.Num();
+	}
+	return NumQueued;
+}
+
+bool FEasyUserInterfaceNotificationBacklog::IsShownBefore(const FQueuedNotification& Notification, const FQueuedNotification& OtherNotification)
+{
+	if (Notification.NotificationInfo.NotificationPriority != OtherNotification.NotificationInfo.NotificationPriority)
+	{
+		return Notification.NotificationInfo.NotificationPriority > OtherNotification.NotificationInfo.NotificationPriority;
+	}
+	return Notification.Sequence < OtherNotification.Sequence;
+}
+
+void FEasyUserInterfaceNotificationBacklog::RemoveExpired(TArray<FQueuedNotification>& Queue, double Now)
+{
+	const float MaxWait = UEasyUserInterfaceSettings::Get()->NotificationBacklogMaxWait;
+	if (MaxWait <= 0.0f)
+	{
+		return;
+	}
+
+	const int32 NumRemoved = Queue.RemoveAll([Now, MaxWait](const FQueuedNotification& QueuedNotification)
+	{
+		return Now - QueuedNotification.QueuedTime > MaxWait;
+	});
+	if (NumRemoved > 0)
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Log, TEXT("%d notification(s) waited longer than %.1fs in the notification backlog and were dropped, their added delegates are not called."), NumRemoved, MaxWait);
+		NumExpired += NumRemoved;
+		RemoveQueued(NumRemoved);
+		Queue.Heapify(&FEasyUserInterfaceNotificationBacklog::IsShownBefore);
+	}
+}
+
+void FEasyUserInterfaceNotificationBacklog::RemoveQueued(int32 Count)
+{
+	DEC_DWORD_STAT_BY(STAT_EasyUI_QueuedNotifications, Count);
+}
+
+bool FEasyUserInterfaceNotificationBacklog::TickPromotions(float DeltaTime)
+{
+	PromotionTickerHandle.Reset();
+
+	UEasyUserInterfaceManager* ManagerPtr = Manager.Get();
+	if (!ManagerPtr || !ManagerPtr->IsRootWidgetReady())
+	{
+		return false;
+	}
+
+	const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+	const double Now = FPlatformTime::Seconds();
+	// The added callbacks may queue new notifications, so the queues are looked up again after each one
+	TArray<FGameplayTag> LayerTags;
+	Queues.GenerateKeyArray(LayerTags);
+	for (const FGameplayTag& LayerTag : LayerTags)
+	{
+		// Nothing can be shown on an unregistered panel, the layer starts over once it is registered again
+		if (!ManagerPtr->RootWidget->GetNotificationPanel(LayerTag))
+		{
+			RemoveQueued(GetNumQueued(LayerTag));
+			Queues.Remove(LayerTag);
+			continue;
+		}
+		RemoveExpired(Queues[LayerTag], Now);
+
+		const int32* MaxVisibleNotifications = Settings->LayerMaxVisibleNotifications.Find(LayerTag);
+		int32 NumFreeSlots = MaxVisibleNotifications ? *MaxVisibleNotifications - ManagerPtr->GetActiveNotificationCount(LayerTag) : GetNumQueued(LayerTag);
+		while (NumFreeSlots > 0 && GetNumQueued(LayerTag) > 0)
+		{
+			FQueuedNotification QueuedNotification;
+			Queues[LayerTag].HeapPop(QueuedNotification, &FEasyUserInterfaceNotificationBacklog::IsShownBefore);
+			RemoveQueued(1);
+			--NumFreeSlots;
+
+			ManagerPtr->CreateNotificationWidget(LayerTag, QueuedNotification.NotificationClass.Get(), QueuedNotification.NotificationInfo, QueuedNotification.OnNotificationAdded);
+		}
+
+		if (GetNumQueued(LayerTag) == 0)
+		{
+			Queues.Remove(LayerTag);
+		}
+	}
+	return false;
+}
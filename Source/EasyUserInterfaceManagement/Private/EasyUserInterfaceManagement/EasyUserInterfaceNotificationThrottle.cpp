@@ -0,0 +1,207 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagement/EasyUserInterfaceNotificationThrottle.h"
+
+#include "EasyUserInterfaceManagement.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSettings.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceStats.h"
+#include "Engine/World.h"
+#include "ExtensionCommonUI/EasyUserInterfaceRootWidget.h"
+
+namespace EasyUserInterfaceNotificationThrottle
+{
+	/** Period the layers waiting to show a summary are checked at */
+	constexpr float SummaryTickPeriod = 0.1f;
+
+	bool IsSameNotification(const FEasyNotificationWidgetInfo& Info, const FEasyNotificationWidgetInfo& OtherInfo)
+	{
+		// Formatted texts are rebuilt at every call, only their display strings can match
+		return Info.NotificationHeader.ToString().Equals(OtherInfo.NotificationHeader.ToString(), ESearchCase::CaseSensitive)
+			&& Info.NotificationBody.ToString().Equals(OtherInfo.NotificationBody.ToString(), ESearchCase::CaseSensitive);
+	}
+}
+
+void FEasyUserInterfaceNotificationThrottle::Initialize(UEasyUserInterfaceManager& InManager)
+{
+	Manager = &InManager;
+}
+
+void FEasyUserInterfaceNotificationThrottle::Deinitialize()
+{
+	if (SummaryTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(SummaryTickerHandle);
+		SummaryTickerHandle.Reset();
+	}
+	Buckets.Empty();
+}
+
+UEasyNotificationWidget* FEasyUserInterfaceNotificationThrottle::FindCoalescableNotification(const FGameplayTag& LayerTag, const UClass* NotificationClass,
+	const FEasyNotificationWidgetInfo& NotificationInfo) const
+{
+	const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+	const UEasyUserInterfaceManager* ManagerPtr = Manager.Get();
+	if (!Settings->bCoalesceNotifications || !ManagerPtr || !ManagerPtr->IsRootWidgetReady())
+	{
+		return nullptr;
+	}
+
+	TArray<UUserWidget*> LayerWidgets;
+	ManagerPtr->RootWidget->GetLayerWidgets(LayerTag, LayerWidgets);
+	// The most recent notifications are the most likely to match
+	for (int32 Index = LayerWidgets.Num() - 1; Index >= 0; --Index)
+	{
+		UEasyNotificationWidget* NotificationWidget = Cast<UEasyNotificationWidget>(LayerWidgets[Index]);
+		if (!NotificationWidget || NotificationWidget->GetClass() != NotificationClass)
+		{
+			continue;
+		}
+
+		const double TimeSinceShown = GetTime() - NotificationWidget->GetNotificationStartTime();
+		if (TimeSinceShown <= Settings->NotificationCoalesceWindow && EasyUserInterfaceNotificationThrottle::IsSameNotification(NotificationWidget->NotificationInfo, NotificationInfo))
+		{
+			return NotificationWidget;
+		}
+	}
+	return nullptr;
+}
+
+bool FEasyUserInterfaceNotificationThrottle::TryAdmitNotification(const FGameplayTag& LayerTag, UClass* NotificationClass, const FEasyNotificationWidgetInfo& NotificationInfo,
+	TConstArrayView<FOnNotificationAddedToPanel> OnNotificationAdded)
+{
+	FLayerBucket* Bucket = Buckets.Find(LayerTag);
+	if (!Bucket)
+	{
+		if (!UEasyUserInterfaceSettings::Get()->LayerNotificationRateLimits.Contains(LayerTag))
+		{
+			return true;
+		}
+
+		// A new bucket starts full
+		Bucket = &Buckets.Add(LayerTag);
+		Bucket->Tokens = UEasyUserInterfaceSettings::Get()->LayerNotificationRateLimits[LayerTag].Burst;
+		Bucket->LastRefillTime = GetTime();
+	}
+
+	if (!RefillBucket(LayerTag, *Bucket))
+	{
+		return true;
+	}
+
+	// Once the layer overflows, the next notifications wait for the summary, so they are not shown out of order
+	if (Bucket->Tokens >= 1.0 && (Bucket->NumOverflowed == 0 || bIsShowingSummary))
+	{
+		Bucket->Tokens -= 1.0;
+		return true;
+	}
+
+	++Bucket->NumOverflowed;
+	Bucket->OverflowClass = NotificationClass;
+	Bucket->OverflowInfo = NotificationInfo;
+	for (const FOnNotificationAddedToPanel& AddedDelegate : OnNotificationAdded)
+	{
+		if (AddedDelegate.IsBound())
+		{
+			Bucket->OverflowDelegates.Add(AddedDelegate);
+		}
+	}
+	++NumRateLimited;
+	INC_DWORD_STAT(STAT_EasyUI_RateLimitedNotifications);
+
+	if (!SummaryTickerHandle.IsValid())
+	{
+		SummaryTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FEasyUserInterfaceNotificationThrottle::TickOverflowSummaries),
+			EasyUserInterfaceNotificationThrottle::SummaryTickPeriod);
+	}
+	return false;
+}
+
+void FEasyUserInterfaceNotificationThrottle::RecordCoalesced()
+{
+	++NumCoalesced;
+	INC_DWORD_STAT(STAT_EasyUI_CoalescedNotifications);
+}
+
+bool FEasyUserInterfaceNotificationThrottle::RefillBucket(const FGameplayTag& LayerTag, FLayerBucket& Bucket) const
+{
+	// The limit may have been removed while playing in editor
+	const FEasyNotificationRateLimit* RateLimit = UEasyUserInterfaceSettings::Get()->LayerNotificationRateLimits.Find(LayerTag);
+	if (!RateLimit)
+	{
+		return false;
+	}
+
+	const double Now = GetTime();
+	Bucket.Tokens = FMath::Min<double>(Bucket.Tokens + (Now - Bucket.LastRefillTime) * RateLimit->NotificationsPerSecond, FMath::Max(RateLimit->Burst, 1));
+	Bucket.LastRefillTime = Now;
+	return true;
+}
+
+double FEasyUserInterfaceNotificationThrottle::GetTime() const
+{
+	const UEasyUserInterfaceManager* ManagerPtr = Manager.Get();
+	const UWorld* World = ManagerPtr ? ManagerPtr->GetWorld() : nullptr;
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+bool FEasyUserInterfaceNotificationThrottle::TickOverflowSummaries(float DeltaTime)
+{
+	UEasyUserInterfaceManager* ManagerPtr = Manager.Get();
+	if (!ManagerPtr || !ManagerPtr->IsRootWidgetReady())
+	{
+		SummaryTickerHandle.Reset();
+		return false;
+	}
+
+	bool bHasPendingSummary = false;
+	// The added delegates of a summary may add notifications, so the buckets are looked up again after each one
+	TArray<FGameplayTag> LayerTags;
+	Buckets.GenerateKeyArray(LayerTags);
+	for (const FGameplayTag& LayerTag : LayerTags)
+	{
+		FLayerBucket* BucketPtr = Buckets.Find(LayerTag);
+		if (!BucketPtr || BucketPtr->NumOverflowed == 0)
+		{
+			continue;
+		}
+
+		FLayerBucket& Bucket = *BucketPtr;
+		UClass* OverflowClass = Bucket.OverflowClass.Get();
+		const bool bHasRateLimit = RefillBucket(LayerTag, Bucket);
+		if (OverflowClass && bHasRateLimit && Bucket.Tokens < 1.0)
+		{
+			bHasPendingSummary = true;
+			continue;
+		}
+
+		// A single dropped notification is shown as is
+		FEasyNotificationWidgetInfo SummaryInfo = MoveTemp(Bucket.OverflowInfo);
+		if (Bucket.NumOverflowed > 1)
+		{
+			FFormatNamedArguments Arguments;
+			Arguments.Add(TEXT("Count"), Bucket.NumOverflowed);
+			SummaryInfo.NotificationHeader = FText::Format(UEasyUserInterfaceSettings::Get()->NotificationOverflowSummaryFormat, Arguments);
+			SummaryInfo.NotificationBody = FText::GetEmpty();
+		}
+		TArray<FOnNotificationAddedToPanel> OverflowDelegates = MoveTemp(Bucket.OverflowDelegates);
+		Bucket.NumOverflowed = 0;
+		Bucket.OverflowInfo = FEasyNotificationWidgetInfo();
+		Bucket.OverflowClass.Reset();
+		Bucket.OverflowDelegates.Reset();
+
+		if (OverflowClass)
+		{
+			// The dropped notifications are reported once their summary is shown, their delegates wait with it in the backlog
+			TGuardValue<bool> ShowingSummaryGuard(bIsShowingSummary, true);
+			ManagerPtr->SpawnNotificationWidget(LayerTag, OverflowClass, SummaryInfo, OverflowDelegates);
+		}
+	}
+
+	if (!bHasPendingSummary)
+	{
+		SummaryTickerHandle.Reset();
+	}
+	return bHasPendingSummary;
+}
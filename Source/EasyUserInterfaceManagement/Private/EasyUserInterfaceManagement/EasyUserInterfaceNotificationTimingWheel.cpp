@@ -0,0 +1,203 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagement/EasyUserInterfaceNotificationTimingWheel.h"
+
+#include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSettings.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceStats.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "ExtensionCommonUI/Notification/EasyNotificationWidget.h"
+
+namespace EasyUserInterfaceNotificationTimingWheel
+{
+	/** Time covered by a slot, the lifetimes expire up to that late */
+	constexpr double SlotSeconds = 0.05;
+	/** A turn of the wheel covers 6.4 seconds, longer lifetimes are checked once per turn until due */
+	constexpr int32 NumSlots = 128;
+
+	int32 GetSlotIndex(int64 SlotTick)
+	{
+		// The ticks before the first turn are negative once the wheel restarts
+		return static_cast<int32>(((SlotTick % NumSlots) + NumSlots) % NumSlots);
+	}
+}
+
+void FEasyUserInterfaceNotificationTimingWheel::Initialize(UEasyUserInterfaceManager& InManager)
+{
+	Manager = &InManager;
+	Slots.SetNum(EasyUserInterfaceNotificationTimingWheel::NumSlots);
+}
+
+void FEasyUserInterfaceNotificationTimingWheel::Deinitialize()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+		TickerHandle.Reset();
+	}
+	Lifetimes.Empty();
+	PendingDismissals.Empty();
+	for (TArray<FSlotEntry>& Slot : Slots)
+	{
+		Slot.Empty();
+	}
+	NumPublishingProgress = 0;
+}
+
+bool FEasyUserInterfaceNotificationTimingWheel::ScheduleLifetime(UEasyNotificationWidget& NotificationWidget, float Duration, bool bPublishProgress)
+{
+	const double Now = GetWorldTime();
+	if (Now < 0.0 || Slots.IsEmpty())
+	{
+		return false;
+	}
+
+	CancelLifetime(NotificationWidget);
+
+	// The wheel starts at the current time once idle
+	if (!TickerHandle.IsValid())
+	{
+		LastSlotTick = GetSlotTick(Now);
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FEasyUserInterfaceNotificationTimingWheel::Tick));
+	}
+
+	const TObjectKey<UEasyNotificationWidget> NotificationKey(&NotificationWidget);
+	FLifetime& Lifetime = Lifetimes.Add(NotificationKey);
+	Lifetime.NotificationWidget = &NotificationWidget;
+	Lifetime.StartTime = Now;
+	Lifetime.Duration = Duration;
+	Lifetime.Serial = ++NextSerial;
+	Lifetime.bPublishProgress = bPublishProgress;
+	NumPublishingProgress += bPublishProgress ? 1 : 0;
+
+	AddSlotEntry(NotificationKey, Now + Duration, Lifetime.Serial);
+	return true;
+}
+
+void FEasyUserInterfaceNotificationTimingWheel::CancelLifetime(const UEasyNotificationWidget& NotificationWidget)
+{
+	// The slot entry stays, it no longer matches a lifetime
+	FLifetime RemovedLifetime;
+	if (Lifetimes.RemoveAndCopyValue(TObjectKey<UEasyNotificationWidget>(&NotificationWidget), RemovedLifetime))
+	{
+		NumPublishingProgress -= RemovedLifetime.bPublishProgress ? 1 : 0;
+	}
+
+	if (PendingDismissals.Num() > 0)
+	{
+		PendingDismissals.Remove(const_cast<UEasyNotificationWidget*>(&NotificationWidget));
+	}
+}
+
+double FEasyUserInterfaceNotificationTimingWheel::GetWorldTime() const
+{
+	const UEasyUserInterfaceManager* ManagerPtr = Manager.Get();
+	const ULocalPlayer* LocalPlayer = ManagerPtr ? ManagerPtr->GetLocalPlayer() : nullptr;
+	const UWorld* World = LocalPlayer ? LocalPlayer->GetWorld() : nullptr;
+	return World ? World->GetTimeSeconds() : -1.0;
+}
+
+int64 FEasyUserInterfaceNotificationTimingWheel::GetSlotTick(double Time) const
+{
+	return FMath::FloorToInt64(Time / EasyUserInterfaceNotificationTimingWheel::SlotSeconds);
+}
+
+void FEasyUserInterfaceNotificationTimingWheel::AddSlotEntry(const TObjectKey<UEasyNotificationWidget>& NotificationKey, double ExpireTime, uint32 Serial)
+{
+	// The slot is checked once the world time is past its start, which is never before the expiry
+	const int64 SlotTick = FMath::Max(FMath::CeilToInt64(ExpireTime / EasyUserInterfaceNotificationTimingWheel::SlotSeconds), LastSlotTick + 1);
+	Slots[EasyUserInterfaceNotificationTimingWheel::GetSlotIndex(SlotTick)].Add({ NotificationKey, ExpireTime, Serial });
+}
+
+void FEasyUserInterfaceNotificationTimingWheel::ExpireSlot(int32 SlotIndex, double Now)
+{
+	TArray<FSlotEntry>& Slot = Slots[SlotIndex];
+	for (int32 Index = Slot.Num() - 1; Index >= 0; --Index)
+	{
+		const FSlotEntry& Entry = Slot[Index];
+		const FLifetime* Lifetime = Lifetimes.Find(Entry.NotificationKey);
+		if (Lifetime && Lifetime->Serial == Entry.Serial)
+		{
+			if (Entry.ExpireTime > Now)
+			{
+				continue;
+			}
+
+			PendingDismissals.Add(Lifetime->NotificationWidget);
+			NumPublishingProgress -= Lifetime->bPublishProgress ? 1 : 0;
+			Lifetimes.Remove(Entry.NotificationKey);
+		}
+		Slot.RemoveAtSwap(Index);
+	}
+}
+
+bool FEasyUserInterfaceNotificationTimingWheel::Tick(float DeltaTime)
+{
+	SCOPE_CYCLE_COUNTER(STAT_EasyUI_NotificationLifetimes);
+
+	const double Now = GetWorldTime();
+	if (Now >= 0.0)
+	{
+		// A world change restarts the world time, every slot is checked once
+		const int64 SlotTick = GetSlotTick(Now);
+		if (SlotTick < LastSlotTick)
+		{
+			LastSlotTick = SlotTick - EasyUserInterfaceNotificationTimingWheel::NumSlots;
+		}
+
+		const int64 NumSlotTicks = FMath::Min<int64>(SlotTick - LastSlotTick, EasyUserInterfaceNotificationTimingWheel::NumSlots);
+		for (int64 Offset = 1; Offset <= NumSlotTicks; ++Offset)
+		{
+			ExpireSlot(EasyUserInterfaceNotificationTimingWheel::GetSlotIndex(LastSlotTick + Offset), Now);
+		}
+		LastSlotTick = SlotTick;
+
+		if (NumPublishingProgress > 0)
+		{
+			// Gathered first, a subscriber can restart or cancel lifetimes from its progress event
+			for (const TPair<TObjectKey<UEasyNotificationWidget>, FLifetime>& LifetimePair : Lifetimes)
+			{
+				const FLifetime& Lifetime = LifetimePair.Value;
+				if (Lifetime.bPublishProgress)
+				{
+					const float TimeElapsed = static_cast<float>(Now - Lifetime.StartTime);
+					ProgressUpdates.Add({ Lifetime.NotificationWidget, FMath::Max(Lifetime.Duration - TimeElapsed, 0.0f), FMath::Clamp(TimeElapsed / Lifetime.Duration, 0.0f, 1.0f) });
+				}
+			}
+			for (const FProgressUpdate& ProgressUpdate : ProgressUpdates)
+			{
+				if (UEasyNotificationWidget* NotificationWidget = ProgressUpdate.NotificationWidget.Get())
+				{
+					NotificationWidget->PublishLifetimeProgress(ProgressUpdate.TimeRemaining, ProgressUpdate.Ratio);
+				}
+			}
+			ProgressUpdates.Reset();
+		}
+	}
+
+	if (PendingDismissals.Num() > 0)
+	{
+		// Taken out first, a dismissal can cancel or schedule other lifetimes
+		const int32 DismissalsPerFrame = UEasyUserInterfaceSettings::Get()->NotificationDismissalsPerFrame;
+		const int32 NumDismissals = DismissalsPerFrame > 0 ? FMath::Min(DismissalsPerFrame, PendingDismissals.Num()) : PendingDismissals.Num();
+		TArray<TWeakObjectPtr<UEasyNotificationWidget>> Dismissals(PendingDismissals.GetData(), NumDismissals);
+		PendingDismissals.RemoveAt(0, NumDismissals);
+
+		for (const TWeakObjectPtr<UEasyNotificationWidget>& Dismissal : Dismissals)
+		{
+			if (UEasyNotificationWidget* NotificationWidget = Dismissal.Get())
+			{
+				NotificationWidget->DismissNotification();
+			}
+		}
+	}
+
+	if (Lifetimes.Num() == 0 && PendingDismissals.Num() == 0)
+	{
+		TickerHandle.Reset();
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,403 @@
+// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagement/EasyUserInterfacePrefetcher.h"
+
+#include "EasyUserInterfaceManagement.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Dom/JsonObject.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceJson.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceNavigationGraph.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSettings.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceStats.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+namespace EasyUserInterfacePrefetcher
+{
+	/** Transitions counted from a class before its counts are halved, so the model follows the recent habits of the player */
+	constexpr uint32 MaxTransitionsPerClass = 1024;
+
+	/** Estimates the memory a class costs once loaded from the size of its package, 0 if unknown */
+	int64 EstimateClassSize(const FSoftObjectPath& WidgetClass)
+	{
+		const TOptional<FAssetPackageData> PackageData = FAssetRegistryModule::GetRegistry().GetAssetPackageDataCopy(WidgetClass.GetLongPackageFName());
+		return PackageData.IsSet() ? FMath::Max<int64>(PackageData->DiskSize, 0) : 0;
+	}
+}
+
+void FEasyUserInterfacePrefetcher::Initialize(UEasyUserInterfaceManager& InManager)
+{
+	Manager = &InManager;
+
+	const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+	if (Settings->bLearnTransitions && Settings->bPersistTransitionModel)
+	{
+		LoadTransitionModel();
+	}
+
+	if (!Settings->bPrefetchReachableWidgets || Settings->NavigationGraph.IsNull())
+	{
+		return;
+	}
+
+	NavigationGraphHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Settings->NavigationGraph.ToSoftObjectPath(), FStreamableDelegate::CreateLambda([this]()
+	{
+		if (!GetNavigationGraph())
+		{
+			UE_LOG(LogEasyUserInterfaceManagement, Warning, TEXT("Failed to load the navigation graph %s, reachable widgets are not prefetched."), *UEasyUserInterfaceSettings::Get()->NavigationGraph.ToString());
+			return;
+		}
+
+		// The screens displayed while the graph was loading
+		for (const TPair<FGameplayTag, FLayerPrefetch>& LayerPair : Layers)
+		{
+			PrefetchFromGraph(LayerPair.Key);
+		}
+	}));
+}
+
+void FEasyUserInterfacePrefetcher::Deinitialize()
+{
+	const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+	if (Settings->bLearnTransitions && Settings->bPersistTransitionModel && TransitionCounts.Num() > 0)
+	{
+		SaveTransitionModel();
+	}
+	TransitionCounts.Empty();
+
+	// The load callback captures this prefetcher
+	if (NavigationGraphHandle.IsValid())
+	{
+		NavigationGraphHandle->CancelHandle();
+		NavigationGraphHandle.Reset();
+	}
+
+	for (TPair<FGameplayTag, FLayerPrefetch>& LayerPair : Layers)
+	{
+		ReleaseLayer(LayerPair.Value);
+	}
+	Layers.Empty();
+	Manager.Reset();
+}
+
+void FEasyUserInterfacePrefetcher::RecordWidgetRequest(const FSoftObjectPath& WidgetClass)
+{
+	if (WidgetClass.ResolveObject() == nullptr)
+	{
+		++NumMisses;
+		INC_DWORD_STAT(STAT_EasyUI_PrefetchMisses);
+		return;
+	}
+
+	// Screens often open widgets on other layers (e.g. a prompt over a menu), so the prefetches of every layer are checked
+	for (const TPair<FGameplayTag, FLayerPrefetch>& LayerPair : Layers)
+	{
+		if (LayerPair.Value.PrefetchedClasses.Contains(WidgetClass))
+		{
+			++NumHits;
+			INC_DWORD_STAT(STAT_EasyUI_PrefetchHits);
+			return;
+		}
+	}
+}
+
+void FEasyUserInterfacePrefetcher::HandleLayerWidgetPushed(const FGameplayTag& LayerTag, const UObject* Widget)
+{
+	if (!Widget || !UEasyUserInterfaceSettings::Get()->bLearnTransitions)
+	{
+		return;
+	}
+
+	// Pushes are broadcast before the top widget changes, the displayed class is still the previous one
+	const FLayerPrefetch* LayerPrefetch = Layers.Find(LayerTag);
+	const UClass* FromClass = LayerPrefetch ? LayerPrefetch->TopClass.Get() : nullptr;
+
+	TMap<FSoftObjectPath, uint32>& NextClassCounts = TransitionCounts.FindOrAdd(LayerTag).FindOrAdd(FSoftObjectPath(FromClass));
+	++NextClassCounts.FindOrAdd(FSoftObjectPath(Widget->GetClass()));
+
+	uint32 NumTransitions = 0;
+	for (const TPair<FSoftObjectPath, uint32>& CountPair : NextClassCounts)
+	{
+		NumTransitions += CountPair.Value;
+	}
+	if (NumTransitions > EasyUserInterfacePrefetcher::MaxTransitionsPerClass)
+	{
+		for (auto CountIt = NextClassCounts.CreateIterator(); CountIt; ++CountIt)
+		{
+			CountIt->Value /= 2;
+			if (CountIt->Value == 0)
+			{
+				CountIt.RemoveCurrent();
+			}
+		}
+	}
+}
+
+void FEasyUserInterfacePrefetcher::HandleLayerTopWidgetChanged(const FGameplayTag& LayerTag, const UObject* Widget)
+{
+	const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+	if (!NavigationGraphHandle.IsValid() && !Settings->bLearnTransitions)
+	{
+		return;
+	}
+
+	// What was prefetched was meant for the previous widget
+	FLayerPrefetch& LayerPrefetch = Layers.FindOrAdd(LayerTag);
+	FLayerPrefetch PreviousPrefetch = MoveTemp(LayerPrefetch);
+	LayerPrefetch = FLayerPrefetch();
+	LayerPrefetch.TopClass = Widget ? Widget->GetClass() : nullptr;
+
+	PrefetchFromGraph(LayerTag);
+	if (Settings->bLearnTransitions && Settings->LearnedPrefetchMaxClasses > 0)
+	{
+		LayerPrefetch.LearnedPrefetchTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &FEasyUserInterfacePrefetcher::TickLearnedPrefetch, LayerTag), Settings->LearnedPrefetchIdleDelay);
+	}
+
+	// Released after the new requests, so the classes prefetched for both widgets stay loaded
+	ReleaseLayer(PreviousPrefetch);
+}
+
+void FEasyUserInterfacePrefetcher::GetProbableNextClasses(const FGameplayTag& LayerTag, const UClass* FromClass, float MinProbability, TArray<FSoftObjectPath>& OutClasses) const
+{
+	const TMap<FSoftObjectPath, TMap<FSoftObjectPath, uint32>>* LayerTransitions = TransitionCounts.Find(LayerTag);
+	const TMap<FSoftObjectPath, uint32>* NextClassCounts = LayerTransitions ? LayerTransitions->Find(FSoftObjectPath(FromClass)) : nullptr;
+	if (!NextClassCounts)
+	{
+		return;
+	}
+
+	uint32 NumTransitions = 0;
+	for (const TPair<FSoftObjectPath, uint32>& CountPair : *NextClassCounts)
+	{
+		NumTransitions += CountPair.Value;
+	}
+
+	TArray<TPair<FSoftObjectPath, uint32>> SortedCounts = NextClassCounts->Array();
+	SortedCounts.Sort([](const TPair<FSoftObjectPath, uint32>& A, const TPair<FSoftObjectPath, uint32>& B)
+	{
+		return A.Value > B.Value;
+	});
+	for (const TPair<FSoftObjectPath, uint32>& CountPair : SortedCounts)
+	{
+		if (NumTransitions == 0 || static_cast<float>(CountPair.Value) / NumTransitions < MinProbability)
+		{
+			break;
+		}
+		OutClasses.Add(CountPair.Key);
+	}
+}
+
+const UEasyUserInterfaceNavigationGraph* FEasyUserInterfacePrefetcher::GetNavigationGraph() const
+{
+	return NavigationGraphHandle.IsValid() ? Cast<UEasyUserInterfaceNavigationGraph>(NavigationGraphHandle->GetLoadedAsset()) : nullptr;
+}
+
+int32 FEasyUserInterfacePrefetcher::GetNumPrefetchedClasses() const
+{
+	int32 NumClasses = 0;
+	for (const TPair<FGameplayTag, FLayerPrefetch>& LayerPair : Layers)
+	{
+		NumClasses += LayerPair.Value.PrefetchedClasses.Num();
+	}
+	return NumClasses;
+}
+
+bool FEasyUserInterfacePrefetcher::SaveTransitionModel() const
+{
+	TArray<TSharedPtr<FJsonValue>> LayerValues;
+	for (const TPair<FGameplayTag, TMap<FSoftObjectPath, TMap<FSoftObjectPath, uint32>>>& LayerPair : TransitionCounts)
+	{
+		TArray<TSharedPtr<FJsonValue>> TransitionValues;
+		for (const TPair<FSoftObjectPath, TMap<FSoftObjectPath, uint32>>& FromPair : LayerPair.Value)
+		{
+			for (const TPair<FSoftObjectPath, uint32>& CountPair : FromPair.Value)
+			{
+				TSharedRef<FJsonObject> Transition = MakeShared<FJsonObject>();
+				Transition->SetStringField(TEXT("From"), FromPair.Key.ToString());
+				Transition->SetStringField(TEXT("To"), CountPair.Key.ToString());
+				Transition->SetNumberField(TEXT("Count"), CountPair.Value);
+				TransitionValues.Add(MakeShared<FJsonValueObject>(Transition));
+			}
+		}
+
+		TSharedRef<FJsonObject> LayerObject = MakeShared<FJsonObject>();
+		LayerObject->SetStringField(TEXT("Layer"), LayerPair.Key.ToString());
+		LayerObject->SetArrayField(TEXT("Transitions"), TransitionValues);
+		LayerValues.Add(MakeShared<FJsonValueObject>(LayerObject));
+	}
+
+	TSharedRef<FJsonObject> Model = MakeShared<FJsonObject>();
+	Model->SetArrayField(TEXT("Layers"), LayerValues);
+	return FEasyUserInterfaceJson::WriteToFile(Model, GetTransitionModelPath());
+}
+
+bool FEasyUserInterfacePrefetcher::LoadTransitionModel()
+{
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *GetTransitionModelPath()))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> Model;
+	if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(JsonString), Model) || !Model.IsValid())
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Warning, TEXT("Failed to parse the transition model %s, starting from an empty one."), *GetTransitionModelPath());
+		return false;
+	}
+
+	TransitionCounts.Reset();
+	for (const TSharedPtr<FJsonValue>& LayerValue : Model->GetArrayField(TEXT("Layers")))
+	{
+		const TSharedPtr<FJsonObject>& LayerObject = LayerValue->AsObject();
+		// Layers renamed since the model was saved are dropped
+		const FGameplayTag LayerTag = FGameplayTag::RequestGameplayTag(FName(LayerObject->GetStringField(TEXT("Layer"))), false);
+		if (!LayerTag.IsValid())
+		{
+			continue;
+		}
+
+		TMap<FSoftObjectPath, TMap<FSoftObjectPath, uint32>>& LayerTransitions = TransitionCounts.FindOrAdd(LayerTag);
+		for (const TSharedPtr<FJsonValue>& TransitionValue : LayerObject->GetArrayField(TEXT("Transitions")))
+		{
+			const TSharedPtr<FJsonObject>& Transition = TransitionValue->AsObject();
+			const FSoftObjectPath ToClass(Transition->GetStringField(TEXT("To")));
+			if (ToClass.IsValid())
+			{
+				LayerTransitions.FindOrAdd(FSoftObjectPath(Transition->GetStringField(TEXT("From")))).Add(ToClass, static_cast<uint32>(Transition->GetNumberField(TEXT("Count"))));
+			}
+		}
+	}
+	return true;
+}
+
+FString FEasyUserInterfacePrefetcher::GetTransitionModelPath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyUI"), TEXT("TransitionModel.json"));
+}
+
+void FEasyUserInterfacePrefetcher::PrefetchFromGraph(const FGameplayTag& LayerTag)
+{
+	const UEasyUserInterfaceNavigationGraph* NavigationGraph = GetNavigationGraph();
+	FLayerPrefetch* LayerPrefetch = Layers.Find(LayerTag);
+	if (!NavigationGraph || !LayerPrefetch || LayerPrefetch->GraphHandle.IsValid())
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> ReachableClasses;
+	NavigationGraph->GetReachableWidgetClasses(LayerPrefetch->TopClass.Get(), ReachableClasses);
+	if (ReachableClasses.Num() > 0)
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Verbose, TEXT("Prefetching %d widget class(es) reachable from layer %s."), ReachableClasses.Num(), *LayerTag.ToString());
+		LayerPrefetch->GraphHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(ReachableClasses);
+		for (const FSoftObjectPath& ReachableClass : ReachableClasses)
+		{
+			LayerPrefetch->PrefetchedClasses.AddUnique(ReachableClass);
+		}
+	}
+}
+
+bool FEasyUserInterfacePrefetcher::TickLearnedPrefetch(float DeltaTime, FGameplayTag LayerTag)
+{
+	FLayerPrefetch* LayerPrefetch = Layers.Find(LayerTag);
+	if (!LayerPrefetch || !Manager.IsValid())
+	{
+		return false;
+	}
+	if (!IsIdle(LayerTag))
+	{
+		return true;
+	}
+	LayerPrefetch->LearnedPrefetchTickerHandle.Reset();
+
+	const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+	TArray<FSoftObjectPath> ProbableClasses;
+	GetProbableNextClasses(LayerTag, LayerPrefetch->TopClass.Get(), Settings->LearnedPrefetchMinProbability, ProbableClasses);
+
+	int64 UsedBytes = 0;
+	for (const TPair<FGameplayTag, FLayerPrefetch>& LayerPair : Layers)
+	{
+		UsedBytes += LayerPair.Value.LearnedBytes;
+	}
+	const int64 BudgetBytes = static_cast<int64>(Settings->LearnedPrefetchBudgetMB * 1024.0 * 1024.0);
+
+	TArray<FSoftObjectPath> ClassesToPrefetch;
+	for (const FSoftObjectPath& ProbableClass : ProbableClasses)
+	{
+		if (ClassesToPrefetch.Num() >= Settings->LearnedPrefetchMaxClasses)
+		{
+			break;
+		}
+		// Loaded classes cost nothing more, and the ones of the navigation graph are already requested
+		if (ProbableClass.ResolveObject() || LayerPrefetch->PrefetchedClasses.Contains(ProbableClass))
+		{
+			continue;
+		}
+
+		const int64 ClassBytes = EasyUserInterfacePrefetcher::EstimateClassSize(ProbableClass);
+		if (BudgetBytes > 0 && UsedBytes + ClassBytes > BudgetBytes)
+		{
+			UE_LOG(LogEasyUserInterfaceManagement, Verbose, TEXT("Skipping the prefetch of %s, the learned prefetch budget of %.1f MB is used."), *ProbableClass.ToString(), Settings->LearnedPrefetchBudgetMB);
+			continue;
+		}
+		UsedBytes += ClassBytes;
+		LayerPrefetch->LearnedBytes += ClassBytes;
+		ClassesToPrefetch.Add(ProbableClass);
+	}
+
+	if (ClassesToPrefetch.Num() > 0)
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Verbose, TEXT("Prefetching %d widget class(es) likely to be pushed next on layer %s."), ClassesToPrefetch.Num(), *LayerTag.ToString());
+		LayerPrefetch->LearnedHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(ClassesToPrefetch);
+		LayerPrefetch->PrefetchedClasses.Append(ClassesToPrefetch);
+	}
+	return false;
+}
+
+bool FEasyUserInterfacePrefetcher::IsIdle(const FGameplayTag& LayerTag) const
+{
+	const UEasyUserInterfaceManager* UserInterfaceManager = Manager.Get();
+	if (!UserInterfaceManager || UserInterfaceManager->GetPendingLoads().Num() > 0)
+	{
+		return false;
+	}
+
+	const UEasyUserInterfaceRootWidget* RootWidget = UserInterfaceManager->RootWidget;
+	if (!IsValid(RootWidget) || RootWidget->GetPendingLoads().Num() > 0)
+	{
+		return false;
+	}
+
+	const FEasyUserInterfaceLayerState* LayerState = RootWidget->FindLayerState(LayerTag);
+	return !LayerState || !LayerState->bIsTransitioning;
+}
+
+void FEasyUserInterfacePrefetcher::ReleaseLayer(FLayerPrefetch& LayerPrefetch)
+{
+	if (LayerPrefetch.LearnedPrefetchTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(LayerPrefetch.LearnedPrefetchTickerHandle);
+		LayerPrefetch.LearnedPrefetchTickerHandle.Reset();
+	}
+	if (LayerPrefetch.GraphHandle.IsValid())
+	{
+		LayerPrefetch.GraphHandle->ReleaseHandle();
+		LayerPrefetch.GraphHandle.Reset();
+	}
+	if (LayerPrefetch.LearnedHandle.IsValid())
+	{
+		LayerPrefetch.LearnedHandle->ReleaseHandle();
+		LayerPrefetch.LearnedHandle.Reset();
+	}
+	LayerPrefetch.PrefetchedClasses.Reset();
+	LayerPrefetch.LearnedBytes = 0;
+}
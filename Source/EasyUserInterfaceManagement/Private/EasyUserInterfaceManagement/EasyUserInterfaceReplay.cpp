@@ -0,0 +1,780 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagement/EasyUserInterfaceReplay.h"
+
+#include "EasyUserInterfaceManagement.h"
+#include "Containers/Ticker.h"
+#include "Dom/JsonObject.h"
+#include "Engine/AssetManager.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceJson.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceStats.h"
+#include "ExtensionCommonUI/EasyUserInterfaceRootWidget.h"
+#include "ExtensionCommonUI/Notification/EasyNotificationWidget.h"
+#include "ExtensionCommonUI/TabListSwitcher/EasyTabList.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "UObject/UObjectHash.h"
+#include "Widgets/CommonActivatableWidgetContainer.h"
+
+bool FEasyUserInterfaceReplay::bIsRecording = false;
+
+namespace EasyUserInterfaceReplay
+{
+	/** "EUIR" */
+	constexpr uint32 TraceMagic = 0x52495545;
+	constexpr int32 TraceVersion = 1;
+
+	enum ERecordFlags : uint8
+	{
+		Flag_None = 0,
+		Flag_CanBeManuallyDismissed = 1 << 0,
+		Flag_DeactivateOnAnyResult = 1 << 1,
+		Flag_HideMouse = 1 << 2
+	};
+
+	/** Stores a string table index (INDEX_NONE included) as a packed unsigned integer */
+	void SerializeIndex(FArchive& Ar, int32& Index)
+	{
+		uint32 PackedIndex = static_cast<uint32>(Index + 1);
+		Ar.SerializeIntPacked(PackedIndex);
+		Index = static_cast<int32>(PackedIndex) - 1;
+	}
+
+	void SerializeIndices(FArchive& Ar, TArray<int32>& Indices)
+	{
+		uint32 Num = Indices.Num();
+		Ar.SerializeIntPacked(Num);
+		if (Ar.IsLoading())
+		{
+			Indices.SetNum(Num);
+		}
+		for (int32& Index : Indices)
+		{
+			SerializeIndex(Ar, Index);
+		}
+	}
+
+	/**
+	 * One recorded operation. Strings (tags, class paths, names) are stored once in the trace string table and
+	 * referenced by index, the meaning of the other fields depends on the operation.
+	 */
+	struct FRecord
+	{
+		EEasyUserInterfaceReplayOperation Operation = EEasyUserInterfaceReplayOperation::PushWidget;
+		/** Frames since the start of the recording */
+		uint32 Frame = 0;
+		/** Layer tags */
+		TArray<int32> Tags;
+		/** Widget, notification or prompt class path */
+		int32 Class = INDEX_NONE;
+		/** Tab list name */
+		int32 Name = INDEX_NONE;
+		/** Tab id */
+		int32 Id = INDEX_NONE;
+		/** Notification icon and icon widget class paths */
+		TArray<int32> Assets;
+		/** Notification header and body, or prompt header, body, confirm and cancel texts */
+		TArray<FText> Texts;
+		/** Notification duration */
+		float Duration = 0.0f;
+		/** ERecordFlags */
+		uint8 Flags = Flag_None;
+		/** Prompt result, or input mode and mouse capture mode */
+		uint8 Values[2] = { 0, 0 };
+
+		friend FArchive& operator<<(FArchive& Ar, FRecord& Record)
+		{
+			Ar << Record.Operation;
+			Ar.SerializeIntPacked(Record.Frame);
+			SerializeIndices(Ar, Record.Tags);
+			SerializeIndex(Ar, Record.Class);
+			SerializeIndex(Ar, Record.Name);
+			SerializeIndex(Ar, Record.Id);
+			SerializeIndices(Ar, Record.Assets);
+			Ar << Record.Texts;
+			Ar << Record.Duration;
+			Ar << Record.Flags;
+			Ar << Record.Values[0];
+			Ar << Record.Values[1];
+			return Ar;
+		}
+	};
+
+	struct FTrace
+	{
+		TArray<FString> Strings;
+		TArray<FRecord> Records;
+		/** Lookup of Strings while recording */
+		TMap<FString, int32> StringIndices;
+
+		int32 AddString(const FString& String)
+		{
+			if (String.IsEmpty())
+			{
+				return INDEX_NONE;
+			}
+			if (const int32* ExistingIndex = StringIndices.Find(String))
+			{
+				return *ExistingIndex;
+			}
+			const int32 Index = Strings.Add(String);
+			StringIndices.Add(String, Index);
+			return Index;
+		}
+
+		const FString& GetString(int32 Index) const
+		{
+			static const FString EmptyString;
+			return Strings.IsValidIndex(Index) ? Strings[Index] : EmptyString;
+		}
+
+		bool Serialize(FArchive& Ar)
+		{
+			uint32 Magic = TraceMagic;
+			int32 Version = TraceVersion;
+			Ar << Magic;
+			Ar << Version;
+			if (Ar.IsLoading() && (Magic != TraceMagic || Version != TraceVersion))
+			{
+				return false;
+			}
+			Ar << Strings;
+			Ar << Records;
+			return !Ar.IsError();
+		}
+
+		/** Retrieves the classes and assets referenced by the records */
+		TArray<FSoftObjectPath> GetReferencedAssets() const
+		{
+			TSet<int32> AssetIndices;
+			for (const FRecord& Record : Records)
+			{
+				AssetIndices.Add(Record.Class);
+				AssetIndices.Append(Record.Assets);
+			}
+
+			TArray<FSoftObjectPath> AssetPaths;
+			for (const int32 AssetIndex : AssetIndices)
+			{
+				const FSoftObjectPath AssetPath(GetString(AssetIndex));
+				if (!AssetPath.IsNull())
+				{
+					AssetPaths.Add(AssetPath);
+				}
+			}
+			return AssetPaths;
+		}
+	};
+
+	struct FRecordingSession
+	{
+		TWeakObjectPtr<const ULocalPlayer> LocalPlayer;
+		uint64 StartFrame = 0;
+		FTrace Trace;
+	};
+	TUniquePtr<FRecordingSession> RecordingSession;
+
+	/** Starts a record of the recorded player, or returns nullptr for other players */
+	FRecord* AddRecord(const ULocalPlayer* LocalPlayer, EEasyUserInterfaceReplayOperation Operation)
+	{
+		if (!RecordingSession.IsValid() || !LocalPlayer || RecordingSession->LocalPlayer.Get() != LocalPlayer)
+		{
+			return nullptr;
+		}
+
+		FRecord& Record = RecordingSession->Trace.Records.AddDefaulted_GetRef();
+		Record.Operation = Operation;
+		Record.Frame = static_cast<uint32>(GFrameCounter - RecordingSession->StartFrame);
+		return &Record;
+	}
+
+	int32 AddString(const FString& String)
+	{
+		return RecordingSession->Trace.AddString(String);
+	}
+
+	/** Finds the layer of a widget through the user widgets it is nested in */
+	FGameplayTag FindOwningLayer(const UWidget& Widget, const UEasyUserInterfaceRootWidget& RootWidget)
+	{
+		for (const UUserWidget* UserWidget = Widget.GetTypedOuter<UUserWidget>(); UserWidget; UserWidget = UserWidget->GetTypedOuter<UUserWidget>())
+		{
+			const FGameplayTag LayerTag = RootWidget.FindWidgetLayer(UserWidget);
+			if (LayerTag.IsValid())
+			{
+				return LayerTag;
+			}
+		}
+		return FGameplayTag();
+	}
+
+	const UEasyUserInterfaceRootWidget* FindRootWidget(const ULocalPlayer* LocalPlayer)
+	{
+		const UEasyUserInterfaceManager* Manager = LocalPlayer ? LocalPlayer->GetSubsystem<UEasyUserInterfaceManager>() : nullptr;
+		return Manager && Manager->IsRootWidgetReady() ? Manager->RootWidget.Get() : nullptr;
+	}
+
+	struct FReplaySession
+	{
+		TWeakObjectPtr<UEasyUserInterfaceManager> Manager;
+		FEasyUserInterfaceReplayParams Params;
+		FTrace Trace;
+		FTSTicker::FDelegateHandle TickerHandle;
+		/** Keeps the classes and assets of the trace loaded for the whole replay */
+		TSharedPtr<FStreamableHandle> PreloadHandle;
+
+		bool bHasStarted = false;
+		double Deadline = 0.0;
+		uint32 Frame = 0;
+		int32 NextRecord = 0;
+		int32 SettleFramesLeft = 0;
+		TArray<float> FrameTimes;
+		TArray<TSharedPtr<FJsonValue>> FailedOperations;
+	};
+	TUniquePtr<FReplaySession> ReplaySession;
+
+	const TCHAR* LexToString(EEasyUserInterfaceReplayOperation Operation)
+	{
+		switch (Operation)
+		{
+		case EEasyUserInterfaceReplayOperation::PushWidget: return TEXT("PushWidget");
+		case EEasyUserInterfaceReplayOperation::AddNotification: return TEXT("AddNotification");
+		case EEasyUserInterfaceReplayOperation::PushPrompt: return TEXT("PushPrompt");
+		case EEasyUserInterfaceReplayOperation::PromptAnswer: return TEXT("PromptAnswer");
+		case EEasyUserInterfaceReplayOperation::TabSelected: return TEXT("TabSelected");
+		case EEasyUserInterfaceReplayOperation::InputModeChanged: return TEXT("InputModeChanged");
+		default: return TEXT("Unknown");
+		}
+	}
+
+	void AddFailure(FReplaySession& Session, const FRecord& Record, const FString& Reason)
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Warning, TEXT("Replay: %s at frame %u failed: %s"), LexToString(Record.Operation), Record.Frame, *Reason);
+
+		TSharedRef<FJsonObject> Failure = MakeShared<FJsonObject>();
+		Failure->SetStringField(TEXT("Operation"), LexToString(Record.Operation));
+		Failure->SetNumberField(TEXT("Frame"), Record.Frame);
+		Failure->SetStringField(TEXT("Reason"), Reason);
+		Session.FailedOperations.Add(MakeShared<FJsonValueObject>(Failure));
+	}
+
+	FGameplayTag RequestTag(const FTrace& Trace, int32 Index)
+	{
+		return FGameplayTag::RequestGameplayTag(FName(*Trace.GetString(Index)), false);
+	}
+
+	UCommonActivatableWidget* FindLayerTopWidget(const UEasyUserInterfaceManager& Manager, const FGameplayTag& LayerTag)
+	{
+		const UCommonActivatableWidgetStack* Stack = Manager.FindWidgetStack(LayerTag);
+		return Stack ? Stack->GetActiveWidget() : nullptr;
+	}
+
+	void ExecuteRecord(FReplaySession& Session, UEasyUserInterfaceManager& Manager, const FRecord& Record)
+	{
+		const FTrace& Trace = Session.Trace;
+		const FGameplayTag LayerTag = Record.Tags.Num() > 0 ? RequestTag(Trace, Record.Tags[0]) : FGameplayTag();
+		const FSoftObjectPath ClassPath(Trace.GetString(Record.Class));
+
+		switch (Record.Operation)
+		{
+		case EEasyUserInterfaceReplayOperation::PushWidget:
+			{
+				if (!Manager.PushWidgetToStackAsync(LayerTag, TSoftClassPtr<UCommonActivatableWidget>(ClassPath), FOnWidgetUpdatedOnStack()))
+				{
+					AddFailure(Session, Record, FString::Printf(TEXT("Could not push %s to %s"), *ClassPath.ToString(), *LayerTag.ToString()));
+				}
+				break;
+			}
+		case EEasyUserInterfaceReplayOperation::AddNotification:
+			{
+				FEasyNotificationWidgetInfo NotificationInfo;
+				NotificationInfo.NotificationHeader = Record.Texts.IsValidIndex(0) ? Record.Texts[0] : FText::GetEmpty();
+				NotificationInfo.NotificationBody = Record.Texts.IsValidIndex(1) ? Record.Texts[1] : FText::GetEmpty();
+				NotificationInfo.NotificationIcon = TSoftObjectPtr<UObject>(FSoftObjectPath(Trace.GetString(Record.Assets.IsValidIndex(0) ? Record.Assets[0] : INDEX_NONE)));
+				NotificationInfo.NotificationIconWidgetClass = TSoftClassPtr<UEasyNotificationIconContent>(FSoftObjectPath(Trace.GetString(Record.Assets.IsValidIndex(1) ? Record.Assets[1] : INDEX_NONE)));
+				NotificationInfo.NotificationDuration = Record.Duration;
+				NotificationInfo.bCanBeManuallyDismissed = (Record.Flags & Flag_CanBeManuallyDismissed) != 0;
+
+				FGameplayTagContainer LayerTags;
+				for (const int32 TagIndex : Record.Tags)
+				{
+					LayerTags.AddTag(RequestTag(Trace, TagIndex));
+				}
+				if (!Manager.AddNotificationToPanels(LayerTags, TSoftClassPtr<UEasyNotificationWidget>(ClassPath), MakeShared<const FEasyNotificationWidgetInfo>(MoveTemp(NotificationInfo)), FOnNotificationAddedToPanel()))
+				{
+					AddFailure(Session, Record, FString::Printf(TEXT("Could not add %s to %s"), *ClassPath.ToString(), *LayerTags.ToStringSimple()));
+				}
+				break;
+			}
+		case EEasyUserInterfaceReplayOperation::PushPrompt:
+			{
+				// Prompts take a loaded class, preloaded with the other classes of the trace
+				const TSubclassOf<UEasyPromptQuestion> PromptClass = TSoftClassPtr<UEasyPromptQuestion>(ClassPath).Get();
+
+				FPromptQuestionBodyInfo QuestionBodyInfo;
+				QuestionBodyInfo.QuestionHeaderText = Record.Texts.IsValidIndex(0) ? Record.Texts[0] : FText::GetEmpty();
+				QuestionBodyInfo.QuestionBodyText = Record.Texts.IsValidIndex(1) ? Record.Texts[1] : FText::GetEmpty();
+				QuestionBodyInfo.ConfirmButtonText = Record.Texts.IsValidIndex(2) ? Record.Texts[2] : FText::GetEmpty();
+				QuestionBodyInfo.CancelButtonText = Record.Texts.IsValidIndex(3) ? Record.Texts[3] : FText::GetEmpty();
+				QuestionBodyInfo.bDeactivateWidgetOnAnyResult = (Record.Flags & Flag_DeactivateOnAnyResult) != 0;
+
+				if (!PromptClass || !Manager.PushQuestionPromptToLayer(PromptClass, LayerTag, QuestionBodyInfo, FPromtResultEventDelegate()))
+				{
+					AddFailure(Session, Record, FString::Printf(TEXT("Could not push prompt %s to %s"), *ClassPath.ToString(), *LayerTag.ToString()));
+				}
+				break;
+			}
+		case EEasyUserInterfaceReplayOperation::PromptAnswer:
+			{
+				UEasyPromptQuestion* Prompt = Cast<UEasyPromptQuestion>(FindLayerTopWidget(Manager, LayerTag));
+				if (!Prompt)
+				{
+					AddFailure(Session, Record, FString::Printf(TEXT("No prompt displayed on %s"), *LayerTag.ToString()));
+				}
+				else
+				{
+					Prompt->AnswerPrompt(Record.Values[0] == EPromptQuestionResult::PQR_Confirm);
+				}
+				break;
+			}
+		case EEasyUserInterfaceReplayOperation::TabSelected:
+			{
+				const FName TabListName(*Trace.GetString(Record.Name));
+				UEasyTabList* TabList = nullptr;
+				if (UCommonActivatableWidget* TopWidget = FindLayerTopWidget(Manager, LayerTag))
+				{
+					ForEachObjectWithOuter(TopWidget, [&TabList, TabListName](UObject* Object)
+					{
+						if (!TabList && Object->GetFName() == TabListName)
+						{
+							TabList = Cast<UEasyTabList>(Object);
+						}
+					}, true);
+				}
+
+				if (!TabList || !TabList->SelectTabByID(FName(*Trace.GetString(Record.Id))))
+				{
+					AddFailure(Session, Record, FString::Printf(TEXT("Could not select tab %s of %s on %s"), *Trace.GetString(Record.Id), *TabListName.ToString(), *LayerTag.ToString()));
+				}
+				break;
+			}
+		case EEasyUserInterfaceReplayOperation::InputModeChanged:
+			{
+				const ULocalPlayer* LocalPlayer = Manager.GetLocalPlayer();
+				APlayerController* PlayerController = LocalPlayer ? LocalPlayer->GetPlayerController(Manager.GetWorld()) : nullptr;
+				if (!PlayerController)
+				{
+					AddFailure(Session, Record, TEXT("No player controller"));
+					break;
+				}
+				Manager.SetCommonInputMode(PlayerController, static_cast<ECommonInputMode>(Record.Values[0]), static_cast<EMouseCaptureMode>(Record.Values[1]), (Record.Flags & Flag_HideMouse) != 0);
+				break;
+			}
+		default:
+			AddFailure(Session, Record, TEXT("Unknown operation"));
+			break;
+		}
+	}
+
+	TSharedRef<FJsonObject> MakeResults(const FReplaySession& Session, const FString& Error)
+	{
+		TSharedRef<FJsonObject> Results = MakeShared<FJsonObject>();
+		Results->SetStringField(TEXT("Trace"), Session.Params.InputPath);
+		Results->SetStringField(TEXT("Timestamp"), FDateTime::UtcNow().ToIso8601());
+		Results->SetNumberField(TEXT("Operations"), Session.Trace.Records.Num());
+		Results->SetNumberField(TEXT("Frames"), Session.Frame);
+		Results->SetNumberField(TEXT("Failures"), Session.FailedOperations.Num() + (Error.IsEmpty() ? 0 : 1));
+		if (!Error.IsEmpty())
+		{
+			Results->SetStringField(TEXT("Error"), Error);
+		}
+		Results->SetArrayField(TEXT("FailedOperations"), Session.FailedOperations);
+
+		TArray<float> SortedFrameTimes = Session.FrameTimes;
+		SortedFrameTimes.Sort();
+		TSharedRef<FJsonObject> FrameTime = MakeShared<FJsonObject>();
+		if (SortedFrameTimes.Num() > 0)
+		{
+			double TotalFrameTime = 0.0;
+			for (const float DeltaTime : SortedFrameTimes)
+			{
+				TotalFrameTime += DeltaTime;
+			}
+			const int32 P95Index = FMath::Min(FMath::CeilToInt(SortedFrameTimes.Num() * 0.95f), SortedFrameTimes.Num()) - 1;
+			FrameTime->SetNumberField(TEXT("AvgMs"), TotalFrameTime * 1000.0 / SortedFrameTimes.Num());
+			FrameTime->SetNumberField(TEXT("P95Ms"), SortedFrameTimes[P95Index] * 1000.0f);
+			FrameTime->SetNumberField(TEXT("MaxMs"), SortedFrameTimes.Last() * 1000.0f);
+		}
+		Results->SetObjectField(TEXT("FrameTime"), FrameTime);
+
+		TArray<TSharedPtr<FJsonValue>> Latencies;
+		for (int32 OperationIndex = 0; OperationIndex < static_cast<int32>(EEasyUserInterfaceOperation::Num); ++OperationIndex)
+		{
+			for (int32 PhaseIndex = 0; PhaseIndex < static_cast<int32>(EEasyUserInterfaceLatencyPhase::Num); ++PhaseIndex)
+			{
+				const EEasyUserInterfaceOperation Operation = static_cast<EEasyUserInterfaceOperation>(OperationIndex);
+				const EEasyUserInterfaceLatencyPhase Phase = static_cast<EEasyUserInterfaceLatencyPhase>(PhaseIndex);
+				const FEasyUserInterfaceLatencySummary Summary = FEasyUserInterfaceStats::GetLatencySummary(Operation, Phase);
+				if (Summary.NumSamples == 0)
+				{
+					continue;
+				}
+
+				TSharedRef<FJsonObject> Latency = MakeShared<FJsonObject>();
+				Latency->SetStringField(TEXT("Operation"), FEasyUserInterfaceStats::LexToString(Operation));
+				Latency->SetStringField(TEXT("Phase"), FEasyUserInterfaceStats::LexToString(Phase));
+				Latency->SetNumberField(TEXT("Samples"), Summary.NumSamples);
+				Latency->SetNumberField(TEXT("MinMs"), Summary.Min);
+				Latency->SetNumberField(TEXT("AvgMs"), Summary.Avg);
+				Latency->SetNumberField(TEXT("P95Ms"), Summary.P95);
+				Latency->SetNumberField(TEXT("MaxMs"), Summary.Max);
+				Latencies.Add(MakeShared<FJsonValueObject>(Latency));
+			}
+		}
+		Results->SetArrayField(TEXT("Latency"), Latencies);
+		return Results;
+	}
+
+	void FinishReplay(const FString& Error = FString())
+	{
+		const TUniquePtr<FReplaySession> Session = MoveTemp(ReplaySession);
+		const TSharedRef<FJsonObject> Results = MakeResults(*Session, Error);
+		const FString OutputPath = Session->Params.OutputPath.IsEmpty() ? FEasyUserInterfaceReplay::GetDefaultResultsPath() : Session->Params.OutputPath;
+		const bool bWritten = FEasyUserInterfaceJson::WriteToFile(Results, OutputPath);
+		const int32 NumFailures = static_cast<int32>(Results->GetNumberField(TEXT("Failures")));
+
+		UE_LOG(LogEasyUserInterfaceManagement, Display, TEXT("Replay of %d operation(s) over %u frame(s) finished with %d failure(s), results: %s"),
+			Session->Trace.Records.Num(), Session->Frame, NumFailures, *OutputPath);
+
+		if (Session->Params.bExitWhenDone)
+		{
+			FPlatformMisc::RequestExitWithStatus(false, (bWritten && NumFailures == 0) ? 0 : 1);
+		}
+	}
+
+	bool TickReplay(float DeltaTime)
+	{
+		FReplaySession& Session = *ReplaySession;
+		UEasyUserInterfaceManager* Manager = Session.Manager.Get();
+		if (!Manager)
+		{
+			FinishReplay(TEXT("The User Interface Manager was destroyed during the replay."));
+			return false;
+		}
+
+		if (!Session.bHasStarted)
+		{
+			const bool bHasPreloaded = !Session.PreloadHandle.IsValid() || Session.PreloadHandle->HasLoadCompleted();
+			if (!Manager->IsRootWidgetReady() || !bHasPreloaded)
+			{
+				if (FPlatformTime::Seconds() > Session.Deadline)
+				{
+					FinishReplay(bHasPreloaded ? TEXT("The root widget was not added to the viewport in time.") : TEXT("The classes of the trace were not loaded in time."));
+					return false;
+				}
+				return true;
+			}
+
+			// Frame offsets are relative to the first frame the root widget is ready
+			Session.bHasStarted = true;
+			Session.SettleFramesLeft = Session.Params.SettleFrames;
+			FEasyUserInterfaceStats::Reset();
+		}
+		else
+		{
+			Session.FrameTimes.Add(DeltaTime);
+		}
+
+		while (Session.Trace.Records.IsValidIndex(Session.NextRecord) && Session.Trace.Records[Session.NextRecord].Frame <= Session.Frame)
+		{
+			ExecuteRecord(Session, *Manager, Session.Trace.Records[Session.NextRecord++]);
+		}
+		++Session.Frame;
+
+		if (Session.NextRecord >= Session.Trace.Records.Num() && Session.SettleFramesLeft-- <= 0)
+		{
+			FinishReplay();
+			return false;
+		}
+		return true;
+	}
+
+	UEasyUserInterfaceManager* FindManager(const UWorld* World)
+	{
+		const ULocalPlayer* LocalPlayer = World ? World->GetFirstLocalPlayerFromController() : nullptr;
+		return LocalPlayer ? LocalPlayer->GetSubsystem<UEasyUserInterfaceManager>() : nullptr;
+	}
+
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleCommandWithWorldAndArgs RecordCommand(
+		TEXT("EasyUI.Record"),
+		TEXT("Records the User Interface operations of the first local player into a binary trace.\n")
+		TEXT("Usage: EasyUI.Record Start | Stop [Output=Path.euitrace]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (Args.Num() > 0 && Args[0].Equals(TEXT("Stop"), ESearchCase::IgnoreCase))
+			{
+				FString OutputPath = FEasyUserInterfaceReplay::GetDefaultTracePath();
+				for (const FString& Arg : Args)
+				{
+					FParse::Value(*Arg, TEXT("Output="), OutputPath);
+				}
+				FEasyUserInterfaceReplay::StopRecording(OutputPath);
+				return;
+			}
+
+			const ULocalPlayer* LocalPlayer = World ? World->GetFirstLocalPlayerFromController() : nullptr;
+			if (!LocalPlayer)
+			{
+				UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("Record: no local player found."));
+				return;
+			}
+			FEasyUserInterfaceReplay::StartRecording(*LocalPlayer);
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs ReplayCommand(
+		TEXT("EasyUI.Replay"),
+		TEXT("Replays a recorded User Interface trace on the first local player and writes the results as JSON.\n")
+		TEXT("Usage: EasyUI.Replay [Input=Path.euitrace] [Output=Path.json] [Timeout=30] [SettleFrames=60] [-Exit]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			const FEasyUserInterfaceReplayParams Params = FEasyUserInterfaceReplayParams::FromArgs(Args);
+			UEasyUserInterfaceManager* Manager = FindManager(World);
+			if (!Manager || !FEasyUserInterfaceReplay::StartReplay(*Manager, Params))
+			{
+				UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("Replay: could not start the replay."));
+				if (Params.bExitWhenDone)
+				{
+					FPlatformMisc::RequestExitWithStatus(false, 1);
+				}
+			}
+		}));
+#endif
+}
+
+FEasyUserInterfaceReplayParams FEasyUserInterfaceReplayParams::FromArgs(const TArray<FString>& Args)
+{
+	FEasyUserInterfaceReplayParams Params;
+	Params.InputPath = FEasyUserInterfaceReplay::GetDefaultTracePath();
+	for (const FString& Arg : Args)
+	{
+		FParse::Value(*Arg, TEXT("Input="), Params.InputPath);
+		FParse::Value(*Arg, TEXT("Output="), Params.OutputPath);
+		FParse::Value(*Arg, TEXT("Timeout="), Params.RootWidgetTimeout);
+		FParse::Value(*Arg, TEXT("SettleFrames="), Params.SettleFrames);
+		Params.bExitWhenDone |= Arg.Equals(TEXT("-Exit"), ESearchCase::IgnoreCase);
+	}
+	return Params;
+}
+
+bool FEasyUserInterfaceReplay::StartRecording(const ULocalPlayer& LocalPlayer)
+{
+	using namespace EasyUserInterfaceReplay;
+
+	if (bIsRecording || IsReplaying())
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Warning, TEXT("Cannot start recording, a recording or a replay is already in progress."));
+		return false;
+	}
+
+	RecordingSession = MakeUnique<FRecordingSession>();
+	RecordingSession->LocalPlayer = &LocalPlayer;
+	RecordingSession->StartFrame = GFrameCounter;
+	bIsRecording = true;
+
+	UE_LOG(LogEasyUserInterfaceManagement, Display, TEXT("Recording the User Interface operations of local player %d."), LocalPlayer.GetLocalPlayerIndex());
+	return true;
+}
+
+bool FEasyUserInterfaceReplay::StopRecording(const FString& OutputPath)
+{
+	using namespace EasyUserInterfaceReplay;
+
+	if (!bIsRecording)
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Warning, TEXT("Cannot stop recording, no recording in progress."));
+		return false;
+	}
+
+	const TUniquePtr<FRecordingSession> Session = MoveTemp(RecordingSession);
+	bIsRecording = false;
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes, true);
+	Session->Trace.Serialize(Writer);
+	if (!FFileHelper::SaveArrayToFile(Bytes, *OutputPath))
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("Failed to write the User Interface trace to %s"), *OutputPath);
+		return false;
+	}
+
+	UE_LOG(LogEasyUserInterfaceManagement, Display, TEXT("Recorded %d User Interface operation(s) (%d bytes) to %s"), Session->Trace.Records.Num(), Bytes.Num(), *OutputPath);
+	return true;
+}
+
+bool FEasyUserInterfaceReplay::StartReplay(UEasyUserInterfaceManager& Manager, const FEasyUserInterfaceReplayParams& Params)
+{
+	using namespace EasyUserInterfaceReplay;
+
+	if (bIsRecording || IsReplaying())
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Warning, TEXT("Cannot start the replay, a recording or a replay is already in progress."));
+		return false;
+	}
+
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Params.InputPath))
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("Failed to read the User Interface trace %s"), *Params.InputPath);
+		return false;
+	}
+
+	TUniquePtr<FReplaySession> Session = MakeUnique<FReplaySession>();
+	FMemoryReader Reader(Bytes, true);
+	if (!Session->Trace.Serialize(Reader))
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("%s is not a valid User Interface trace (version %d expected)."), *Params.InputPath, TraceVersion);
+		return false;
+	}
+
+	Session->Manager = &Manager;
+	Session->Params = Params;
+	Session->Deadline = FPlatformTime::Seconds() + Params.RootWidgetTimeout;
+
+	// Loaded up front so the operations are replayed at their frame, missing classes fail their operation
+	TArray<FSoftObjectPath> AssetPaths = Session->Trace.GetReferencedAssets();
+	if (!AssetPaths.IsEmpty())
+	{
+		Session->PreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(AssetPaths), FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+	}
+	Session->TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&TickReplay));
+	ReplaySession = MoveTemp(Session);
+
+	UE_LOG(LogEasyUserInterfaceManagement, Display, TEXT("Replaying %d User Interface operation(s) from %s"), ReplaySession->Trace.Records.Num(), *Params.InputPath);
+	return true;
+}
+
+bool FEasyUserInterfaceReplay::IsReplaying()
+{
+	return EasyUserInterfaceReplay::ReplaySession.IsValid();
+}
+
+FString FEasyUserInterfaceReplay::GetDefaultTracePath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyUI"), TEXT("Session.euitrace"));
+}
+
+FString FEasyUserInterfaceReplay::GetDefaultResultsPath()
+{
+	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyUI"), TEXT("Replay.json"));
+}
+
+void FEasyUserInterfaceReplay::RecordPushWidget(const ULocalPlayer* LocalPlayer, const FGameplayTag& LayerTag, const FSoftObjectPath& WidgetClass)
+{
+	using namespace EasyUserInterfaceReplay;
+
+	if (FRecord* Record = AddRecord(LocalPlayer, EEasyUserInterfaceReplayOperation::PushWidget))
+	{
+		Record->Tags.Add(AddString(LayerTag.ToString()));
+		Record->Class = AddString(WidgetClass.ToString());
+	}
+}
+
+void FEasyUserInterfaceReplay::RecordAddNotification(const ULocalPlayer* LocalPlayer, const FGameplayTagContainer& LayerTags,
+	const FSoftObjectPath& NotificationClass, const FEasyNotificationWidgetInfo& NotificationInfo)
+{
+	using namespace EasyUserInterfaceReplay;
+
+	if (FRecord* Record = AddRecord(LocalPlayer, EEasyUserInterfaceReplayOperation::AddNotification))
+	{
+		for (const FGameplayTag& LayerTag : LayerTags)
+		{
+			Record->Tags.Add(AddString(LayerTag.ToString()));
+		}
+		Record->Class = AddString(NotificationClass.ToString());
+		Record->Assets.Add(AddString(NotificationInfo.NotificationIcon.ToString()));
+		Record->Assets.Add(AddString(NotificationInfo.NotificationIconWidgetClass.ToString()));
+		Record->Texts = { NotificationInfo.NotificationHeader, NotificationInfo.NotificationBody };
+		Record->Duration = NotificationInfo.NotificationDuration;
+		Record->Flags = NotificationInfo.bCanBeManuallyDismissed ? Flag_CanBeManuallyDismissed : Flag_None;
+	}
+}
+
+void FEasyUserInterfaceReplay::RecordPushPrompt(const ULocalPlayer* LocalPlayer, const FGameplayTag& LayerTag, const UClass* PromptClass,
+	const FPromptQuestionBodyInfo& QuestionBodyInfo)
+{
+	using namespace EasyUserInterfaceReplay;
+
+	if (FRecord* Record = AddRecord(LocalPlayer, EEasyUserInterfaceReplayOperation::PushPrompt))
+	{
+		// Meta data and result executions are instanced objects, they are not part of the trace
+		Record->Tags.Add(AddString(LayerTag.ToString()));
+		Record->Class = AddString(GetPathNameSafe(PromptClass));
+		Record->Texts = { QuestionBodyInfo.QuestionHeaderText, QuestionBodyInfo.QuestionBodyText, QuestionBodyInfo.ConfirmButtonText, QuestionBodyInfo.CancelButtonText };
+		Record->Flags = QuestionBodyInfo.bDeactivateWidgetOnAnyResult ? Flag_DeactivateOnAnyResult : Flag_None;
+	}
+}
+
+void FEasyUserInterfaceReplay::RecordPromptAnswer(const UEasyPromptQuestion& Prompt, EPromptQuestionResult Result)
+{
+	using namespace EasyUserInterfaceReplay;
+
+	const ULocalPlayer* LocalPlayer = Prompt.GetOwningLocalPlayer();
+	const UEasyUserInterfaceRootWidget* RootWidget = FindRootWidget(LocalPlayer);
+	if (!RootWidget)
+	{
+		return;
+	}
+
+	if (FRecord* Record = AddRecord(LocalPlayer, EEasyUserInterfaceReplayOperation::PromptAnswer))
+	{
+		Record->Tags.Add(AddString(RootWidget->FindWidgetLayer(&Prompt).ToString()));
+		Record->Values[0] = static_cast<uint8>(Result);
+	}
+}
+
+void FEasyUserInterfaceReplay::RecordTabSelected(const UWidget& TabList, FName TabId)
+{
+	using namespace EasyUserInterfaceReplay;
+
+	const ULocalPlayer* LocalPlayer = TabList.GetOwningLocalPlayer();
+	const UEasyUserInterfaceRootWidget* RootWidget = FindRootWidget(LocalPlayer);
+	if (!RootWidget)
+	{
+		return;
+	}
+
+	// Tab lists outside of the registered layers can't be found back on replay
+	const FGameplayTag LayerTag = FindOwningLayer(TabList, *RootWidget);
+	if (!LayerTag.IsValid())
+	{
+		return;
+	}
+
+	if (FRecord* Record = AddRecord(LocalPlayer, EEasyUserInterfaceReplayOperation::TabSelected))
+	{
+		Record->Tags.Add(AddString(LayerTag.ToString()));
+		Record->Name = AddString(TabList.GetName());
+		Record->Id = AddString(TabId.ToString());
+	}
+}
+
+void FEasyUserInterfaceReplay::RecordInputModeChanged(const ULocalPlayer* LocalPlayer, ECommonInputMode InputMode, EMouseCaptureMode MouseCaptureMode, bool bHideMouse)
+{
+	using namespace EasyUserInterfaceReplay;
+
+	if (FRecord* Record = AddRecord(LocalPlayer, EEasyUserInterfaceReplayOperation::InputModeChanged))
+	{
+		Record->Values[0] = static_cast<uint8>(InputMode);
+		Record->Values[1] = static_cast<uint8>(MouseCaptureMode);
+		Record->Flags = bHideMouse ? Flag_HideMouse : Flag_None;
+	}
+}
@@ -0,0 +1,16 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSettings.h"
+
+UEasyUserInterfaceSettings::UEasyUserInterfaceSettings()
+{
+	bRefreshLocalizedTextOnCultureChange = true;
+	LocalizedTextRefreshWidgetsPerFrame = 32;
+	NotificationOverflowSummaryFormat = NSLOCTEXT("EasyUserInterfaceSettings", "NotificationOverflowSummaryFormat", "+{Count} more notifications");
+}
+
+FName UEasyUserInterfaceSettings::GetCategoryName() const
+{
+	return TEXT("Plugins");
+}
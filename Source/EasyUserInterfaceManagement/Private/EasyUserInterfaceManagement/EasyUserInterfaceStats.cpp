@@ -0,0 +1,256 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagement/EasyUserInterfaceStats.h"
+
+#include "Algo/BinarySearch.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+DEFINE_STAT(STAT_EasyUI_PushWidget_Construct);
+DEFINE_STAT(STAT_EasyUI_PushWidget_Activate);
+DEFINE_STAT(STAT_EasyUI_AddNotification_Construct);
+DEFINE_STAT(STAT_EasyUI_AddNotification_Activate);
+DEFINE_STAT(STAT_EasyUI_PushPrompt_Construct);
+DEFINE_STAT(STAT_EasyUI_PushPrompt_Activate);
+DEFINE_STAT(STAT_EasyUI_AddRootWidget_Construct);
+DEFINE_STAT(STAT_EasyUI_AddRootWidget_Activate);
+DEFINE_STAT(STAT_EasyUI_NotificationLifetimes);
+DEFINE_STAT(STAT_EasyUI_PendingLoads);
+DEFINE_STAT(STAT_EasyUI_PrefetchHits);
+DEFINE_STAT(STAT_EasyUI_PrefetchMisses);
+DEFINE_STAT(STAT_EasyUI_SyncLoads);
+DEFINE_STAT(STAT_EasyUI_CoalescedNotifications);
+DEFINE_STAT(STAT_EasyUI_RateLimitedNotifications);
+DEFINE_STAT(STAT_EasyUI_QueuedNotifications);
+
+CSV_DEFINE_CATEGORY(EasyUI, true);
+
+#if STATS
+
+#define EASYUI_DECLARE_LATENCY_STATS(Operation, Phase) \
+	DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT(#Operation " " #Phase " Min (ms)"), STAT_EasyUI_##Operation##_##Phase##_Min, STATGROUP_EasyUI); \
+	DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT(#Operation " " #Phase " Avg (ms)"), STAT_EasyUI_##Operation##_##Phase##_Avg, STATGROUP_EasyUI); \
+	DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT(#Operation " " #Phase " P95 (ms)"), STAT_EasyUI_##Operation##_##Phase##_P95, STATGROUP_EasyUI); \
+	DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT(#Operation " " #Phase " Max (ms)"), STAT_EasyUI_##Operation##_##Phase##_Max, STATGROUP_EasyUI);
+
+#define EASYUI_DECLARE_OPERATION_STATS(Operation) \
+	DECLARE_DWORD_ACCUMULATOR_STAT(TEXT(#Operation " Requests"), STAT_EasyUI_##Operation##_Requests, STATGROUP_EasyUI); \
+	EASYUI_DECLARE_LATENCY_STATS(Operation, LoadWait) \
+	EASYUI_DECLARE_LATENCY_STATS(Operation, Construct) \
+	EASYUI_DECLARE_LATENCY_STATS(Operation, Activate) \
+	EASYUI_DECLARE_LATENCY_STATS(Operation, Total)
+
+EASYUI_DECLARE_OPERATION_STATS(PushWidget)
+EASYUI_DECLARE_OPERATION_STATS(AddNotification)
+EASYUI_DECLARE_OPERATION_STATS(PushPrompt)
+EASYUI_DECLARE_OPERATION_STATS(AddRootWidget)
+
+#undef EASYUI_DECLARE_OPERATION_STATS
+#undef EASYUI_DECLARE_LATENCY_STATS
+
+#endif // STATS
+
+namespace EasyUserInterfaceStats
+{
+	constexpr int32 NumOperations = static_cast<int32>(EEasyUserInterfaceOperation::Num);
+	constexpr int32 NumPhases = static_cast<int32>(EEasyUserInterfaceLatencyPhase::Num);
+
+	/** Ring buffer of the recent samples of an operation phase, with the summary computed over it */
+	struct FLatencyHistory
+	{
+		TArray<float> Samples;
+		/** Same samples kept in ascending order, so a new sample does not sort the window again */
+		TArray<float> SortedSamples;
+		double SampleSum = 0.0;
+		int32 NextSampleIndex = 0;
+		FEasyUserInterfaceLatencySummary Summary;
+	};
+
+	struct FState
+	{
+		FLatencyHistory Histories[NumOperations][NumPhases];
+		int32 NumRequests[NumOperations] = {};
+	};
+
+	FState& GetState()
+	{
+		static FState State;
+		return State;
+	}
+
+#if STATS
+	struct FLatencyStatIds
+	{
+		TStatId Min;
+		TStatId Avg;
+		TStatId P95;
+		TStatId Max;
+	};
+
+#define EASYUI_LATENCY_STAT_IDS(Operation, Phase) \
+	FLatencyStatIds{ GET_STATID(STAT_EasyUI_##Operation##_##Phase##_Min), GET_STATID(STAT_EasyUI_##Operation##_##Phase##_Avg), \
+		GET_STATID(STAT_EasyUI_##Operation##_##Phase##_P95), GET_STATID(STAT_EasyUI_##Operation##_##Phase##_Max) }
+
+#define EASYUI_OPERATION_STAT_IDS(Operation) \
+	{ EASYUI_LATENCY_STAT_IDS(Operation, LoadWait), EASYUI_LATENCY_STAT_IDS(Operation, Construct), \
+		EASYUI_LATENCY_STAT_IDS(Operation, Activate), EASYUI_LATENCY_STAT_IDS(Operation, Total) }
+
+	const FLatencyStatIds& GetLatencyStatIds(int32 OperationIndex, int32 PhaseIndex)
+	{
+		static const FLatencyStatIds StatIds[NumOperations][NumPhases] =
+		{
+			EASYUI_OPERATION_STAT_IDS(PushWidget),
+			EASYUI_OPERATION_STAT_IDS(AddNotification),
+			EASYUI_OPERATION_STAT_IDS(PushPrompt),
+			EASYUI_OPERATION_STAT_IDS(AddRootWidget),
+		};
+		return StatIds[OperationIndex][PhaseIndex];
+	}
+
+	TStatId GetRequestsStatId(int32 OperationIndex)
+	{
+		static const TStatId StatIds[NumOperations] =
+		{
+			GET_STATID(STAT_EasyUI_PushWidget_Requests),
+			GET_STATID(STAT_EasyUI_AddNotification_Requests),
+			GET_STATID(STAT_EasyUI_PushPrompt_Requests),
+			GET_STATID(STAT_EasyUI_AddRootWidget_Requests),
+		};
+		return StatIds[OperationIndex];
+	}
+
+#undef EASYUI_OPERATION_STAT_IDS
+#undef EASYUI_LATENCY_STAT_IDS
+#endif // STATS
+
+#if CSV_PROFILER
+	FName GetCsvStatName(int32 OperationIndex, int32 PhaseIndex)
+	{
+		static FName StatNames[NumOperations][NumPhases];
+		FName& StatName = StatNames[OperationIndex][PhaseIndex];
+		if (StatName.IsNone())
+		{
+			StatName = FName(FString::Printf(TEXT("%s_%s"),
+				FEasyUserInterfaceStats::LexToString(static_cast<EEasyUserInterfaceOperation>(OperationIndex)),
+				FEasyUserInterfaceStats::LexToString(static_cast<EEasyUserInterfaceLatencyPhase>(PhaseIndex))));
+		}
+		return StatName;
+	}
+#endif // CSV_PROFILER
+
+	void AddSample(FLatencyHistory& History, float Sample)
+	{
+		// The replaced sample leaves the sorted window, the new one is inserted in place
+		if (History.Samples.Num() < FEasyUserInterfaceStats::SampleWindowSize)
+		{
+			History.Samples.Add(Sample);
+		}
+		else
+		{
+			float& ReplacedSample = History.Samples[History.NextSampleIndex];
+			History.SortedSamples.RemoveAt(Algo::LowerBound(History.SortedSamples, ReplacedSample));
+			History.SampleSum -= ReplacedSample;
+			ReplacedSample = Sample;
+		}
+		History.NextSampleIndex = (History.NextSampleIndex + 1) % FEasyUserInterfaceStats::SampleWindowSize;
+		History.SortedSamples.Insert(Sample, Algo::UpperBound(History.SortedSamples, Sample));
+		History.SampleSum += Sample;
+
+		const TArray<float>& SortedSamples = History.SortedSamples;
+		const int32 NumWindowSamples = SortedSamples.Num();
+		const int32 P95Index = FMath::Clamp(FMath::CeilToInt(0.95f * NumWindowSamples) - 1, 0, NumWindowSamples - 1);
+
+		History.Summary.Min = SortedSamples[0];
+		History.Summary.Max = SortedSamples.Last();
+		History.Summary.Avg = static_cast<float>(History.SampleSum / NumWindowSamples);
+		History.Summary.P95 = SortedSamples[P95Index];
+		++History.Summary.NumSamples;
+	}
+}
+
+void FEasyUserInterfaceStats::RecordLatency(EEasyUserInterfaceOperation Operation, EEasyUserInterfaceLatencyPhase Phase, double Seconds)
+{
+	check(IsInGameThread());
+
+	const int32 OperationIndex = static_cast<int32>(Operation);
+	const int32 PhaseIndex = static_cast<int32>(Phase);
+	const float Milliseconds = static_cast<float>(Seconds * 1000.0);
+
+	EasyUserInterfaceStats::FLatencyHistory& History = EasyUserInterfaceStats::GetState().Histories[OperationIndex][PhaseIndex];
+	EasyUserInterfaceStats::AddSample(History, Milliseconds);
+
+#if STATS
+	const EasyUserInterfaceStats::FLatencyStatIds& StatIds = EasyUserInterfaceStats::GetLatencyStatIds(OperationIndex, PhaseIndex);
+	SET_FLOAT_STAT_FName(StatIds.Min.GetName(), History.Summary.Min);
+	SET_FLOAT_STAT_FName(StatIds.Avg.GetName(), History.Summary.Avg);
+	SET_FLOAT_STAT_FName(StatIds.P95.GetName(), History.Summary.P95);
+	SET_FLOAT_STAT_FName(StatIds.Max.GetName(), History.Summary.Max);
+#endif
+
+#if CSV_PROFILER
+	// The per frame worst sample, CSV tools build the histograms from it
+	FCsvProfiler::RecordCustomStat(EasyUserInterfaceStats::GetCsvStatName(OperationIndex, PhaseIndex), CSV_CATEGORY_INDEX(EasyUI), Milliseconds, ECsvCustomStatOp::Max);
+#endif
+}
+
+void FEasyUserInterfaceStats::RecordRequest(EEasyUserInterfaceOperation Operation)
+{
+	check(IsInGameThread());
+
+	const int32 OperationIndex = static_cast<int32>(Operation);
+	++EasyUserInterfaceStats::GetState().NumRequests[OperationIndex];
+
+#if STATS
+	INC_DWORD_STAT_FName(EasyUserInterfaceStats::GetRequestsStatId(OperationIndex).GetName());
+#endif
+
+#if CSV_PROFILER
+	static const FName RequestsStatNames[EasyUserInterfaceStats::NumOperations] =
+	{
+		TEXT("PushWidget_Requests"),
+		TEXT("AddNotification_Requests"),
+		TEXT("PushPrompt_Requests"),
+		TEXT("AddRootWidget_Requests"),
+	};
+	FCsvProfiler::RecordCustomStat(RequestsStatNames[OperationIndex], CSV_CATEGORY_INDEX(EasyUI), 1, ECsvCustomStatOp::Accumulate);
+#endif
+}
+
+FEasyUserInterfaceLatencySummary FEasyUserInterfaceStats::GetLatencySummary(EEasyUserInterfaceOperation Operation, EEasyUserInterfaceLatencyPhase Phase)
+{
+	return EasyUserInterfaceStats::GetState().Histories[static_cast<int32>(Operation)][static_cast<int32>(Phase)].Summary;
+}
+
+int32 FEasyUserInterfaceStats::GetNumRequests(EEasyUserInterfaceOperation Operation)
+{
+	return EasyUserInterfaceStats::GetState().NumRequests[static_cast<int32>(Operation)];
+}
+
+void FEasyUserInterfaceStats::Reset()
+{
+	EasyUserInterfaceStats::GetState() = EasyUserInterfaceStats::FState();
+}
+
+const TCHAR* FEasyUserInterfaceStats::LexToString(EEasyUserInterfaceOperation Operation)
+{
+	switch (Operation)
+	{
+	case EEasyUserInterfaceOperation::PushWidget: return TEXT("PushWidget");
+	case EEasyUserInterfaceOperation::AddNotification: return TEXT("AddNotification");
+	case EEasyUserInterfaceOperation::PushPrompt: return TEXT("PushPrompt");
+	case EEasyUserInterfaceOperation::AddRootWidget: return TEXT("AddRootWidget");
+	default: return TEXT("Unknown");
+	}
+}
+
+const TCHAR* FEasyUserInterfaceStats::LexToString(EEasyUserInterfaceLatencyPhase Phase)
+{
+	switch (Phase)
+	{
+	case EEasyUserInterfaceLatencyPhase::LoadWait: return TEXT("LoadWait");
+	case EEasyUserInterfaceLatencyPhase::Construct: return TEXT("Construct");
+	case EEasyUserInterfaceLatencyPhase::Activate: return TEXT("Activate");
+	case EEasyUserInterfaceLatencyPhase::Total: return TEXT("Total");
+	default: return TEXT("Unknown");
+	}
+}
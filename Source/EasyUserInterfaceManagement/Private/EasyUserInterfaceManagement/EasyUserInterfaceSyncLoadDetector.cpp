@@ -0,0 +1,227 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSyncLoadDetector.h"
+
+#include "EasyUserInterfaceManagement.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceStats.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CoreDelegates.h"
+#include "UObject/UObjectGlobals.h"
+
+bool FEasyUserInterfaceSyncLoadDetector::bIsEnabled = false;
+
+namespace EasyUserInterfaceSyncLoadDetector
+{
+	/** Number of stalls kept for EasyUI.SyncLoads */
+	constexpr int32 MaxRecentDetections = 64;
+	/**
+	 * With the async loading thread, a sync load is a request flushed right away. A flush reported that soon after a sync
+	 * load is the sync load itself.
+	 */
+	constexpr double SyncLoadFlushWindowSeconds = 0.001;
+
+	struct FScope
+	{
+		FName WidgetClass;
+		const TCHAR* Operation;
+	};
+	TArray<FScope> Scopes;
+
+	struct FPendingDetection
+	{
+		FEasyUserInterfaceSyncLoad Detection;
+		double StartTime = 0.0;
+		/** Depth of the scope the stall happened in, it is timed until that scope ends */
+		int32 ScopeDepth = 0;
+	};
+	TArray<FPendingDetection> PendingDetections;
+	TArray<FEasyUserInterfaceSyncLoad> RecentDetections;
+
+	int32 NumSyncLoads = 0;
+	int32 NumFlushes = 0;
+	double LastSyncLoadTime = 0.0;
+	FDelegateHandle SyncLoadPackageHandle;
+	FDelegateHandle AsyncLoadingFlushHandle;
+
+	bool bDetectionRequested = false;
+#if !UE_BUILD_SHIPPING
+	FAutoConsoleVariableRef CVarSyncLoadDetection(
+		TEXT("EasyUI.SyncLoadDetection"),
+		bDetectionRequested,
+		TEXT("Reports the synchronous loads and async loading flushes happening while the plugin creates, constructs, activates, ticks or clicks a widget."),
+		FConsoleVariableDelegate::CreateLambda([](IConsoleVariable*)
+		{
+			FEasyUserInterfaceSyncLoadDetector::SetEnabled(bDetectionRequested);
+		}));
+
+	FAutoConsoleCommandWithWorldAndArgs SyncLoadsCommand(
+		TEXT("EasyUI.SyncLoads"),
+		TEXT("Lists the recent synchronous loads and flushes found by EasyUI.SyncLoadDetection, or resets the counters.\n")
+		TEXT("Usage: EasyUI.SyncLoads [Reset]"),
+		FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+		{
+			if (Args.Num() > 0 && Args[0].Equals(TEXT("Reset"), ESearchCase::IgnoreCase))
+			{
+				FEasyUserInterfaceSyncLoadDetector::Reset();
+				return;
+			}
+
+			if (!FEasyUserInterfaceSyncLoadDetector::IsEnabled())
+			{
+				UE_LOG(LogEasyUserInterfaceManagement, Warning, TEXT("SyncLoads: detection is disabled, enable it with EasyUI.SyncLoadDetection 1."));
+			}
+
+			for (const FEasyUserInterfaceSyncLoad& Detection : RecentDetections)
+			{
+				UE_LOG(LogEasyUserInterfaceManagement, Display, TEXT("SyncLoads: %-8s %6.2f ms  %s::%s  %s"), FEasyUserInterfaceSyncLoadDetector::LexToString(Detection.Kind),
+					Detection.Seconds * 1000.0, *Detection.WidgetClass.ToString(), Detection.Operation, *Detection.PackageName);
+			}
+			UE_LOG(LogEasyUserInterfaceManagement, Display, TEXT("SyncLoads: %d sync load(s) and %d flush(es) found on the User Interface paths."),
+				FEasyUserInterfaceSyncLoadDetector::GetNumSyncLoads(), FEasyUserInterfaceSyncLoadDetector::GetNumFlushes());
+		}));
+#endif
+}
+
+void FEasyUserInterfaceSyncLoadDetector::SetEnabled(bool bEnabled)
+{
+	using namespace EasyUserInterfaceSyncLoadDetector;
+
+	if (bIsEnabled == bEnabled)
+	{
+		return;
+	}
+
+	bIsEnabled = bEnabled;
+	bDetectionRequested = bEnabled;
+	if (bEnabled)
+	{
+		SyncLoadPackageHandle = FCoreUObjectDelegates::OnSyncLoadPackage.AddStatic(&FEasyUserInterfaceSyncLoadDetector::HandleSyncLoadPackage);
+		AsyncLoadingFlushHandle = FCoreDelegates::OnAsyncLoadingFlush.AddStatic(&FEasyUserInterfaceSyncLoadDetector::HandleAsyncLoadingFlush);
+	}
+	else
+	{
+		// The scopes already pushed pop themselves, so the stack stays balanced
+		FCoreUObjectDelegates::OnSyncLoadPackage.Remove(SyncLoadPackageHandle);
+		FCoreDelegates::OnAsyncLoadingFlush.Remove(AsyncLoadingFlushHandle);
+		SyncLoadPackageHandle.Reset();
+		AsyncLoadingFlushHandle.Reset();
+	}
+
+	UE_LOG(LogEasyUserInterfaceManagement, Display, TEXT("Sync load detection %s."), bEnabled ? TEXT("enabled") : TEXT("disabled"));
+}
+
+int32 FEasyUserInterfaceSyncLoadDetector::GetNumSyncLoads()
+{
+	return EasyUserInterfaceSyncLoadDetector::NumSyncLoads;
+}
+
+int32 FEasyUserInterfaceSyncLoadDetector::GetNumFlushes()
+{
+	return EasyUserInterfaceSyncLoadDetector::NumFlushes;
+}
+
+const TArray<FEasyUserInterfaceSyncLoad>& FEasyUserInterfaceSyncLoadDetector::GetRecentDetections()
+{
+	return EasyUserInterfaceSyncLoadDetector::RecentDetections;
+}
+
+void FEasyUserInterfaceSyncLoadDetector::Reset()
+{
+	EasyUserInterfaceSyncLoadDetector::NumSyncLoads = 0;
+	EasyUserInterfaceSyncLoadDetector::NumFlushes = 0;
+	EasyUserInterfaceSyncLoadDetector::RecentDetections.Empty();
+	SET_DWORD_STAT(STAT_EasyUI_SyncLoads, 0);
+}
+
+const TCHAR* FEasyUserInterfaceSyncLoadDetector::LexToString(EEasyUserInterfaceSyncLoadKind Kind)
+{
+	switch (Kind)
+	{
+	case EEasyUserInterfaceSyncLoadKind::SyncLoad: return TEXT("SyncLoad");
+	case EEasyUserInterfaceSyncLoadKind::Flush: return TEXT("Flush");
+	default: return TEXT("Unknown");
+	}
+}
+
+void FEasyUserInterfaceSyncLoadDetector::PushScope(const UClass* WidgetClass, const TCHAR* Operation)
+{
+	EasyUserInterfaceSyncLoadDetector::Scopes.Add({ WidgetClass ? WidgetClass->GetFName() : NAME_None, Operation });
+}
+
+void FEasyUserInterfaceSyncLoadDetector::PopScope()
+{
+	using namespace EasyUserInterfaceSyncLoadDetector;
+
+	if (!Scopes.IsEmpty())
+	{
+		FinishPendingDetections(Scopes.Num());
+		Scopes.Pop();
+	}
+}
+
+void FEasyUserInterfaceSyncLoadDetector::HandleSyncLoadPackage(const FString& PackageName)
+{
+	if (IsInGameThread() && !EasyUserInterfaceSyncLoadDetector::Scopes.IsEmpty())
+	{
+		EasyUserInterfaceSyncLoadDetector::LastSyncLoadTime = FPlatformTime::Seconds();
+		AddDetection(EEasyUserInterfaceSyncLoadKind::SyncLoad, PackageName);
+	}
+}
+
+void FEasyUserInterfaceSyncLoadDetector::HandleAsyncLoadingFlush()
+{
+	using namespace EasyUserInterfaceSyncLoadDetector;
+
+	if (IsInGameThread() && !Scopes.IsEmpty() && FPlatformTime::Seconds() - LastSyncLoadTime > SyncLoadFlushWindowSeconds)
+	{
+		AddDetection(EEasyUserInterfaceSyncLoadKind::Flush, FString());
+	}
+}
+
+void FEasyUserInterfaceSyncLoadDetector::AddDetection(EEasyUserInterfaceSyncLoadKind Kind, const FString& PackageName)
+{
+	using namespace EasyUserInterfaceSyncLoadDetector;
+
+	++(Kind == EEasyUserInterfaceSyncLoadKind::SyncLoad ? NumSyncLoads : NumFlushes);
+	INC_DWORD_STAT(STAT_EasyUI_SyncLoads);
+
+	// The load is about to start, it is timed until the plugin code it happened in returns
+	const FScope& Scope = Scopes.Last();
+	FPendingDetection& PendingDetection = PendingDetections.AddDefaulted_GetRef();
+	PendingDetection.Detection.Kind = Kind;
+	PendingDetection.Detection.PackageName = PackageName;
+	PendingDetection.Detection.WidgetClass = Scope.WidgetClass;
+	PendingDetection.Detection.Operation = Scope.Operation;
+	PendingDetection.StartTime = FPlatformTime::Seconds();
+	PendingDetection.ScopeDepth = Scopes.Num();
+}
+
+void FEasyUserInterfaceSyncLoadDetector::FinishPendingDetections(int32 ScopeDepth)
+{
+	using namespace EasyUserInterfaceSyncLoadDetector;
+
+	const double Now = FPlatformTime::Seconds();
+	for (int32 Index = 0; Index < PendingDetections.Num();)
+	{
+		if (PendingDetections[Index].ScopeDepth < ScopeDepth)
+		{
+			++Index;
+			continue;
+		}
+
+		FEasyUserInterfaceSyncLoad& Detection = PendingDetections[Index].Detection;
+		Detection.Seconds = Now - PendingDetections[Index].StartTime;
+		UE_LOG(LogEasyUserInterfaceManagement, Warning, TEXT("%s %s on the User Interface path, in %s::%s, blocked the game thread for up to %.2f ms"),
+			Detection.Kind == EEasyUserInterfaceSyncLoadKind::SyncLoad ? TEXT("Synchronous load of") : TEXT("Async loading flush"),
+			Detection.Kind == EEasyUserInterfaceSyncLoadKind::SyncLoad ? *Detection.PackageName : TEXT("(all pending requests)"),
+			*Detection.WidgetClass.ToString(), Detection.Operation, Detection.Seconds * 1000.0);
+
+		if (RecentDetections.Num() >= MaxRecentDetections)
+		{
+			RecentDetections.RemoveAt(0);
+		}
+		RecentDetections.Add(MoveTemp(Detection));
+		PendingDetections.RemoveAt(Index);
+	}
+}
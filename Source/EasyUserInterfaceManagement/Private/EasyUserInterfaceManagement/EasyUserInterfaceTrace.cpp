@@ -0,0 +1,149 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagement/EasyUserInterfaceTrace.h"
+
+#if EASYUI_TRACE_ENABLED
+
+#include "Blueprint/UserWidget.h"
+#include "Engine/LocalPlayer.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
+#include "ExtensionCommonUI/EasyUserInterfaceRootWidget.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+UE_TRACE_CHANNEL_DEFINE(EasyUIChannel);
+
+UE_TRACE_EVENT_BEGIN(EasyUI, LifecycleEvent)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint8, EventType)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, LayerTag)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, ClassName)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Detail)
+UE_TRACE_EVENT_END()
+
+namespace EasyUserInterfaceTrace
+{
+	FString MakeTimingEventName(EEasyUserInterfaceTraceEvent Event, const FString& LayerTag, const FString& ClassName)
+	{
+		return FString::Printf(TEXT("EasyUI.%s [%s] %s"), FEasyUserInterfaceTrace::LexToString(Event), *LayerTag, *ClassName);
+	}
+
+	FString MakeLoadRegionName(const FGameplayTag& LayerTag, const FSoftObjectPath& ClassPath)
+	{
+		return FString::Printf(TEXT("EasyUI.Load [%s] %s"), *LayerTag.ToString(), *ClassPath.GetAssetName());
+	}
+
+	void OutputLifecycleEvent(EEasyUserInterfaceTraceEvent Event, const FString& LayerTag, const FString& ClassName, const FString& Detail)
+	{
+		UE_TRACE_LOG(EasyUI, LifecycleEvent, EasyUIChannel)
+			<< LifecycleEvent.Cycle(FPlatformTime::Cycles64())
+			<< LifecycleEvent.EventType(static_cast<uint8>(Event))
+			<< LifecycleEvent.LayerTag(*LayerTag, LayerTag.Len())
+			<< LifecycleEvent.ClassName(*ClassName, ClassName.Len())
+			<< LifecycleEvent.Detail(*Detail, Detail.Len());
+	}
+}
+
+bool FEasyUserInterfaceTrace::IsEnabled()
+{
+	return UE_TRACE_CHANNELEXPR_IS_ENABLED(EasyUIChannel);
+}
+
+void FEasyUserInterfaceTrace::OutputEvent(EEasyUserInterfaceTraceEvent Event, const FGameplayTag& LayerTag, const UClass* Class, const FString& Detail)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	const FString LayerString = LayerTag.ToString();
+	const FString ClassName = GetNameSafe(Class);
+	EasyUserInterfaceTrace::OutputLifecycleEvent(Event, LayerString, ClassName, Detail);
+
+	// An instant timing event, so it is visible on the timeline
+	if (UE_TRACE_CHANNELEXPR_IS_ENABLED(CpuChannel))
+	{
+		FCpuProfilerTrace::OutputBeginDynamicEvent(*EasyUserInterfaceTrace::MakeTimingEventName(Event, LayerString, ClassName));
+		FCpuProfilerTrace::OutputEndEvent();
+	}
+}
+
+void FEasyUserInterfaceTrace::OutputLoadStarted(const FGameplayTag& LayerTag, const FSoftObjectPath& ClassPath)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	EasyUserInterfaceTrace::OutputLifecycleEvent(EEasyUserInterfaceTraceEvent::LoadStarted, LayerTag.ToString(), ClassPath.GetAssetName(), ClassPath.ToString());
+	FMiscTrace::OutputBeginRegion(*EasyUserInterfaceTrace::MakeLoadRegionName(LayerTag, ClassPath));
+}
+
+void FEasyUserInterfaceTrace::OutputLoadFinished(const FGameplayTag& LayerTag, const FSoftObjectPath& ClassPath, bool bSucceeded)
+{
+	if (!IsEnabled())
+	{
+		return;
+	}
+
+	EasyUserInterfaceTrace::OutputLifecycleEvent(EEasyUserInterfaceTraceEvent::LoadFinished, LayerTag.ToString(), ClassPath.GetAssetName(), bSucceeded ? TEXT("Succeeded") : TEXT("Failed"));
+	FMiscTrace::OutputEndRegion(*EasyUserInterfaceTrace::MakeLoadRegionName(LayerTag, ClassPath));
+}
+
+FGameplayTag FEasyUserInterfaceTrace::FindWidgetLayer(const UUserWidget& Widget)
+{
+	const ULocalPlayer* LocalPlayer = Widget.GetOwningLocalPlayer();
+	const UEasyUserInterfaceManager* Manager = LocalPlayer ? LocalPlayer->GetSubsystem<UEasyUserInterfaceManager>() : nullptr;
+	if (Manager && Manager->IsRootWidgetReady())
+	{
+		return Manager->RootWidget->FindWidgetLayer(&Widget);
+	}
+	return FGameplayTag();
+}
+
+const TCHAR* FEasyUserInterfaceTrace::LexToString(EEasyUserInterfaceTraceEvent Event)
+{
+	switch (Event)
+	{
+	case EEasyUserInterfaceTraceEvent::LoadStarted: return TEXT("LoadStarted");
+	case EEasyUserInterfaceTraceEvent::LoadFinished: return TEXT("LoadFinished");
+	case EEasyUserInterfaceTraceEvent::Construct: return TEXT("Construct");
+	case EEasyUserInterfaceTraceEvent::Activate: return TEXT("Activate");
+	case EEasyUserInterfaceTraceEvent::Deactivate: return TEXT("Deactivate");
+	case EEasyUserInterfaceTraceEvent::Destruct: return TEXT("Destruct");
+	case EEasyUserInterfaceTraceEvent::NotificationAdded: return TEXT("NotificationAdded");
+	case EEasyUserInterfaceTraceEvent::NotificationDismissed: return TEXT("NotificationDismissed");
+	case EEasyUserInterfaceTraceEvent::PromptResult: return TEXT("PromptResult");
+	case EEasyUserInterfaceTraceEvent::InputModeChanged: return TEXT("InputModeChanged");
+	default: return TEXT("Unknown");
+	}
+}
+
+FEasyUserInterfaceTraceWidgetScope::FEasyUserInterfaceTraceWidgetScope(EEasyUserInterfaceTraceEvent Event, const UUserWidget& Widget)
+{
+	if (!FEasyUserInterfaceTrace::IsEnabled())
+	{
+		return;
+	}
+
+	const FString LayerString = FEasyUserInterfaceTrace::FindWidgetLayer(Widget).ToString();
+	const FString ClassName = Widget.GetClass()->GetName();
+	EasyUserInterfaceTrace::OutputLifecycleEvent(Event, LayerString, ClassName, Widget.GetName());
+
+	if (UE_TRACE_CHANNELEXPR_IS_ENABLED(CpuChannel))
+	{
+		FCpuProfilerTrace::OutputBeginDynamicEvent(*EasyUserInterfaceTrace::MakeTimingEventName(Event, LayerString, ClassName));
+		bHasTimingEvent = true;
+	}
+}
+
+FEasyUserInterfaceTraceWidgetScope::~FEasyUserInterfaceTraceWidgetScope()
+{
+	if (bHasTimingEvent)
+	{
+		FCpuProfilerTrace::OutputEndEvent();
+	}
+}
+
+#endif // EASYUI_TRACE_ENABLED
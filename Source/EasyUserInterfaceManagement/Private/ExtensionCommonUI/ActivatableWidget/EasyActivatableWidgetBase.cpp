@@ -4,6 +4,11 @@
 #include "ExtensionCommonUI/ActivatableWidget/EasyActivatableWidgetBase.h"
 
 #include "EasyUserInterfaceManagement/EasyCommonUIActionRouter.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceCostStats.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSettings.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSyncLoadDetector.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceTrace.h"
 #include "Editor/WidgetCompilerLog.h"
 #include "Input/CommonUIInputTypes.h"
 
@@ -22,13 +27,30 @@ void UEasyActivatableWidgetBase::ValidateCompiledWidgetTree(const UWidgetTree& B
 }
 #endif
 
+FEasyActivatableWidgetBudget UEasyActivatableWidgetBase::GetEffectivePerformanceBudget() const
+{
+	return PerformanceBudget.WithFallback(UEasyUserInterfaceSettings::Get()->DefaultScreenBudget);
+}
+
 void UEasyActivatableWidgetBase::NativeConstruct()
 {
+	EASYUI_TRACE_WIDGET_SCOPE(Construct, *this);
+	FEasyUserInterfaceSyncLoadScope SyncLoadScope(GetClass(), TEXT("NativeConstruct"));
 	Super::NativeConstruct();
 }
 
 void UEasyActivatableWidgetBase::NativeDestruct()
 {
+	EASYUI_TRACE_WIDGET_SCOPE(Destruct, *this);
+
+	// The action router goes away with the game, no need to unregister one by one
+	if (UEasyUserInterfaceManager::IsUserInterfaceShuttingDown())
+	{
+		BindingHandles.Empty();
+		Super::NativeDestruct();
+		return;
+	}
+
 	for (FUIActionBindingHandle Handle : BindingHandles)
 	{
 		if (Handle.IsValid())
@@ -41,8 +63,17 @@ void UEasyActivatableWidgetBase::NativeDestruct()
 	Super::NativeDestruct();
 }
 
+void UEasyActivatableWidgetBase::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	FEasyUserInterfaceCostScope CostScope(FEasyUserInterfaceCostStats::IsEnabled() ? GetClass()->GetFName() : NAME_None, NAME_None, EEasyUserInterfaceCostPhase::Tick);
+	FEasyUserInterfaceSyncLoadScope SyncLoadScope(GetClass(), TEXT("NativeTick"));
+	Super::NativeTick(MyGeometry, InDeltaTime);
+}
+
 void UEasyActivatableWidgetBase::NativeOnActivated()
 {
+	EASYUI_TRACE_WIDGET_SCOPE(Activate, *this);
+	FEasyUserInterfaceSyncLoadScope SyncLoadScope(GetClass(), TEXT("NativeOnActivated"));
 	Super::NativeOnActivated();
 	RegisterDefaultInputs();
 
@@ -55,6 +86,15 @@ void UEasyActivatableWidgetBase::NativeOnActivated()
 
 void UEasyActivatableWidgetBase::NativeOnDeactivated()
 {
+	EASYUI_TRACE_WIDGET_SCOPE(Deactivate, *this);
+
+	if (UEasyUserInterfaceManager::IsUserInterfaceShuttingDown())
+	{
+		BindingHandles.Empty();
+		Super::NativeOnDeactivated();
+		return;
+	}
+
 	UnregisterAllBindings();
 	if (IsValid(GetOwningLocalPlayer()) && GetOwningLocalPlayer()->GetSubsystem<UEasyCommonUIActionRouter>())
 	{
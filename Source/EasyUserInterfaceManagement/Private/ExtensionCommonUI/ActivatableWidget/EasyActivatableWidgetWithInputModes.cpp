@@ -5,8 +5,88 @@
 
 #include "Editor/WidgetCompilerLog.h"
 
+#if WITH_EDITOR
+#include "Blueprint/WidgetBlueprintGeneratedClass.h"
+#include "Blueprint/WidgetTree.h"
+#include "Components/PanelWidget.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSettings.h"
+#include "UObject/UnrealType.h"
+#endif
+
 #define LOCTEXT_NAMESPACE "EasyActivatableWidgetWithInputModes"
 
+#if WITH_EDITOR
+namespace EasyWidgetPerformanceLinter
+{
+	/** Instanced objects (button actions, input mode sets) are searched up to this depth */
+	constexpr int32 MaxInstancedObjectDepth = 4;
+
+	int32 GetWidgetTreeDepth(const UWidget* Widget)
+	{
+		int32 MaxChildDepth = 0;
+		if (const UPanelWidget* PanelWidget = Cast<UPanelWidget>(Widget))
+		{
+			for (const UWidget* Child : PanelWidget->GetAllChildren())
+			{
+				MaxChildDepth = FMath::Max(MaxChildDepth, GetWidgetTreeDepth(Child));
+			}
+		}
+		return Widget ? MaxChildDepth + 1 : 0;
+	}
+
+	/** Warns about the hard references of an object to heavy assets and to widget classes that could be soft */
+	void ValidateHardReferences(const UObject& Object, const FString& OwnerName, const UPackage* WidgetPackage, IWidgetCompilerLog& CompileLog, int32 Depth)
+	{
+		const int64 HeavyAssetBytes = static_cast<int64>(UEasyUserInterfaceSettings::Get()->LinterHeavyAssetSizeKB * 1024.0f);
+
+		for (TPropertyValueIterator<FObjectPropertyBase> It(Object.GetClass(), &Object, EPropertyValueIteratorFlags::FullRecursion, EFieldIteratorFlags::ExcludeDeprecated); It; ++It)
+		{
+			// Soft and weak references do not keep their target loaded
+			const FObjectPropertyBase* Property = It.Key();
+			if (!Property->IsA<FObjectProperty>())
+			{
+				continue;
+			}
+
+			const UObject* Referenced = Property->GetObjectPropertyValue(It.Value());
+			if (!Referenced)
+			{
+				continue;
+			}
+
+			if (Property->HasAnyPropertyFlags(CPF_InstancedReference | CPF_PersistentInstance) || Referenced->IsIn(&Object))
+			{
+				if (Depth < MaxInstancedObjectDepth)
+				{
+					ValidateHardReferences(*Referenced, FString::Printf(TEXT("%s.%s"), *OwnerName, *Property->GetName()), WidgetPackage, CompileLog, Depth + 1);
+				}
+				continue;
+			}
+
+			if (Referenced->GetOutermost() == WidgetPackage || Referenced->GetOutermost()->HasAnyPackageFlags(PKG_CompiledIn))
+			{
+				continue;
+			}
+
+			const UClass* ReferencedClass = Cast<UClass>(Referenced);
+			if (ReferencedClass && ReferencedClass->IsChildOf<UUserWidget>())
+			{
+				CompileLog.Warning(FText::Format(LOCTEXT("LintHardClassReference", "{0}.{1} hard references the widget class {2}, which is loaded with this widget. Use a TSoftClassPtr if it is only created on demand."),
+					FText::FromString(OwnerName), FText::FromString(Property->GetName()), FText::FromString(ReferencedClass->GetName())));
+				continue;
+			}
+
+			const int64 ResourceBytes = Referenced->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+			if (HeavyAssetBytes > 0 && ResourceBytes >= HeavyAssetBytes)
+			{
+				CompileLog.Warning(FText::Format(LOCTEXT("LintHeavyAssetReference", "{0}.{1} hard references {2} ({3} KB), which is loaded with this widget. Use a soft reference and load it asynchronously."),
+					FText::FromString(OwnerName), FText::FromString(Property->GetName()), FText::FromString(Referenced->GetName()), FText::AsNumber(ResourceBytes / 1024)));
+			}
+		}
+	}
+}
+#endif
+
 UEasyActivatableWidgetWithInputModes::UEasyActivatableWidgetWithInputModes(FObjectInitializer const& ObjectInitializer)
 {
 	InputModeSet = ObjectInitializer.CreateDefaultSubobject<UUserInterfaceCommonInputModeSet>(this, TEXT("InputModeSet"));
@@ -28,6 +108,11 @@ void UEasyActivatableWidgetWithInputModes::ValidateCompiledWidgetTree(const UWid
 {
 	Super::ValidateCompiledWidgetTree(BlueprintWidgetTree, CompileLog);
 
+	if (UEasyUserInterfaceSettings::Get()->bEnablePerformanceLinter)
+	{
+		ValidateWidgetPerformance(BlueprintWidgetTree, CompileLog);
+	}
+
 	if (!bShowInputDebugMessages)
 	{
 		return;
@@ -41,6 +126,61 @@ void UEasyActivatableWidgetWithInputModes::ValidateCompiledWidgetTree(const UWid
 		CompileLog.Note(LOCTEXT("ValidateGetDesiredFocusTarget_Note", "GetDesiredFocusTarget wasn't implemented, you're going to have trouble using gamepads on this screen.  If it was implemented in the native base class you can ignore this message."));
 	}
 }
+
+void UEasyActivatableWidgetWithInputModes::ValidateWidgetPerformance(const UWidgetTree& BlueprintWidgetTree, IWidgetCompilerLog& CompileLog) const
+{
+	const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+
+	// Property bindings are polled every frame the widget is visible, whether their value changed or not
+	if (const UWidgetBlueprintGeneratedClass* WidgetClass = Cast<UWidgetBlueprintGeneratedClass>(GetClass()))
+	{
+		for (const FDelegateRuntimeBinding& Binding : WidgetClass->Bindings)
+		{
+			CompileLog.Warning(FText::Format(LOCTEXT("LintPropertyBinding", "{0}.{1} is bound to {2}, which is evaluated every frame. Set the property when its value changes instead."),
+				FText::FromString(Binding.ObjectName), FText::FromName(Binding.PropertyName), FText::FromName(Binding.FunctionName)));
+		}
+	}
+
+	if (GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UUserWidget, Tick)))
+	{
+		CompileLog.Warning(LOCTEXT("LintTick", "Event Tick is implemented, this widget ticks every frame while it is visible. Prefer events or timers."));
+	}
+
+	int32 NumWidgets = 0;
+	BlueprintWidgetTree.ForEachWidget([this, &NumWidgets, &CompileLog](UWidget* Widget)
+	{
+		++NumWidgets;
+		if (Widget->bIsVolatile)
+		{
+			CompileLog.Warning(FText::Format(LOCTEXT("LintVolatile", "{0} is volatile, its layout and paint are never cached."), FText::FromString(Widget->GetName())));
+		}
+
+		const UUserWidget* UserWidget = Cast<UUserWidget>(Widget);
+		if (UserWidget && UserWidget->GetClass()->IsFunctionImplementedInScript(GET_FUNCTION_NAME_CHECKED(UUserWidget, Tick)))
+		{
+			CompileLog.Warning(FText::Format(LOCTEXT("LintChildTick", "{0} ({1}) implements Event Tick and ticks every frame while this widget is visible."),
+				FText::FromString(Widget->GetName()), FText::FromString(UserWidget->GetClass()->GetName())));
+		}
+
+		EasyWidgetPerformanceLinter::ValidateHardReferences(*Widget, Widget->GetName(), GetOutermost(), CompileLog, 0);
+	});
+
+	if (NumWidgets > Settings->LinterMaxWidgetCount)
+	{
+		CompileLog.Warning(FText::Format(LOCTEXT("LintWidgetCount", "The widget tree has {0} widgets (limit {1}). Split it into lazily created parts or use list views."),
+			FText::AsNumber(NumWidgets), FText::AsNumber(Settings->LinterMaxWidgetCount)));
+	}
+
+	const int32 TreeDepth = EasyWidgetPerformanceLinter::GetWidgetTreeDepth(BlueprintWidgetTree.RootWidget);
+	if (TreeDepth > Settings->LinterMaxWidgetTreeDepth)
+	{
+		CompileLog.Warning(FText::Format(LOCTEXT("LintTreeDepth", "The widget tree is {0} levels deep (limit {1}). Deep trees make every prepass and arrange pass slower."),
+			FText::AsNumber(TreeDepth), FText::AsNumber(Settings->LinterMaxWidgetTreeDepth)));
+	}
+
+	// Default inputs and the input mode set of the widget itself
+	EasyWidgetPerformanceLinter::ValidateHardReferences(*this, GetClass()->GetName(), GetOutermost(), CompileLog, 0);
+}
 #endif
 
 #undef LOCTEXT_NAMESPACE
\ No newline at end of file
@@ -4,6 +4,14 @@
 #include "ExtensionCommonUI/EasyUserInterfaceRootWidget.h"
 
 #include "EasyUserInterfaceManagement.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceCostStats.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceLeakTracker.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceMemory.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceReplay.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceStats.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSyncLoadDetector.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceTrace.h"
+#include "ExtensionCommonUI/LayerPanel/EasyUserInterfaceLayerPanel.h"
 #include "Engine/AssetManager.h"
 #include "Engine/StreamableManager.h"
 #include "ExtensionCommonUI/Notification/EasyNotificationWidget.h"
@@ -18,12 +26,39 @@ UEasyUserInterfaceRootWidget::UEasyUserInterfaceRootWidget()
 void UEasyUserInterfaceRootWidget::NativeConstruct()
 {
 	Super::NativeConstruct();
+
+	// The cost owners of the layers are only tracked while the attribution is on
+	FEasyUserInterfaceCostStats::OnEnabledChanged().AddUObject(this, &UEasyUserInterfaceRootWidget::UpdateLayerPanelIdleStates);
+}
+
+void UEasyUserInterfaceRootWidget::NativeDestruct()
+{
+	FEasyUserInterfaceCostStats::OnEnabledChanged().RemoveAll(this);
+
+	Super::NativeDestruct();
 }
 
 void UEasyUserInterfaceRootWidget::RegisterWidgetStack(FGameplayTag LayerTag,
                                                        UCommonActivatableWidgetStack* WidgetClass)
 {
+	if (UCommonActivatableWidgetStack* PreviousStack = WidgetStacks.FindRef(LayerTag))
+	{
+		PreviousStack->OnDisplayedWidgetChanged().RemoveAll(this);
+		PreviousStack->OnTransitioningChanged().RemoveAll(this);
+	}
+
 	WidgetStacks.Add(LayerTag, WidgetClass);
+
+	FEasyUserInterfaceLayerState& LayerState = LayerStates.Add(LayerTag);
+	if (WidgetClass)
+	{
+		LayerState.TopWidget = WidgetClass->GetActiveWidget();
+		LayerState.NumWidgets = WidgetClass->GetNumWidgets();
+		WidgetClass->OnDisplayedWidgetChanged().AddUObject(this, &UEasyUserInterfaceRootWidget::HandleDisplayedWidgetChanged, LayerTag);
+		WidgetClass->OnTransitioningChanged().AddUObject(this, &UEasyUserInterfaceRootWidget::HandleTransitioningChanged, LayerTag);
+	}
+
+	UpdateLayerPanelIdleStates();
 }
 
 void UEasyUserInterfaceRootWidget::PushWidgetToStackAsync(FGameplayTag LayerTag,
@@ -52,22 +87,62 @@ void UEasyUserInterfaceRootWidget::PushWidgetToStackAsync(FGameplayTag LayerTag,
 	UCommonActivatableWidgetStack* WidgetStack = *FoundStackPtr;
 
 	LoadingWidgetParams = FPushWidgetToStackAsyncParams(LayerTag, WidgetClass);
+
+	if (FEasyUserInterfaceReplay::IsRecording())
+	{
+		FEasyUserInterfaceReplay::RecordPushWidget(GetOwningLocalPlayer(), LayerTag, WidgetClass.ToSoftObjectPath());
+	}
+
+	FEasyUserInterfaceStats::RecordRequest(EEasyUserInterfaceOperation::PushWidget);
+	INC_DWORD_STAT(STAT_EasyUI_PendingLoads);
+	EASYUI_TRACE_LOAD_STARTED(LayerTag, WidgetClass.ToSoftObjectPath());
+	const double RequestTime = FPlatformTime::Seconds();
+	PendingLoads.Emplace(LayerTag, WidgetClass.ToSoftObjectPath(), RequestTime);
 	
 	FStreamableManager& Streamable = UAssetManager::GetStreamableManager();
 	Streamable.RequestAsyncLoad(
 		WidgetClass.ToSoftObjectPath(),
 		FStreamableDelegate::CreateWeakLambda(
 			this,
-			[this, WidgetClass, WidgetStack, LayerTag, OnWidgetAdded]()
+			[this, WidgetClass, WidgetStack, LayerTag, OnWidgetAdded, RequestTime]()
 			{
+				DEC_DWORD_STAT(STAT_EasyUI_PendingLoads);
+				PendingLoads.RemoveSingle(FEasyUserInterfacePendingLoad(LayerTag, WidgetClass.ToSoftObjectPath(), RequestTime));
+				const double LoadedTime = FPlatformTime::Seconds();
+				FEasyUserInterfaceStats::RecordLatency(EEasyUserInterfaceOperation::PushWidget, EEasyUserInterfaceLatencyPhase::LoadWait, LoadedTime - RequestTime);
+
 				UClass* LoadedClass = WidgetClass.Get();
+				EASYUI_TRACE_LOAD_FINISHED(LayerTag, WidgetClass.ToSoftObjectPath(), LoadedClass != nullptr);
 				if (!LoadedClass)
 				{
 					LoadingWidgetParams.Reset();
 					UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("[%s] Widget class failed to load."), *GetName());
 					return;
 				}
-				UCommonActivatableWidget* WidgetAdded = WidgetStack->AddWidget(LoadedClass);
+
+				// The stack creates (or reuses) the widget before adding it, the init callback splits both phases
+				LLM_SCOPE_BYTAG(EasyUI_Widgets);
+				FEasyUserInterfaceSyncLoadScope SyncLoadScope(LoadedClass, TEXT("PushWidgetToStackAsync"));
+				double ConstructedTime = LoadedTime;
+				TOptional<FScopeCycleCounter> PhaseCycleCounter;
+				PhaseCycleCounter.Emplace(GET_STATID(STAT_EasyUI_PushWidget_Construct));
+				UCommonActivatableWidget* WidgetAdded = WidgetStack->AddWidget<UCommonActivatableWidget>(LoadedClass, [&ConstructedTime, &PhaseCycleCounter](UCommonActivatableWidget&)
+				{
+					PhaseCycleCounter.Reset();
+					PhaseCycleCounter.Emplace(GET_STATID(STAT_EasyUI_PushWidget_Activate));
+					ConstructedTime = FPlatformTime::Seconds();
+				});
+				PhaseCycleCounter.Reset();
+				if (WidgetAdded && FEasyUserInterfaceLeakTracker::IsTracking())
+				{
+					FEasyUserInterfaceLeakTracker::TrackWidget(*WidgetAdded, this);
+				}
+
+				const double ActivatedTime = FPlatformTime::Seconds();
+				FEasyUserInterfaceStats::RecordLatency(EEasyUserInterfaceOperation::PushWidget, EEasyUserInterfaceLatencyPhase::Construct, ConstructedTime - LoadedTime);
+				FEasyUserInterfaceStats::RecordLatency(EEasyUserInterfaceOperation::PushWidget, EEasyUserInterfaceLatencyPhase::Activate, ActivatedTime - ConstructedTime);
+				FEasyUserInterfaceStats::RecordLatency(EEasyUserInterfaceOperation::PushWidget, EEasyUserInterfaceLatencyPhase::Total, ActivatedTime - RequestTime);
+
 				OnWidgetAdded.ExecuteIfBound(LayerTag, WidgetAdded);
 				LoadingWidgetParams.Reset();
 			}
@@ -75,16 +150,210 @@ void UEasyUserInterfaceRootWidget::PushWidgetToStackAsync(FGameplayTag LayerTag,
 	);
 }
 
+bool UEasyUserInterfaceRootWidget::RemoveWidgetFromStack(FGameplayTag LayerTag, UCommonActivatableWidget* Widget)
+{
+	UCommonActivatableWidgetStack* WidgetStack = FindWidgetStack(LayerTag);
+	if (!WidgetStack || !Widget || !WidgetStack->GetWidgetList().Contains(Widget))
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Warning, TEXT("[%s] Widget %s is not on the stack of LayerTag: %s"), *GetName(), *GetNameSafe(Widget), *LayerTag.ToString());
+		return false;
+	}
+
+	WidgetStack->RemoveWidget(*Widget);
+	return true;
+}
+
 UCommonActivatableWidgetStack* UEasyUserInterfaceRootWidget::GetWidgetStack(const FGameplayTag& LayerTag) const
 {
-	if (!WidgetStacks.Contains(LayerTag))
+	UCommonActivatableWidgetStack* const* FoundStackPtr = WidgetStacks.Find(LayerTag);
+	if (!FoundStackPtr)
 	{
 		UE_LOG(LogEasyUserInterfaceManagement, Warning, TEXT("GetWidgetStack: Layer not found"));
 		return nullptr;
 	}
 
-	UCommonActivatableWidgetStack* WidgetStack = WidgetStacks[LayerTag];
-	return WidgetStack;
+	return *FoundStackPtr;
+}
+
+UCommonActivatableWidgetStack* UEasyUserInterfaceRootWidget::FindWidgetStack(const FGameplayTag& LayerTag) const
+{
+	return WidgetStacks.FindRef(LayerTag);
+}
+
+TArray<FGameplayTag> UEasyUserInterfaceRootWidget::GetRegisteredStackLayers() const
+{
+	TArray<FGameplayTag> LayerTags;
+	WidgetStacks.GenerateKeyArray(LayerTags);
+	return LayerTags;
+}
+
+FGameplayTag UEasyUserInterfaceRootWidget::FindWidgetLayer(const UUserWidget* Widget) const
+{
+	if (!Widget)
+	{
+		return FGameplayTag();
+	}
+
+	if (const UCommonActivatableWidget* ActivatableWidget = Cast<UCommonActivatableWidget>(Widget))
+	{
+		for (const TPair<FGameplayTag, UCommonActivatableWidgetStack*>& StackPair : WidgetStacks)
+		{
+			if (StackPair.Value && StackPair.Value->GetWidgetList().Contains(ActivatableWidget))
+			{
+				return StackPair.Key;
+			}
+		}
+	}
+
+	for (const TPair<FGameplayTag, TArray<TWeakObjectPtr<UEasyNotificationWidget>>>& NotificationPair : ActiveNotifications)
+	{
+		for (const TWeakObjectPtr<UEasyNotificationWidget>& Notification : NotificationPair.Value)
+		{
+			if (Notification.Get() == Widget)
+			{
+				return NotificationPair.Key;
+			}
+		}
+	}
+
+	return FGameplayTag();
+}
+
+void UEasyUserInterfaceRootWidget::GetLayerWidgets(const FGameplayTag& LayerTag, TArray<UUserWidget*>& OutWidgets) const
+{
+	if (const UCommonActivatableWidgetStack* Stack = WidgetStacks.FindRef(LayerTag))
+	{
+		OutWidgets.Append(Stack->GetWidgetList());
+	}
+
+	if (const TArray<TWeakObjectPtr<UEasyNotificationWidget>>* LayerNotifications = ActiveNotifications.Find(LayerTag))
+	{
+		for (const TWeakObjectPtr<UEasyNotificationWidget>& Notification : *LayerNotifications)
+		{
+			if (UEasyNotificationWidget* NotificationWidget = Notification.Get())
+			{
+				OutWidgets.Add(NotificationWidget);
+			}
+		}
+	}
+}
+
+void UEasyUserInterfaceRootWidget::HandleDisplayedWidgetChanged(UCommonActivatableWidget* DisplayedWidget, FGameplayTag LayerTag)
+{
+	const UCommonActivatableWidgetStack* WidgetStack = FindWidgetStack(LayerTag);
+	FEasyUserInterfaceLayerState& LayerState = LayerStates.FindOrAdd(LayerTag);
+
+	UCommonActivatableWidget* PreviousTopWidget = LayerState.TopWidget.Get();
+	const int32 PreviousNumWidgets = LayerState.NumWidgets;
+
+	LayerState.TopWidget = DisplayedWidget;
+	LayerState.NumWidgets = WidgetStack ? WidgetStack->GetNumWidgets() : 0;
+
+	// The stack only reports its displayed widget, the widget count tells whether it was a push or a pop
+	if (LayerState.NumWidgets > PreviousNumWidgets && DisplayedWidget)
+	{
+		LayerWidgetPushedEvent.Broadcast(LayerTag, DisplayedWidget);
+	}
+	else if (LayerState.NumWidgets < PreviousNumWidgets && PreviousTopWidget)
+	{
+		LayerWidgetPoppedEvent.Broadcast(LayerTag, PreviousTopWidget);
+	}
+
+	if (PreviousTopWidget != DisplayedWidget)
+	{
+		LayerTopWidgetChangedEvent.Broadcast(LayerTag, DisplayedWidget);
+	}
+
+	UpdateLayerPanelIdleStates();
+}
+
+void UEasyUserInterfaceRootWidget::HandleTransitioningChanged(UCommonActivatableWidgetContainerBase* Container, bool bIsTransitioning, FGameplayTag LayerTag)
+{
+	FEasyUserInterfaceLayerState& LayerState = LayerStates.FindOrAdd(LayerTag);
+	if (LayerState.bIsTransitioning != bIsTransitioning)
+	{
+		LayerState.bIsTransitioning = bIsTransitioning;
+		UpdateLayerPanelIdleStates();
+	}
+}
+
+void UEasyUserInterfaceRootWidget::UpdateLayerPanelIdleStates()
+{
+	// A layer slot may contain several registered stacks / panels, it is idle only if all of them are
+	TMap<UEasyUserInterfaceLayerPanelSlot*, bool> LayerSlotActivity;
+	// The cost of a slot is attributed to the classes displayed on it, only looked up while the attribution is on (See FEasyUserInterfaceCostStats)
+	const bool bIsCostEnabled = FEasyUserInterfaceCostStats::IsEnabled();
+	TMap<UEasyUserInterfaceLayerPanelSlot*, TPair<TArray<FName>, FName>> LayerSlotCostOwners;
+	auto AddCostOwner = [&LayerSlotCostOwners](UEasyUserInterfaceLayerPanelSlot* LayerSlot, const UObject* Widget, const FGameplayTag& LayerTag)
+	{
+		TPair<TArray<FName>, FName>& CostOwner = LayerSlotCostOwners.FindOrAdd(LayerSlot);
+		if (CostOwner.Key.IsEmpty())
+		{
+			CostOwner.Value = LayerTag.GetTagName();
+		}
+		CostOwner.Key.AddUnique(Widget->GetClass()->GetFName());
+	};
+
+	for (const TPair<FGameplayTag, UCommonActivatableWidgetStack*>& StackPair : WidgetStacks)
+	{
+		if (UEasyUserInterfaceLayerPanelSlot* LayerSlot = UEasyUserInterfaceLayerPanel::FindLayerSlotForWidget(StackPair.Value))
+		{
+			const FEasyUserInterfaceLayerState* LayerState = LayerStates.Find(StackPair.Key);
+			const bool bIsStackActive = StackPair.Value->GetNumWidgets() > 0 || (LayerState && LayerState->bIsTransitioning);
+			LayerSlotActivity.FindOrAdd(LayerSlot, false) |= bIsStackActive;
+			const UCommonActivatableWidget* TopWidget = LayerState ? LayerState->TopWidget.Get() : nullptr;
+			if (bIsCostEnabled && TopWidget)
+			{
+				AddCostOwner(LayerSlot, TopWidget, StackPair.Key);
+			}
+		}
+	}
+
+	for (const TPair<FGameplayTag, UWidget*>& PanelPair : NotificationPanels)
+	{
+		if (UEasyUserInterfaceLayerPanelSlot* LayerSlot = UEasyUserInterfaceLayerPanel::FindLayerSlotForWidget(PanelPair.Value))
+		{
+			// Only the notifications still placed in a panel keep the layer drawn, whether they were dismissed or not
+			bool bIsPanelActive = false;
+			if (const TArray<TWeakObjectPtr<UEasyNotificationWidget>>* LayerNotifications = ActiveNotifications.Find(PanelPair.Key))
+			{
+				for (const TWeakObjectPtr<UEasyNotificationWidget>& Notification : *LayerNotifications)
+				{
+					const UEasyNotificationWidget* NotificationWidget = Notification.Get();
+					if (NotificationWidget && NotificationWidget->GetParent())
+					{
+						bIsPanelActive = true;
+						if (!bIsCostEnabled)
+						{
+							break;
+						}
+						AddCostOwner(LayerSlot, NotificationWidget, PanelPair.Key);
+					}
+				}
+			}
+			LayerSlotActivity.FindOrAdd(LayerSlot, false) |= bIsPanelActive;
+		}
+	}
+
+	// Slots that no longer contain a registered layer are not ours to skip anymore
+	for (const TWeakObjectPtr<UEasyUserInterfaceLayerPanelSlot>& ManagedLayerSlot : ManagedLayerSlots)
+	{
+		UEasyUserInterfaceLayerPanelSlot* LayerSlot = ManagedLayerSlot.Get();
+		if (LayerSlot && !LayerSlotActivity.Contains(LayerSlot))
+		{
+			LayerSlot->SetLayerIdle(false);
+			LayerSlot->SetCostOwners(TArray<FName>(), NAME_None);
+		}
+	}
+
+	ManagedLayerSlots.Reset(LayerSlotActivity.Num());
+	for (const TPair<UEasyUserInterfaceLayerPanelSlot*, bool>& SlotPair : LayerSlotActivity)
+	{
+		SlotPair.Key->SetLayerIdle(!SlotPair.Value);
+		const TPair<TArray<FName>, FName>* CostOwner = LayerSlotCostOwners.Find(SlotPair.Key);
+		SlotPair.Key->SetCostOwners(CostOwner ? CostOwner->Key : TArray<FName>(), CostOwner ? CostOwner->Value : NAME_None);
+		ManagedLayerSlots.Add(SlotPair.Key);
+	}
 }
 
 void UEasyUserInterfaceRootWidget::RegisterNotificationPanel(FGameplayTag LayerTag, UWidget* ContainerWidget)
@@ -102,6 +371,8 @@ void UEasyUserInterfaceRootWidget::RegisterNotificationPanel(FGameplayTag LayerT
 	}
 
 	NotificationPanels.Add(LayerTag, ContainerWidget);
+
+	UpdateLayerPanelIdleStates();
 }
 
 bool UEasyUserInterfaceRootWidget::UnRegisterNotificationPanel(const FGameplayTag& LayerTag)
@@ -110,6 +381,21 @@ bool UEasyUserInterfaceRootWidget::UnRegisterNotificationPanel(const FGameplayTa
 	if (FoundPanelPtr && *FoundPanelPtr)
 	{
 		NotificationPanels.Remove(LayerTag);
+
+		TArray<TWeakObjectPtr<UEasyNotificationWidget>> RemovedNotifications;
+		if (ActiveNotifications.RemoveAndCopyValue(LayerTag, RemovedNotifications))
+		{
+			for (const TWeakObjectPtr<UEasyNotificationWidget>& RemovedNotification : RemovedNotifications)
+			{
+				if (UEasyNotificationWidget* NotificationWidget = RemovedNotification.Get())
+				{
+					NotificationWidget->OnNotificationRemovedNative().RemoveAll(this);
+				}
+			}
+			NotificationCountChangedEvent.Broadcast(LayerTag, 0);
+		}
+
+		UpdateLayerPanelIdleStates();
 		return true;
 	}
 	UE_LOG(LogEasyUserInterfaceManagement, Warning, TEXT("[%s] No notification panel found for LayerTag: %s"), *GetName(), *LayerTag.ToString());
@@ -118,21 +404,64 @@ bool UEasyUserInterfaceRootWidget::UnRegisterNotificationPanel(const FGameplayTa
 
 UWidget* UEasyUserInterfaceRootWidget::GetNotificationPanel(const FGameplayTag& LayerTag) const
 {
-	if (!NotificationPanels.Contains(LayerTag))
+	return NotificationPanels.FindRef(LayerTag);
+}
+
+int32 UEasyUserInterfaceRootWidget::GetActiveNotificationCount(const FGameplayTag& LayerTag) const
+{
+	const TArray<TWeakObjectPtr<UEasyNotificationWidget>>* LayerNotifications = ActiveNotifications.Find(LayerTag);
+	if (!LayerNotifications)
 	{
-		return nullptr;
+		return 0;
+	}
+
+	// Notifications garbage collected before reporting their removal are not visible anymore
+	int32 NotificationCount = 0;
+	for (const TWeakObjectPtr<UEasyNotificationWidget>& Notification : *LayerNotifications)
+	{
+		NotificationCount += Notification.IsValid() ? 1 : 0;
 	}
-	return NotificationPanels[LayerTag];
+	return NotificationCount;
 }
 
-void UEasyUserInterfaceRootWidget::AddNotificationWidgetToPanel(FGameplayTag LayerTag,
+TArray<FGameplayTag> UEasyUserInterfaceRootWidget::GetRegisteredNotificationLayers() const
+{
+	TArray<FGameplayTag> LayerTags;
+	NotificationPanels.GenerateKeyArray(LayerTags);
+	return LayerTags;
+}
+
+void UEasyUserInterfaceRootWidget::HandleNotificationRemoved(UEasyNotificationWidget* NotificationWidget, FGameplayTag LayerTag)
+{
+	NotificationWidget->OnNotificationRemovedNative().RemoveAll(this);
+
+	if (TArray<TWeakObjectPtr<UEasyNotificationWidget>>* LayerNotifications = ActiveNotifications.Find(LayerTag))
+	{
+		// Also drops notifications that were garbage collected without reporting their removal
+		LayerNotifications->RemoveAllSwap([NotificationWidget](const TWeakObjectPtr<UEasyNotificationWidget>& Notification)
+		{
+			return !Notification.IsValid() || Notification.Get() == NotificationWidget;
+		});
+		NotificationCountChangedEvent.Broadcast(LayerTag, LayerNotifications->Num());
+	}
+
+	UpdateLayerPanelIdleStates();
+}
+
+bool UEasyUserInterfaceRootWidget::AddNotificationWidgetToPanel(FGameplayTag LayerTag,
 	UEasyNotificationWidget* NotificationWidget, const FEasyNotificationWidgetInfo& InNotificationInfo)
 {
+	if (!NotificationWidget)
+	{
+		UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("[%s] NotificationWidget is null for LayerTag: %s"), *GetName(), *LayerTag.ToString());
+		return false;
+	}
+
 	UWidget** FoundPanelPtr = NotificationPanels.Find(LayerTag);
 	if (!FoundPanelPtr || !(*FoundPanelPtr))
 	{
 		UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("[%s] Notification panel not found for LayerTag: %s"), *GetName(), *LayerTag.ToString());
-		return;
+		return false;
 	}
 
 	if (UWidget* NotificationPanel = *FoundPanelPtr)
@@ -141,6 +470,17 @@ void UEasyUserInterfaceRootWidget::AddNotificationWidgetToPanel(FGameplayTag Lay
 		{
 			IEasyNotificationWidgetPanelInterface::Execute_OnNotificationWidgetAdded(NotificationPanel, LayerTag, NotificationWidget);
 			NotificationWidget->SetNotificationInfo(InNotificationInfo);
+
+			TArray<TWeakObjectPtr<UEasyNotificationWidget>>& LayerNotifications = ActiveNotifications.FindOrAdd(LayerTag);
+			LayerNotifications.AddUnique(NotificationWidget);
+			EASYUI_TRACE_EVENT(NotificationAdded, LayerTag, NotificationWidget->GetClass(), FString::Printf(TEXT("Duration=%.2fs"), InNotificationInfo.NotificationDuration));
+			// Counted until the widget leaves the panel, a notification that is not auto dismissed stays visible after its dismissal
+			NotificationWidget->OnNotificationRemovedNative().RemoveAll(this);
+			NotificationWidget->OnNotificationRemovedNative().AddUObject(this, &UEasyUserInterfaceRootWidget::HandleNotificationRemoved, LayerTag);
+			NotificationCountChangedEvent.Broadcast(LayerTag, LayerNotifications.Num());
+
+			UpdateLayerPanelIdleStates();
+			return true;
 		}
 		else
 		{
@@ -151,4 +491,5 @@ void UEasyUserInterfaceRootWidget::AddNotificationWidgetToPanel(FGameplayTag Lay
 	{
 		UE_LOG(LogEasyUserInterfaceManagement, Error, TEXT("[%s] Notification panel is null for LayerTag: %s"), *GetName(), *LayerTag.ToString());
 	}
+	return false;
 }
\ No newline at end of file
@@ -4,13 +4,16 @@
 #include "ExtensionCommonUI/Foundation/ButtonActions/ButtonAction_QuitGame.h"
 
 #include "EasyUserInterfaceManagement.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
 #include "Components/Widget.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include "CoreGlobals.h"
 
 UButtonAction_QuitGame::UButtonAction_QuitGame(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer)
 {
 	QuitPreference = EQuitPreference::Quit;
 	bIgnorePlatformRestrictions = false;
+	bFastExit = false;
 }
 
 void UButtonAction_QuitGame::ExecuteAction_Implementation(UWidget* InstigatorWidget)
@@ -24,6 +27,17 @@ void UButtonAction_QuitGame::ExecuteAction_Implementation(UWidget* InstigatorWid
 	}
 	
 	APlayerController* OwningPlayer = InstigatorWidget->GetOwningPlayer();
-	
 	UKismetSystemLibrary::QuitGame(OwningPlayer, OwningPlayer, QuitPreference, bIgnorePlatformRestrictions);
+
+	// The quit only requests the exit, teardown happens later. A refused quit (or a background one) keeps the User Interface running
+	if (bFastExit && IsEngineExitRequested())
+	{
+		if (const ULocalPlayer* LocalPlayer = InstigatorWidget->GetOwningLocalPlayer())
+		{
+			if (UEasyUserInterfaceManager* UserInterfaceManager = LocalPlayer->GetSubsystem<UEasyUserInterfaceManager>())
+			{
+				UserInterfaceManager->BeginFastExit();
+			}
+		}
+	}
 }
@@ -4,6 +4,7 @@
 
 #include "CommonActionWidget.h"
 #include "EasyUserInterfaceManagement.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSyncLoadDetector.h"
 #include "ExtensionCommonUI/Foundation/ButtonActions/CommonButtonClickActionBase.h"
 
 UEasyCommonButtonExtended::UEasyCommonButtonExtended()
@@ -27,8 +28,20 @@ void UEasyCommonButtonExtended::NativeOnCurrentTextStyleChanged()
 	RefreshButton();
 }
 
+void UEasyCommonButtonExtended::RefreshLocalizedText_Implementation()
+{
+	if (ButtonTextWidget)
+	{
+		// Re-setting the text makes the text block re-resolve it for the current culture
+		ButtonTextWidget->SetText(ButtonText);
+		ButtonTextWidget->InvalidateLayoutAndVolatility();
+	}
+}
+
 void UEasyCommonButtonExtended::NativeOnClicked()
 {
+	// Click actions resolve their soft references, a missing prefetch shows up here
+	FEasyUserInterfaceSyncLoadScope SyncLoadScope(GetClass(), TEXT("NativeOnClicked"));
 	Super::NativeOnClicked();
 
 	if (ButtonClickAction)
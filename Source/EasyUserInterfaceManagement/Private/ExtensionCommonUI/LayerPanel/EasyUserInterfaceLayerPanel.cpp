@@ -0,0 +1,190 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "ExtensionCommonUI/LayerPanel/EasyUserInterfaceLayerPanel.h"
+
+#define LOCTEXT_NAMESPACE "EasyUserInterfaceManagement"
+
+UEasyUserInterfaceLayerPanelSlot::UEasyUserInterfaceLayerPanelSlot()
+	: Padding(FMargin(0.0f))
+	, HorizontalAlignment(HAlign_Fill)
+	, VerticalAlignment(VAlign_Fill)
+	, bSkipWhenIdle(true)
+	, Slot(nullptr)
+{
+}
+
+void UEasyUserInterfaceLayerPanelSlot::SetPadding(FMargin InPadding)
+{
+	Padding = InPadding;
+	if (Slot)
+	{
+		Slot->SetPadding(InPadding);
+	}
+}
+
+void UEasyUserInterfaceLayerPanelSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
+{
+	HorizontalAlignment = InHorizontalAlignment;
+	if (Slot)
+	{
+		Slot->SetHorizontalAlignment(InHorizontalAlignment);
+	}
+}
+
+void UEasyUserInterfaceLayerPanelSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
+{
+	VerticalAlignment = InVerticalAlignment;
+	if (Slot)
+	{
+		Slot->SetVerticalAlignment(InVerticalAlignment);
+	}
+}
+
+void UEasyUserInterfaceLayerPanelSlot::SetSkipWhenIdle(bool bInSkipWhenIdle)
+{
+	bSkipWhenIdle = bInSkipWhenIdle;
+	if (Slot)
+	{
+		Slot->SetSkipWhenIdle(bInSkipWhenIdle);
+	}
+}
+
+void UEasyUserInterfaceLayerPanelSlot::SetLayerIdle(bool bInIsLayerIdle)
+{
+	bIsLayerIdle = bInIsLayerIdle;
+	if (Slot)
+	{
+		Slot->SetLayerIdle(bInIsLayerIdle);
+	}
+}
+
+void UEasyUserInterfaceLayerPanelSlot::SetCostOwners(const TArray<FName>& InCostOwnerClasses, FName InCostLayerTag)
+{
+	// Set again at every layer change, mostly with the same owners
+	if (CostOwnerClasses == InCostOwnerClasses && CostLayerTag == InCostLayerTag)
+	{
+		return;
+	}
+
+	CostOwnerClasses = InCostOwnerClasses;
+	CostLayerTag = InCostLayerTag;
+	if (Slot)
+	{
+		Slot->SetCostOwners(InCostOwnerClasses, InCostLayerTag);
+	}
+}
+
+void UEasyUserInterfaceLayerPanelSlot::BuildSlot(TSharedRef<SEasyUserInterfaceLayerPanel> InLayerPanel)
+{
+	InLayerPanel->AddSlot()
+		.Expose(Slot)
+		.Padding(Padding)
+		.HAlign(HorizontalAlignment)
+		.VAlign(VerticalAlignment)
+		.SkipWhenIdle(bSkipWhenIdle)
+		[
+			Content == nullptr ? SNullWidget::NullWidget : Content->TakeWidget()
+		];
+
+	Slot->SetLayerIdle(bIsLayerIdle);
+	Slot->SetCostOwners(CostOwnerClasses, CostLayerTag);
+}
+
+void UEasyUserInterfaceLayerPanelSlot::SynchronizeProperties()
+{
+	SetPadding(Padding);
+	SetHorizontalAlignment(HorizontalAlignment);
+	SetVerticalAlignment(VerticalAlignment);
+	SetSkipWhenIdle(bSkipWhenIdle);
+}
+
+void UEasyUserInterfaceLayerPanelSlot::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+
+	Slot = nullptr;
+}
+
+UEasyUserInterfaceLayerPanel::UEasyUserInterfaceLayerPanel()
+{
+	bIsVariable = false;
+	SetVisibilityInternal(ESlateVisibility::SelfHitTestInvisible);
+}
+
+UEasyUserInterfaceLayerPanelSlot* UEasyUserInterfaceLayerPanel::AddChildToLayerPanel(UWidget* Content)
+{
+	return Cast<UEasyUserInterfaceLayerPanelSlot>(Super::AddChild(Content));
+}
+
+UEasyUserInterfaceLayerPanelSlot* UEasyUserInterfaceLayerPanel::FindLayerSlotForWidget(const UWidget* Widget)
+{
+	for (const UWidget* CurrentWidget = Widget; CurrentWidget; CurrentWidget = CurrentWidget->GetParent())
+	{
+		if (UEasyUserInterfaceLayerPanelSlot* LayerSlot = Cast<UEasyUserInterfaceLayerPanelSlot>(CurrentWidget->Slot))
+		{
+			return LayerSlot;
+		}
+	}
+
+	return nullptr;
+}
+
+void UEasyUserInterfaceLayerPanel::ReleaseSlateResources(bool bReleaseChildren)
+{
+	Super::ReleaseSlateResources(bReleaseChildren);
+
+	MyLayerPanel.Reset();
+}
+
+#if WITH_EDITOR
+const FText UEasyUserInterfaceLayerPanel::GetPaletteCategory()
+{
+	return LOCTEXT("EasyUserInterface", "Easy User Interface");
+}
+#endif
+
+UClass* UEasyUserInterfaceLayerPanel::GetSlotClass() const
+{
+	return UEasyUserInterfaceLayerPanelSlot::StaticClass();
+}
+
+void UEasyUserInterfaceLayerPanel::OnSlotAdded(UPanelSlot* InSlot)
+{
+	// Add the child to the live panel if it already exists
+	if (MyLayerPanel.IsValid())
+	{
+		CastChecked<UEasyUserInterfaceLayerPanelSlot>(InSlot)->BuildSlot(MyLayerPanel.ToSharedRef());
+	}
+}
+
+void UEasyUserInterfaceLayerPanel::OnSlotRemoved(UPanelSlot* InSlot)
+{
+	// Remove the widget from the live slot if it exists.
+	if (MyLayerPanel.IsValid() && InSlot->Content)
+	{
+		const TSharedPtr<SWidget> Widget = InSlot->Content->GetCachedWidget();
+		if (Widget.IsValid())
+		{
+			MyLayerPanel->RemoveSlot(Widget.ToSharedRef());
+		}
+	}
+}
+
+TSharedRef<SWidget> UEasyUserInterfaceLayerPanel::RebuildWidget()
+{
+	MyLayerPanel = SNew(SEasyUserInterfaceLayerPanel);
+
+	for (UPanelSlot* PanelSlot : Slots)
+	{
+		if (UEasyUserInterfaceLayerPanelSlot* TypedSlot = Cast<UEasyUserInterfaceLayerPanelSlot>(PanelSlot))
+		{
+			TypedSlot->Parent = this;
+			TypedSlot->BuildSlot(MyLayerPanel.ToSharedRef());
+		}
+	}
+
+	return MyLayerPanel.ToSharedRef();
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,218 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "ExtensionCommonUI/LayerPanel/SEasyUserInterfaceLayerPanel.h"
+
+#include "EasyUserInterfaceManagement/EasyUserInterfaceCostStats.h"
+#include "Layout/ArrangedChildren.h"
+#include "Layout/LayoutUtils.h"
+
+void SEasyUserInterfaceLayerPanel::FSlot::Construct(const FChildren& SlotOwner, FSlotArguments&& InArgs)
+{
+	TBasicLayoutWidgetSlot<FSlot>::Construct(SlotOwner, MoveTemp(InArgs));
+	if (InArgs._SkipWhenIdle.IsSet())
+	{
+		bSkipWhenIdle = InArgs._SkipWhenIdle.GetValue();
+	}
+}
+
+void SEasyUserInterfaceLayerPanel::FSlot::SetLayerIdle(bool bInIsLayerIdle)
+{
+	if (bIsLayerIdle != bInIsLayerIdle)
+	{
+		bIsLayerIdle = bInIsLayerIdle;
+		// The set of arranged (and painted) layers changes
+		Invalidate(EInvalidateWidgetReason::Layout | EInvalidateWidgetReason::ChildOrder);
+	}
+}
+
+void SEasyUserInterfaceLayerPanel::FSlot::SetSkipWhenIdle(bool bInSkipWhenIdle)
+{
+	if (bSkipWhenIdle != bInSkipWhenIdle)
+	{
+		bSkipWhenIdle = bInSkipWhenIdle;
+		if (bIsLayerIdle)
+		{
+			Invalidate(EInvalidateWidgetReason::Layout | EInvalidateWidgetReason::ChildOrder);
+		}
+	}
+}
+
+bool SEasyUserInterfaceLayerPanel::FSlot::IsFullScreen() const
+{
+	return GetHorizontalAlignment() == HAlign_Fill
+		&& GetVerticalAlignment() == VAlign_Fill
+		&& GetPadding() == FMargin(0.0f);
+}
+
+void SEasyUserInterfaceLayerPanel::FSlot::SetCostOwners(const TArray<FName>& InCostOwnerClasses, FName InCostLayerTag)
+{
+	CostOwnerClasses = InCostOwnerClasses;
+	CostLayerTag = InCostLayerTag;
+}
+
+SEasyUserInterfaceLayerPanel::SEasyUserInterfaceLayerPanel()
+	: Children(this)
+{
+	// Idle layers are left out of the prepass, see CustomPrepass
+	bHasCustomPrepass = true;
+}
+
+void SEasyUserInterfaceLayerPanel::Construct(const FArguments& InArgs)
+{
+	Children.AddSlots(MoveTemp(const_cast<TArray<FSlot::FSlotArguments>&>(InArgs._Slots)));
+}
+
+SEasyUserInterfaceLayerPanel::FSlot::FSlotArguments SEasyUserInterfaceLayerPanel::Slot()
+{
+	return FSlot::FSlotArguments(MakeUnique<FSlot>());
+}
+
+SEasyUserInterfaceLayerPanel::FScopedWidgetSlotArguments SEasyUserInterfaceLayerPanel::AddSlot()
+{
+	return FScopedWidgetSlotArguments{ MakeUnique<FSlot>(), Children, INDEX_NONE };
+}
+
+bool SEasyUserInterfaceLayerPanel::RemoveSlot(const TSharedRef<SWidget>& SlotWidget)
+{
+	return Children.Remove(SlotWidget) != INDEX_NONE;
+}
+
+void SEasyUserInterfaceLayerPanel::ClearChildren()
+{
+	Children.Empty();
+}
+
+void SEasyUserInterfaceLayerPanel::OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const
+{
+	const FVector2D LocalSize = AllottedGeometry.GetLocalSize();
+
+	for (int32 ChildIndex = 0; ChildIndex < Children.Num(); ++ChildIndex)
+	{
+		const FSlot& LayerSlot = Children[ChildIndex];
+		if (LayerSlot.ShouldSkipLayer())
+		{
+			continue;
+		}
+
+		const TSharedRef<SWidget>& LayerWidget = LayerSlot.GetWidget();
+		const EVisibility LayerVisibility = LayerWidget->GetVisibility();
+		if (!ArrangedChildren.Accepts(LayerVisibility))
+		{
+			continue;
+		}
+
+		// A render transform applies to the layer alone, such layers cannot share the cached geometry
+		if (LayerSlot.IsFullScreen() && !LayerWidget->GetRenderTransformWithRespectToFlowDirection().IsSet())
+		{
+			ArrangedChildren.AddWidget(LayerVisibility, FArrangedWidget(LayerWidget, GetFullScreenGeometry(AllottedGeometry)));
+			continue;
+		}
+
+		const FMargin SlotPadding(LayoutPaddingWithFlow(GSlateFlowDirection, LayerSlot.GetPadding()));
+		const AlignmentArrangeResult XResult = AlignChild<Orient_Horizontal>(GSlateFlowDirection, LocalSize.X, LayerSlot, SlotPadding);
+		const AlignmentArrangeResult YResult = AlignChild<Orient_Vertical>(LocalSize.Y, LayerSlot, SlotPadding);
+
+		ArrangedChildren.AddWidget(LayerVisibility, AllottedGeometry.MakeChild(LayerWidget, FVector2D(XResult.Offset, YResult.Offset), FVector2D(XResult.Size, YResult.Size)));
+	}
+}
+
+FChildren* SEasyUserInterfaceLayerPanel::GetChildren()
+{
+	return &Children;
+}
+
+bool SEasyUserInterfaceLayerPanel::CustomPrepass(float LayoutScaleMultiplier)
+{
+	for (int32 ChildIndex = 0; ChildIndex < Children.Num(); ++ChildIndex)
+	{
+		const FSlot& LayerSlot = Children[ChildIndex];
+		if (!LayerSlot.ShouldSkipLayer())
+		{
+			FEasyUserInterfaceCostScope CostScope(LayerSlot.GetCostOwnerClasses(), LayerSlot.GetCostLayerTag(), EEasyUserInterfaceCostPhase::Prepass);
+			LayerSlot.GetWidget()->SlatePrepass(LayoutScaleMultiplier);
+		}
+	}
+
+	// Children are already handled
+	return false;
+}
+
+int32 SEasyUserInterfaceLayerPanel::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	FArrangedChildren ArrangedChildren(EVisibility::Visible);
+	ArrangeChildren(AllottedGeometry, ArrangedChildren);
+
+	const FPaintArgs NewArgs = Args.WithNewParent(this);
+	const bool bChildrenEnabled = ShouldBeEnabled(bParentEnabled);
+	const bool bIsCostEnabled = FEasyUserInterfaceCostStats::IsEnabled();
+
+	// Same as the overlay paint: each layer starts above everything painted by the layers below it
+	int32 MaxLayerId = LayerId;
+	for (int32 ChildIndex = 0; ChildIndex < ArrangedChildren.Num(); ++ChildIndex)
+	{
+		const FArrangedWidget& LayerWidget = ArrangedChildren[ChildIndex];
+		if (IsChildWidgetCulled(MyCullingRect, LayerWidget))
+		{
+			continue;
+		}
+
+		// Painted one layer at a time so the cost of each can be attributed to its owner
+		const FSlot* LayerSlot = bIsCostEnabled ? FindSlot(LayerWidget.Widget) : nullptr;
+		FEasyUserInterfaceCostScope CostScope(LayerSlot ? MakeArrayView(LayerSlot->GetCostOwnerClasses()) : TConstArrayView<FName>(), LayerSlot ? LayerSlot->GetCostLayerTag() : NAME_None, EEasyUserInterfaceCostPhase::Paint);
+
+		const int32 LayerMaxLayerId = LayerWidget.Widget->Paint(NewArgs, LayerWidget.Geometry, MyCullingRect, OutDrawElements, MaxLayerId + 1, InWidgetStyle, bChildrenEnabled);
+		MaxLayerId = FMath::Max(MaxLayerId, LayerMaxLayerId);
+	}
+	return MaxLayerId;
+}
+
+const SEasyUserInterfaceLayerPanel::FSlot* SEasyUserInterfaceLayerPanel::FindSlot(const TSharedRef<SWidget>& LayerWidget) const
+{
+	for (int32 ChildIndex = 0; ChildIndex < Children.Num(); ++ChildIndex)
+	{
+		if (Children[ChildIndex].GetWidget() == LayerWidget)
+		{
+			return &Children[ChildIndex];
+		}
+	}
+	return nullptr;
+}
+
+const FGeometry& SEasyUserInterfaceLayerPanel::GetFullScreenGeometry(const FGeometry& AllottedGeometry) const
+{
+	const bool bIsSamePanelGeometry = CachedPanelGeometry.IsSet()
+		&& CachedPanelGeometry->GetLocalSize() == AllottedGeometry.GetLocalSize()
+		&& CachedPanelGeometry->GetAccumulatedLayoutTransform() == AllottedGeometry.GetAccumulatedLayoutTransform()
+		&& CachedPanelGeometry->GetAccumulatedRenderTransform() == AllottedGeometry.GetAccumulatedRenderTransform();
+	if (!bIsSamePanelGeometry)
+	{
+		CachedPanelGeometry = AllottedGeometry;
+		CachedFullScreenGeometry = AllottedGeometry.MakeChild(AllottedGeometry.GetLocalSize(), FSlateLayoutTransform());
+	}
+	return CachedFullScreenGeometry;
+}
+
+FVector2D SEasyUserInterfaceLayerPanel::ComputeDesiredSize(float LayoutScaleMultiplier) const
+{
+	FVector2D MaxSize = FVector2D::ZeroVector;
+	for (int32 ChildIndex = 0; ChildIndex < Children.Num(); ++ChildIndex)
+	{
+		const FSlot& LayerSlot = Children[ChildIndex];
+		if (LayerSlot.ShouldSkipLayer())
+		{
+			continue;
+		}
+
+		const TSharedRef<SWidget>& LayerWidget = LayerSlot.GetWidget();
+		if (LayerWidget->GetVisibility() != EVisibility::Collapsed)
+		{
+			const FVector2D ChildDesiredSize = LayerWidget->GetDesiredSize() + LayerSlot.GetPadding().GetDesiredSize();
+			MaxSize.X = FMath::Max(MaxSize.X, ChildDesiredSize.X);
+			MaxSize.Y = FMath::Max(MaxSize.Y, ChildDesiredSize.Y);
+		}
+	}
+
+	return MaxSize;
+}
@@ -0,0 +1,7 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "ExtensionCommonUI/Localization/EasyLocalizedWidgetInterface.h"
+
+
+// Add default functionality here for any IEasyLocalizedWidgetInterface functions that are not pure virtual.
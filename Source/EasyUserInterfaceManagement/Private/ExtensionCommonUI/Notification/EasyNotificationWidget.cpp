@@ -2,6 +2,12 @@
 
 #include "ExtensionCommonUI/Notification/EasyNotificationWidget.h"
 #include "TimerManager.h"
+#include "Components/ProgressBar.h"
+#include "Engine/LocalPlayer.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceCostStats.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSyncLoadDetector.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceTrace.h"
 #include "ExtensionCommonUI/Foundation/EasyCommonButtonExtended.h"
 #include "ExtensionCommonUI/Foundation/ButtonActions/CommonButtonClickActionBase.h"
 
@@ -35,14 +41,21 @@ void UEasyNotificationWidget::NativePreConstruct()
 #if WITH_EDITOR
 	if (IsDesignTime())
 	{
-		FEasyNotificationWidgetInfo TestNotificationInfo = DebugNotificationInfo;
 		RefreshWidget(DebugNotificationInfo);
 	}
 #endif
 }
 
+void UEasyNotificationWidget::NativeTick(const FGeometry& MyGeometry, float InDeltaTime)
+{
+	FEasyUserInterfaceCostScope CostScope(FEasyUserInterfaceCostStats::IsEnabled() ? GetClass()->GetFName() : NAME_None, NAME_None, EEasyUserInterfaceCostPhase::Tick);
+	FEasyUserInterfaceSyncLoadScope SyncLoadScope(GetClass(), TEXT("NativeTick"));
+	Super::NativeTick(MyGeometry, InDeltaTime);
+}
+
 void UEasyNotificationWidget::NativeOnInitialized()
 {
+	FEasyUserInterfaceSyncLoadScope SyncLoadScope(GetClass(), TEXT("NativeOnInitialized"));
 	Super::NativeOnInitialized();
 
 	RefreshWidget(NotificationInfo);
@@ -53,6 +66,32 @@ void UEasyNotificationWidget::NativeOnInitialized()
 	}
 }
 
+void UEasyNotificationWidget::NativeDestruct()
+{
+	// Destructed once the panel releases the widget, whoever removed it
+	if (!UEasyUserInterfaceManager::IsUserInterfaceShuttingDown())
+	{
+		NotificationRemovedNativeEvent.Broadcast(this);
+	}
+
+	Super::NativeDestruct();
+}
+
+void UEasyNotificationWidget::RefreshLocalizedText_Implementation()
+{
+	// Dismiss button text is refreshed by the button itself
+	if (NotificationHeaderTextWidget)
+	{
+		NotificationHeaderTextWidget->SetText(NotificationInfo.NotificationHeader);
+		NotificationHeaderTextWidget->InvalidateLayoutAndVolatility();
+	}
+	if (NotificationBodyTextWidget)
+	{
+		NotificationBodyTextWidget->SetText(NotificationInfo.NotificationBody);
+		NotificationBodyTextWidget->InvalidateLayoutAndVolatility();
+	}
+}
+
 void UEasyNotificationWidget::SetNotificationInfo(const FEasyNotificationWidgetInfo& InNotificationInfo)
 {
 	NotificationInfo = InNotificationInfo;
@@ -93,15 +132,31 @@ void UEasyNotificationWidget::SetNotificationLifeTime(float InNotificationDurati
 
 	NotificationStartTime = GetWorld()->GetTimeSeconds();
 	
-	// reset timer
-	NotificationTimerHandle.Invalidate();
+	// reset lifetime, a pooled widget may still have the lifetime of its previous notification
+	CancelLifetime();
 	if (NotificationInfo.NotificationDuration > 0.0f)
 	{
-		GetWorld()->GetTimerManager().SetTimer(NotificationTimerHandle, this, &UEasyNotificationWidget::DismissNotification, NotificationInfo.NotificationDuration, false);
+		// Timed with the other notifications of the player, by a world timer if the widget has no manager
+		const ULocalPlayer* LocalPlayer = GetOwningLocalPlayer();
+		UEasyUserInterfaceManager* Manager = LocalPlayer ? LocalPlayer->GetSubsystem<UEasyUserInterfaceManager>() : nullptr;
+		const bool bPublishProgress = bPublishLifetimeProgress || NotificationLifetimeBarWidget;
+		if (Manager && Manager->NotificationTimingWheel.ScheduleLifetime(*this, NotificationInfo.NotificationDuration, bPublishProgress))
+		{
+			LifetimeManager = Manager;
+		}
+		else
+		{
+			GetWorld()->GetTimerManager().SetTimer(NotificationTimerHandle, this, &UEasyNotificationWidget::DismissNotification, NotificationInfo.NotificationDuration, false);
+		}
+	}
+
+	if (NotificationLifetimeBarWidget)
+	{
+		NotificationLifetimeBarWidget->SetPercent(1.0f);
 	}
 }
 
-void UEasyNotificationWidget::RefreshWidget(FEasyNotificationWidgetInfo FromData)
+void UEasyNotificationWidget::RefreshWidget(const FEasyNotificationWidgetInfo& FromData)
 {
 	if (NotificationHeaderTextWidget)
 	{
@@ -151,10 +206,19 @@ void UEasyNotificationWidget::RefreshWidget(FEasyNotificationWidgetInfo FromData
 			NotificationIconContainerWidget->SetVisibility(ESlateVisibility::Collapsed);
 		}
 	}
+	RefreshCoalescedCount();
 }
 
 void UEasyNotificationWidget::DismissNotification()
 {
+	if (UEasyUserInterfaceManager::IsUserInterfaceShuttingDown() || bIsInPool)
+	{
+		return;
+	}
+
+	// A notification dismissed by its button must not be dismissed again when its lifetime ends
+	CancelLifetime();
+
 	// execute action if it is set and the notification is not dismissed by button
 	if (!bExecuteDismissActionsOnlyOnButtonPress && !bHasNotificationDismissedByButton)
 	{
@@ -164,15 +228,37 @@ void UEasyNotificationWidget::DismissNotification()
 		}
 	}
 
+	EASYUI_TRACE_EVENT(NotificationDismissed, FEasyUserInterfaceTrace::FindWidgetLayer(*this), GetClass(), FString::Printf(TEXT("Lifetime=%.2fs"), GetWorld()->GetTimeSeconds() - NotificationStartTime));
+
 	OnPromptNotificationDismissed.Broadcast();
 	OnNotificationDismissed();
 
 	if (bShouldAutoDismiss)
 	{
 		RemoveFromParent();
+
+		// Recycled by the manager that created it, instead of being left to the garbage collector
+		if (UEasyUserInterfaceManager* PoolManager = OwningPoolManager.Get())
+		{
+			PoolManager->ReleaseNotificationWidget(*this);
+		}
 	}
 }
 
+void UEasyNotificationWidget::CoalesceNotification()
+{
+	if (bIsInPool)
+	{
+		return;
+	}
+
+	++CoalescedCount;
+	RefreshCoalescedCount();
+	SetNotificationLifeTime(NotificationInfo.NotificationDuration);
+
+	OnNotificationCoalesced(CoalescedCount);
+}
+
 bool UEasyNotificationWidget::GetTimeRemaining(float& OutTimeRemaining, float& Ratio) const
 {
 	if (NotificationInfo.NotificationDuration <= 0.0f)
@@ -190,6 +276,53 @@ bool UEasyNotificationWidget::GetTimeRemaining(float& OutTimeRemaining, float& R
 	return true;
 }
 
+void UEasyNotificationWidget::ResetForPool()
+{
+	CancelLifetime();
+	NotificationStartTime = -1.0f;
+	CoalescedCount = 1;
+	bHasNotificationDismissedByButton = false;
+	NotificationInfo = FEasyNotificationWidgetInfo();
+
+	// The next notification shown by this widget gets its own listeners
+	OnPromptNotificationDismissed.Clear();
+	bIsInPool = true;
+
+	OnNotificationReturnedToPool();
+}
+
+void UEasyNotificationWidget::RefreshCoalescedCount()
+{
+	if (NotificationCountTextWidget)
+	{
+		NotificationCountTextWidget->SetText(FText::Format(NSLOCTEXT("EasyNotificationWidget", "CoalescedCountFormat", "x{0}"), CoalescedCount));
+		NotificationCountTextWidget->SetVisibility(CoalescedCount > 1 ? ESlateVisibility::SelfHitTestInvisible : ESlateVisibility::Collapsed);
+	}
+}
+
+void UEasyNotificationWidget::CancelLifetime()
+{
+	if (UEasyUserInterfaceManager* Manager = LifetimeManager.Get())
+	{
+		Manager->NotificationTimingWheel.CancelLifetime(*this);
+	}
+	LifetimeManager.Reset();
+
+	if (const UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(NotificationTimerHandle);
+	}
+}
+
+void UEasyNotificationWidget::PublishLifetimeProgress(float TimeRemaining, float Ratio)
+{
+	if (NotificationLifetimeBarWidget)
+	{
+		NotificationLifetimeBarWidget->SetPercent(1.0f - Ratio);
+	}
+	OnNotificationLifetimeProgress(TimeRemaining, Ratio);
+}
+
 void UEasyNotificationWidget::OnDismissButtonClicked()
 {
 	if (!NotificationInfo.bCanBeManuallyDismissed)
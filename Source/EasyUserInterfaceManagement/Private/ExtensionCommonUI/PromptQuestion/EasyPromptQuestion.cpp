@@ -5,6 +5,9 @@
 
 #include "CommonRichTextBlock.h"
 #include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceReplay.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSyncLoadDetector.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceTrace.h"
 #include "ExtensionCommonUI/Foundation/EasyCommonButtonExtended.h"
 #include "ExtensionCommonUI/Foundation/ButtonActions/CommonButtonClickActionBase.h"
 
@@ -26,12 +29,19 @@ void UEasyPromptQuestion::NativePreConstruct()
 
 void UEasyPromptQuestion::NativeConstruct()
 {
+	FEasyUserInterfaceSyncLoadScope SyncLoadScope(GetClass(), TEXT("NativeConstruct"));
 	Super::NativeConstruct();
 	RefreshWidget();
 }
 
 void UEasyPromptQuestion::NativeDestruct()
 {
+	if (UEasyUserInterfaceManager::IsUserInterfaceShuttingDown())
+	{
+		Super::NativeDestruct();
+		return;
+	}
+
 	ExecutePromptQuestionResultExecutions(EPromptQuestionResult::PQR_None);
 	OnPromptResultUpdated(EPromptQuestionResult::PQR_None);
 	
@@ -40,6 +50,7 @@ void UEasyPromptQuestion::NativeDestruct()
 
 void UEasyPromptQuestion::NativeOnActivated()
 {
+	FEasyUserInterfaceSyncLoadScope SyncLoadScope(GetClass(), TEXT("NativeOnActivated"));
 	Super::NativeOnActivated();
 
 	Super::NativeOnActivated();
@@ -66,7 +77,7 @@ void UEasyPromptQuestion::NativeOnDeactivated()
 		CancelButtonWidget->OnClicked().Clear();
 	}
 
-	if (!bHasInteractionCompleted)
+	if (!bHasInteractionCompleted && !UEasyUserInterfaceManager::IsUserInterfaceShuttingDown())
 	{
 		ExecutePromptQuestionResultExecutions(EPromptQuestionResult::PQR_NoUserInput);
 		OnPromptResultUpdated(EPromptQuestionResult::PQR_NoUserInput);
@@ -98,6 +109,34 @@ void UEasyPromptQuestion::RefreshWidget()
 	}
 }
 
+void UEasyPromptQuestion::RefreshLocalizedText_Implementation()
+{
+	// Confirm and Cancel button texts are refreshed by the buttons themselves
+	if (QuestionHeaderTextWidget)
+	{
+		QuestionHeaderTextWidget->SetText(QuestionBodyInfo.QuestionHeaderText);
+		QuestionHeaderTextWidget->InvalidateLayoutAndVolatility();
+	}
+
+	if (QuestionBodyTextWidget)
+	{
+		QuestionBodyTextWidget->SetText(QuestionBodyInfo.QuestionBodyText);
+		QuestionBodyTextWidget->InvalidateLayoutAndVolatility();
+	}
+}
+
+void UEasyPromptQuestion::AnswerPrompt(bool bConfirm)
+{
+	if (bConfirm)
+	{
+		OnConfirmButtonClicked();
+	}
+	else
+	{
+		OnCancelButtonClicked();
+	}
+}
+
 void UEasyPromptQuestion::OnConfirmButtonClicked_Implementation()
 {
 	bHasInteractionCompleted = true;
@@ -116,6 +155,14 @@ void UEasyPromptQuestion::OnCancelButtonClicked_Implementation()
 
 void UEasyPromptQuestion::OnPromptResultUpdated(EPromptQuestionResult Result)
 {
+	EASYUI_TRACE_EVENT(PromptResult, FEasyUserInterfaceTrace::FindWidgetLayer(*this), GetClass(), StaticEnum<EPromptQuestionResult>()->GetNameStringByValue(Result));
+
+	// Only the answers of the player are recorded, the other results follow from them on replay
+	if (FEasyUserInterfaceReplay::IsRecording() && bHasInteractionCompleted && (Result == PQR_Confirm || Result == PQR_Cancel))
+	{
+		FEasyUserInterfaceReplay::RecordPromptAnswer(*this, Result);
+	}
+
 	OnPromptQuestionResult.Broadcast(Result);
 	
 	if (QuestionBodyInfo.bDeactivateWidgetOnAnyResult)
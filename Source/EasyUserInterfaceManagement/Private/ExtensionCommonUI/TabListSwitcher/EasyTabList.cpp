@@ -4,6 +4,8 @@
 #include "ExtensionCommonUI/TabListSwitcher/EasyTabList.h"
 #include "CommonAnimatedSwitcher.h"
 #include "Components/SizeBox.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceReplay.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSyncLoadDetector.h"
 #include "ExtensionCommonUI/Foundation/EasyCommonButtonExtended.h"
 
 UEasyTabList::UEasyTabList(const FObjectInitializer& ObjectInitializer)
@@ -30,6 +32,13 @@ void UEasyTabList::NativeConstruct()
 	}
 }
 
+void UEasyTabList::NativeOnInitialized()
+{
+	Super::NativeOnInitialized();
+
+	OnTabSelected.AddUniqueDynamic(this, &UEasyTabList::HandleTabSelectedForRecording);
+}
+
 void UEasyTabList::NativePreConstruct()
 {
 	Super::NativePreConstruct();
@@ -77,6 +86,7 @@ UUserWidget* UEasyTabList::RegisterTabDynamicFromClass(TSubclassOf<UUserWidget>
 {
 	if (ContentWidgetClass)
 	{
+		FEasyUserInterfaceSyncLoadScope SyncLoadScope(ContentWidgetClass, TEXT("RegisterTabDynamicFromClass"));
 		UUserWidget* ContentWidget = CreateWidget<UUserWidget>(this, ContentWidgetClass);
 		if (RegisterTabDynamic(ContentWidget, TabIndex, TabButtonInfo))
 		{
@@ -271,3 +281,11 @@ void UEasyTabList::UpdateLinkedSwitcher()
 		}
 	}
 }
+
+void UEasyTabList::HandleTabSelectedForRecording(FName TabId)
+{
+	if (FEasyUserInterfaceReplay::IsRecording())
+	{
+		FEasyUserInterfaceReplay::RecordTabSelected(*this, TabId);
+	}
+}
@@ -0,0 +1,63 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+class UEasyUserInterfaceManager;
+struct FStreamableHandle;
+
+/**
+ * Shortens the cold start to the first menu by streaming, in a single request, the widget classes and assets the previous
+ * session of the same build requested at boot, instead of loading them one at a time as the root widget and the first screens ask for them.
+ * Owned by the User Interface Manager of the first local player, configured under "Preloading" in the project settings.
+ *
+ * The classes and assets requested through the manager during the first seconds of the session are recorded in order,
+ * and saved to GetListPath once the recording ends. The preloaded assets are released at the same time, the widgets using them keep them loaded.
+ */
+class EASYUSERINTERFACEMANAGEMENT_API FEasyUserInterfaceBootPreloader
+{
+public:
+	/** Streams the list recorded by the previous session of this build, and starts recording the list of this session. */
+	void Initialize(UEasyUserInterfaceManager& InManager);
+	/** Saves the list if it is still being recorded, and releases the preloaded assets. */
+	void Deinitialize();
+
+	/**
+	 * Adds an asset requested by the manager to the list, while recording.
+	 * @param AssetPath The requested class or asset, native classes are ignored.
+	 */
+	void RecordAsset(const FSoftObjectPath& AssetPath);
+
+	/** Checks if the assets requested by the manager are being recorded. */
+	bool IsRecording() const { return bIsRecording; }
+	/** Retrieves the number of assets streamed from the list of the previous session. */
+	int32 GetNumPreloadedAssets() const { return NumPreloadedAssets; }
+	/** Retrieves the assets recorded so far, in request order. */
+	const TArray<FSoftObjectPath>& GetRecordedAssets() const { return RecordedAssets; }
+
+	/** Writes the recorded list to GetListPath, stamped with the current build. */
+	bool SaveList() const;
+	/**
+	 * Reads the list saved by the previous session.
+	 * @param OutAssets The assets, in request order.
+	 * @return False if there is no list, or if it was recorded by another build.
+	 */
+	static bool LoadList(TArray<FSoftObjectPath>& OutAssets);
+	/** Retrieves the file the list is saved to. */
+	static FString GetListPath();
+	/** Retrieves the identifier of the running build, a list recorded by another build is ignored. */
+	static FString GetBuildId();
+
+private:
+	/** Ends the recording once the recorded duration is elapsed */
+	bool TickRecording(float DeltaTime);
+	void StopRecording();
+
+	TSharedPtr<FStreamableHandle> PreloadHandle;
+	TArray<FSoftObjectPath> RecordedAssets;
+	FTSTicker::FDelegateHandle RecordingTickerHandle;
+	int32 NumPreloadedAssets = 0;
+	bool bIsRecording = false;
+};
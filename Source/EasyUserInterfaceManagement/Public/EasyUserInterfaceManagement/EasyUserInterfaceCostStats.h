@@ -0,0 +1,119 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FOutputDevice;
+
+/** Frame phases whose cost is attributed to the widget owning a layer. */
+enum class EEasyUserInterfaceCostPhase : uint8
+{
+	/** Desired size computation of the layer */
+	Prepass,
+	/** Paint of the layer, includes the arrange and the Slate tick of its widgets that Slate runs while painting */
+	Paint,
+	/** UMG tick (native and Event Tick) of the top level activatable widget or notification itself */
+	Tick,
+	Num
+};
+
+/** Accumulated cost of a widget class, in milliseconds per frame it was measured in. */
+struct FEasyUserInterfaceCostEntry
+{
+	FName OwnerClass;
+	/** Layer the class was last displayed on */
+	FName LayerTag;
+	double AvgMs[static_cast<int32>(EEasyUserInterfaceCostPhase::Num)] = {};
+	double MaxMs[static_cast<int32>(EEasyUserInterfaceCostPhase::Num)] = {};
+	int32 NumFrames = 0;
+
+	double GetTotalAvgMs() const;
+};
+
+/**
+ * Opt-in attribution of the prepass, paint and tick time of the User Interface to the class of the top level activatable
+ * widget or notification owning each layer, so the screen to optimize can be found. Game thread only.
+ *
+ * Enabled with "EasyUI.Cost On". The layer panel times its layers and the owning classes are set by the root widget.
+ * "EasyUI.Cost Print [Sort=Total|Prepass|Paint|Tick] [Count=20]" logs a table sorted by cost, and the per frame costs are
+ * published to the "EasyUICost" CSV profiler category as "<Class>/<Phase>" columns.
+ */
+class EASYUSERINTERFACEMANAGEMENT_API FEasyUserInterfaceCostStats
+{
+public:
+	/** Starts or stops attributing costs, the recorded costs are kept. */
+	static void SetEnabled(bool bEnabled);
+	/** Checks if costs are attributed, Record does nothing otherwise. */
+	static bool IsEnabled() { return bIsEnabled; }
+	/** Called when the attribution starts or stops, so the owners of the layers can be set up or cleared. */
+	static FSimpleMulticastDelegate& OnEnabledChanged() { return EnabledChangedEvent; }
+
+	/**
+	 * Records the cost of a phase for the current frame.
+	 * @param OwnerClass The class of the widget owning the measured layer.
+	 * @param LayerTag The layer the widget is displayed on, None to keep the known one.
+	 * @param Phase The measured phase.
+	 * @param Seconds The measured duration in seconds.
+	 */
+	static void Record(FName OwnerClass, FName LayerTag, EEasyUserInterfaceCostPhase Phase, double Seconds);
+
+	/**
+	 * Retrieves the accumulated costs.
+	 * @param SortPhase The phase to sort by, Num sorts by the total cost.
+	 * @return The entries, the most expensive first.
+	 */
+	static TArray<FEasyUserInterfaceCostEntry> GetEntries(EEasyUserInterfaceCostPhase SortPhase = EEasyUserInterfaceCostPhase::Num);
+	/** Logs the most expensive entries as a table. */
+	static void PrintTable(FOutputDevice& Ar, EEasyUserInterfaceCostPhase SortPhase, int32 MaxEntries);
+	/** Clears the recorded costs. */
+	static void Reset();
+
+	static const TCHAR* LexToString(EEasyUserInterfaceCostPhase Phase);
+
+private:
+	/** Global so the layer panel and widgets can early out without looking up the entries */
+	static bool bIsEnabled;
+	static FSimpleMulticastDelegate EnabledChangedEvent;
+};
+
+/** Measures the scope and records it for the owners, when the cost attribution is enabled. */
+struct FEasyUserInterfaceCostScope
+{
+	FEasyUserInterfaceCostScope(FName InOwnerClass, FName InLayerTag, EEasyUserInterfaceCostPhase InPhase)
+		: FEasyUserInterfaceCostScope(MakeArrayView(&InOwnerClass, InOwnerClass.IsNone() ? 0 : 1), InLayerTag, InPhase)
+	{
+	}
+
+	/** A layer may display several classes at once, they share the measured time evenly */
+	FEasyUserInterfaceCostScope(TConstArrayView<FName> InOwnerClasses, FName InLayerTag, EEasyUserInterfaceCostPhase InPhase)
+		: LayerTag(InLayerTag)
+		, Phase(InPhase)
+		, StartTime(0.0)
+	{
+		if (FEasyUserInterfaceCostStats::IsEnabled() && InOwnerClasses.Num() > 0)
+		{
+			// Copied, the owners of a layer may change while it is measured
+			OwnerClasses = InOwnerClasses;
+			StartTime = FPlatformTime::Seconds();
+		}
+	}
+
+	~FEasyUserInterfaceCostScope()
+	{
+		if (StartTime > 0.0)
+		{
+			const double OwnerSeconds = (FPlatformTime::Seconds() - StartTime) / OwnerClasses.Num();
+			for (const FName& OwnerClass : OwnerClasses)
+			{
+				FEasyUserInterfaceCostStats::Record(OwnerClass, LayerTag, Phase, OwnerSeconds);
+			}
+		}
+	}
+
+private:
+	TArray<FName, TInlineAllocator<2>> OwnerClasses;
+	FName LayerTag;
+	EEasyUserInterfaceCostPhase Phase;
+	double StartTime;
+};
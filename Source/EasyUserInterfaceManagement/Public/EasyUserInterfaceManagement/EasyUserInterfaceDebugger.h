@@ -0,0 +1,44 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class APlayerController;
+class FJsonObject;
+class UCanvas;
+class UEasyUserInterfaceManager;
+
+/**
+ * Inspection of what the User Interface Manager of each local player is holding, for live builds.
+ *
+ * "EasyUI.Dump [Output=Path.json]" writes, for every layer, the stack contents, in-flight loads, pooled instances,
+ * notification panels with their active notifications and remaining lifetimes, registered binding counts per widget
+ * and the current input config. Defaults to Saved/EasyUI/Dump.json.
+ *
+ * "EasyUI.Debug [0|1]" toggles an on-screen overlay summarizing the same state. The overlay is built from the cached
+ * layer states and only rebuilt a few times per second, so it can be left on in test builds.
+ */
+class EASYUSERINTERFACEMANAGEMENT_API FEasyUserInterfaceDebugger
+{
+public:
+	/**
+	 * Builds the state of the manager and its root widget. Walks every widget of the layers, not meant to be called every frame.
+	 * @param Manager The manager of the local player to dump.
+	 * @return The state of the manager as JSON.
+	 */
+	static TSharedRef<FJsonObject> DumpState(const UEasyUserInterfaceManager& Manager);
+	/** Retrieves the path the dump is written to when no output is given. */
+	static FString GetDefaultDumpPath();
+
+	/** Shows or hides the on-screen overlay. */
+	static void SetOverlayEnabled(bool bEnabled);
+	/** Checks if the on-screen overlay is shown. */
+	static bool IsOverlayEnabled();
+
+private:
+	/** Draws the overlay of the player's manager, registered to the debug draw service while the overlay is shown */
+	static void DrawOverlay(UCanvas* Canvas, APlayerController* PlayerController);
+	/** Builds the overlay lines from the cached layer states */
+	static void BuildOverlayLines(const UEasyUserInterfaceManager& Manager, TArray<FString>& OutLines);
+};
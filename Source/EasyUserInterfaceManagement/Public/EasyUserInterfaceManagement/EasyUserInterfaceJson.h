@@ -0,0 +1,23 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+/**
+ * Writes the JSON files of the User Interface Manager tools: boot preload list, transition model, debugger dumps,
+ * benchmark, soak, replay and audit results.
+ */
+class EASYUSERINTERFACEMANAGEMENT_API FEasyUserInterfaceJson
+{
+public:
+	/**
+	 * Writes a JSON object as a pretty printed file.
+	 * @param Object The object to write.
+	 * @param OutputPath The file to write to.
+	 * @return True if the file was written.
+	 */
+	static bool WriteToFile(const TSharedRef<FJsonObject>& Object, const FString& OutputPath);
+};
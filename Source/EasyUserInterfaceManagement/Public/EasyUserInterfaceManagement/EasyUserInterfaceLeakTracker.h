@@ -0,0 +1,52 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UEasyUserInterfaceRootWidget;
+class UUserWidget;
+
+/**
+ * Debug mode finding the widgets created by the plugin that stay alive after they are released: activatable widgets popped
+ * from their stack, dismissed notifications and resolved prompts that are still referenced by a delegate or a lambda.
+ *
+ * Enabled with "EasyUI.LeakTracking 1". After every garbage collection, the tracked widgets that are neither on a stack,
+ * in a notification panel nor in a container or notification pool are checked, and the ones that survived a few collections while released
+ * are reported once with their direct referencers and their shortest reference chain.
+ * "EasyUI.Leaks [Check|Reset]" forces a check or resets the counter, automation can read it from GetNumLeakedWidgets.
+ */
+class EASYUSERINTERFACEMANAGEMENT_API FEasyUserInterfaceLeakTracker
+{
+public:
+	/** Starts or stops tracking the widgets created by the plugin, stopping forgets the tracked widgets. */
+	static void SetTrackingEnabled(bool bEnabled);
+	/** Checks if the widgets created by the plugin are tracked, TrackWidget does nothing otherwise. */
+	static bool IsTracking() { return bIsTracking; }
+
+	/**
+	 * Tracks a widget created by the plugin.
+	 * @param Widget The created widget.
+	 * @param RootWidget The root widget holding the widget while it is in use, the widget is released once the root widget no longer holds it.
+	 */
+	static void TrackWidget(UUserWidget& Widget, const UEasyUserInterfaceRootWidget* RootWidget);
+
+	/**
+	 * Runs a full garbage collection and checks the tracked widgets right away, instead of waiting for the next collection.
+	 * @return The number of leaked widgets found since the last reset.
+	 */
+	static int32 CheckNow();
+	/** Retrieves the number of leaked widgets found since the last reset. */
+	static int32 GetNumLeakedWidgets();
+	/** Resets the leaked widget counter, widgets already reported are not reported again. */
+	static void ResetLeakCount();
+
+private:
+	/** Checks the tracked widgets, the widgets that died are forgotten */
+	static void CheckTrackedWidgets();
+	/** Checks the tracked widgets on the next frame, reference searches are not allowed while the collector is finishing */
+	static void HandlePostGarbageCollect();
+
+	/** Global so the creation paths can early out without looking up the tracked widgets */
+	static bool bIsTracking;
+};
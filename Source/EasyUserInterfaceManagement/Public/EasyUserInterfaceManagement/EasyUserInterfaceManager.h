@@ -4,18 +4,39 @@
 
 #include "CoreMinimal.h"
 #include "CommonInputModeTypes.h"
+#include "Containers/Ticker.h"
 #include "GameplayTagContainer.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceBootPreloader.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceMemory.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceNotificationBacklog.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceNotificationThrottle.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceNotificationTimingWheel.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfacePrefetcher.h"
 #include "ExtensionCommonUI/EasyUserInterfaceRootWidget.h"
 #include "ExtensionCommonUI/Notification/EasyNotificationWidget.h"
 #include "ExtensionCommonUI/PromptQuestion/EasyPromptQuestion.h"
 #include "Subsystems/LocalPlayerSubsystem.h"
 #include "EasyUserInterfaceManager.generated.h"
 
+class UGameInstance;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnRootWidgetAddedToViewport, UEasyUserInterfaceRootWidget*, RootWidget);
-DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnNotificationAddedToPanel, FGameplayTag, LayerTag, UEasyNotificationWidget*, NotificationWidget);
 
 DECLARE_DYNAMIC_DELEGATE_OneParam(FPromtResultEventDelegate, EPromptQuestionResult, Result);
 
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLayerWidgetChanged, FGameplayTag, LayerTag, UCommonActivatableWidget*, Widget);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnLayerNotificationCountChanged, FGameplayTag, LayerTag, int32, NotificationCount);
+
+/** Dismissed notification widgets of a class, waiting to be reused. */
+USTRUCT()
+struct FEasyNotificationWidgetPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY(Transient)
+	TArray<TObjectPtr<UEasyNotificationWidget>> FreeWidgets;
+};
+
 /**
  * Manager for the Easy User Interface system, responsible for managing root widgets and their stacks.
  */
@@ -23,6 +44,19 @@ UCLASS()
 class EASYUSERINTERFACEMANAGEMENT_API UEasyUserInterfaceManager : public ULocalPlayerSubsystem
 {
 	GENERATED_BODY()
+
+	/** Shows the summaries of the rate limited layers */
+	friend class FEasyUserInterfaceNotificationThrottle;
+	/** Shows the queued notifications of the full layers */
+	friend class FEasyUserInterfaceNotificationBacklog;
+	/** Times their lifetime on the timing wheel */
+	friend class UEasyNotificationWidget;
+
+public:
+	//~USubsystem interface
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
 	
 public:
 	/** Adds the specified root widget to the viewport.
@@ -38,11 +72,29 @@ public:
 	 */
 	UFUNCTION(BlueprintPure, Category = "Easy User Interface Management")
 	UEasyUserInterfaceRootWidget* GetRootWidget();
+	/**
+	 * Checks if the root widget is created and added to the viewport, without logging.
+	 * @return True if the root widget is ready to receive widgets and notifications.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy User Interface Management")
+	bool IsRootWidgetReady() const { return IsValid(RootWidget); }
 
 public:
 	/** Event triggered when the root widget is added to the viewport. */
 	UPROPERTY(BlueprintAssignable, Category = "Easy User Interface Management")
 	FOnRootWidgetAddedToViewport OnRootWidgetAddedToViewport;
+	/** Event triggered when a widget is pushed to a stack layer of the root widget. */
+	UPROPERTY(BlueprintAssignable, Category = "Easy User Interface Management|Layer Events")
+	FOnLayerWidgetChanged OnLayerWidgetPushed;
+	/** Event triggered when a widget is popped from a stack layer of the root widget. */
+	UPROPERTY(BlueprintAssignable, Category = "Easy User Interface Management|Layer Events")
+	FOnLayerWidgetChanged OnLayerWidgetPopped;
+	/** Event triggered when the displayed widget of a stack layer changes. Widget is null when the layer gets empty. */
+	UPROPERTY(BlueprintAssignable, Category = "Easy User Interface Management|Layer Events")
+	FOnLayerWidgetChanged OnLayerTopWidgetChanged;
+	/** Event triggered when the number of active notifications of a notification panel changes. */
+	UPROPERTY(BlueprintAssignable, Category = "Easy User Interface Management|Layer Events")
+	FOnLayerNotificationCountChanged OnNotificationCountChanged;
 
 public:
 	/**
@@ -54,6 +106,21 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Easy User Interface Management|Activatable Widget", meta = (Categories = "UI.Layer"))
 	bool PushWidgetToStackAsync(FGameplayTag LayerTag, TSoftClassPtr<UCommonActivatableWidget> InWidget, FOnWidgetUpdatedOnStack OnWidgetAdded);
+	/**
+	 * Pops the widget displayed on the specified stack.
+	 * @param LayerTag The tag representing the activatable widget stack.
+	 * @return The popped widget, or nullptr if the stack is empty or not registered.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy User Interface Management|Activatable Widget", meta = (Categories = "UI.Layer"))
+	UCommonActivatableWidget* PopWidgetFromStack(FGameplayTag LayerTag);
+	/**
+	 * Removes a widget from the specified stack, wherever it is on the stack.
+	 * @param LayerTag The tag representing the activatable widget stack.
+	 * @param Widget The widget to remove.
+	 * @return True if the widget was on the stack and got removed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy User Interface Management|Activatable Widget", meta = (Categories = "UI.Layer"))
+	bool RemoveWidgetFromStack(FGameplayTag LayerTag, UCommonActivatableWidget* Widget);
 
 	/**
 	 * Retrieves the widget stack associated with the specified layer tag.
@@ -63,17 +130,149 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Easy User Interface Management|Activatable Widget", meta = (Categories = "UI.Layer"))
 	UCommonActivatableWidgetStack* GetWidgetStackFromRoot(FGameplayTag LayerTag) const;
 
+	/**
+	 * Same as GetWidgetStackFromRoot, without logging when the root widget or the layer is missing. Safe to call every frame.
+	 * @param LayerTag The tag representing the activatable widget stack.
+	 * @return The widget stack associated with the specified layer tag, or nullptr if not found.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy User Interface Management|Activatable Widget", meta = (Categories = "UI.Layer"))
+	UCommonActivatableWidgetStack* FindWidgetStack(FGameplayTag LayerTag) const;
+	/**
+	 * Retrieves the widget currently displayed on the specified stack layer from the cached layer state, without logging.
+	 * @param LayerTag The tag representing the activatable widget stack.
+	 * @return The displayed widget, or nullptr if the layer is empty or not registered.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy User Interface Management|Activatable Widget", meta = (Categories = "UI.Layer"))
+	UCommonActivatableWidget* GetLayerTopWidget(FGameplayTag LayerTag) const;
+	/**
+	 * Retrieves the number of widgets on the specified stack layer from the cached layer state, without logging.
+	 * @param LayerTag The tag representing the activatable widget stack.
+	 * @return The number of widgets on the layer, 0 if the layer is not registered.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy User Interface Management|Activatable Widget", meta = (Categories = "UI.Layer"))
+	int32 GetLayerWidgetCount(FGameplayTag LayerTag) const;
+
 public:
 	/**
 	 * Adds a notification widget to the specified panel layer asynchronously.
 	 * @param LayerTag The tag representing the notification panel layer.
 	 * @param NotificationWidgetClass The class of the notification widget to be added.
 	 * @param NotificationInfo The information to be displayed in the notification.
-	 * @param OnNotificationAdded Delegate to call when the notification is added to the panel.
+	 * @param OnNotificationAdded Delegate to call when the notification is added to the panel. Called with the notification it was merged into
+	 * if identical to a recent one, and with the summary that counts it if the layer is over its rate limit.
+	 * Not called if the notification waits in the backlog of a full layer and is dropped from it (See GetNotificationBacklog).
 	 * @return True if the request to load and add the notification was initiated, false otherwise. (May fail if the root widget not yet registered or invalid class provided)
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Easy User Interface Management|Notification", meta = (Categories = "UI.NotificationType"))
 	bool AddNotificationToPanel(FGameplayTag LayerTag, TSoftClassPtr<UEasyNotificationWidget> NotificationWidgetClass, const FEasyNotificationWidgetInfo& NotificationInfo, FOnNotificationAddedToPanel OnNotificationAdded);
+	/**
+	 * Native variant of AddNotificationToPanel that carries a shared, immutable payload through the async load.
+	 * The payload is shared, not copied, while the class loads, so it can also be reused for other panels or players.
+	 * Each widget still copies it into its NotificationInfo when shown, and a notification waiting in the backlog of a full layer holds its own copy.
+	 */
+	bool AddNotificationToPanel(FGameplayTag LayerTag, TSoftClassPtr<UEasyNotificationWidget> NotificationWidgetClass, const FEasyNotificationWidgetInfoRef& NotificationInfo, FOnNotificationAddedToPanel OnNotificationAdded);
+
+	/**
+	 * Adds the same notification to every panel layer in LayerTags, sharing one async load and one payload between them.
+	 * @param LayerTags The tags representing the notification panel layers.
+	 * @param NotificationWidgetClass The class of the notification widget to be added.
+	 * @param NotificationInfo The information to be displayed in the notifications.
+	 * @param OnNotificationAdded Delegate to call once per panel when the notification is added to it. Same rules as AddNotificationToPanel.
+	 * @return True if the request to load and add the notifications was initiated, false otherwise.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy User Interface Management|Notification", meta = (Categories = "UI.NotificationType"))
+	bool AddNotificationToPanels(const FGameplayTagContainer& LayerTags, TSoftClassPtr<UEasyNotificationWidget> NotificationWidgetClass, const FEasyNotificationWidgetInfo& NotificationInfo, FOnNotificationAddedToPanel OnNotificationAdded);
+	/** Native variant of AddNotificationToPanels that takes a shared payload. */
+	bool AddNotificationToPanels(const FGameplayTagContainer& LayerTags, TSoftClassPtr<UEasyNotificationWidget> NotificationWidgetClass, const FEasyNotificationWidgetInfoRef& NotificationInfo, FOnNotificationAddedToPanel OnNotificationAdded);
+
+	/**
+	 * Retrieves the notification panel registered for the specified layer, without logging.
+	 * @param LayerTag The tag representing the notification panel layer.
+	 * @return The notification panel, or nullptr if the root widget or the panel is missing.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy User Interface Management|Notification", meta = (Categories = "UI.NotificationType"))
+	UWidget* FindNotificationPanel(FGameplayTag LayerTag) const;
+	/**
+	 * Retrieves the number of notifications shown on the specified panel and not yet removed from it, without logging.
+	 * @param LayerTag The tag representing the notification panel layer.
+	 * @return The number of active notifications, 0 if the root widget or the panel is missing.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy User Interface Management|Notification", meta = (Categories = "UI.NotificationType"))
+	int32 GetActiveNotificationCount(FGameplayTag LayerTag) const;
+	/**
+	 * Retrieves the number of notifications waiting for a free slot on the specified panel (See "LayerMaxVisibleNotifications" in the project settings).
+	 * @param LayerTag The tag representing the notification panel layer.
+	 * @return The number of queued notifications, 0 if the layer has no limit.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy User Interface Management|Notification", meta = (Categories = "UI.NotificationType"))
+	int32 GetQueuedNotificationCount(FGameplayTag LayerTag) const;
+	/**
+	 * Retrieves the number of dismissed notification widgets waiting to be reused, over every class.
+	 * @return The number of pooled notification widgets.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy User Interface Management|Notification")
+	int32 GetNumPooledNotifications() const;
+	/**
+	 * Takes a notification widget back once it is removed on dismissal, and keeps it for a later notification of its class
+	 * if the pool has room. Called by the notification widgets created by this manager.
+	 * @param NotificationWidget The dismissed widget, already removed from its panel.
+	 */
+	void ReleaseNotificationWidget(UEasyNotificationWidget& NotificationWidget);
+
+public:
+	/**
+	 * Builds the memory report of every registered stack and notification layer of the root widget, with their budgets from the project settings.
+	 * Walks every object of the layers, not meant to be called every frame. Also available through the "EasyUI.MemReport" console command.
+	 * @return The memory reports, empty if the root widget is not ready.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy User Interface Management|Memory")
+	TArray<FEasyUserInterfaceLayerMemoryReport> GetLayerMemoryReport() const;
+
+	/** Retrieves the root widget and notification class loads requested by this manager and not yet completed. */
+	const TArray<FEasyUserInterfacePendingLoad>& GetPendingLoads() const { return PendingLoads; }
+	/** Retrieves the prefetcher streaming the widgets reachable from the displayed screens. */
+	const FEasyUserInterfacePrefetcher& GetPrefetcher() const { return Prefetcher; }
+	/** Retrieves the boot preloader streaming the assets the previous session requested at boot. */
+	const FEasyUserInterfaceBootPreloader& GetBootPreloader() const { return BootPreloader; }
+	/** Retrieves the throttle coalescing and rate limiting the notifications. */
+	const FEasyUserInterfaceNotificationThrottle& GetNotificationThrottle() const { return NotificationThrottle; }
+	/** Retrieves the backlog of the notifications waiting for a free slot on their layer. */
+	const FEasyUserInterfaceNotificationBacklog& GetNotificationBacklog() const { return NotificationBacklog; }
+	/** Retrieves the timing wheel dismissing the notifications once their lifetime ends. */
+	const FEasyUserInterfaceNotificationTimingWheel& GetNotificationTimingWheel() const { return NotificationTimingWheel; }
+
+private:
+	/** Root widget and notification class loads requested by this manager and not yet completed */
+	TArray<FEasyUserInterfacePendingLoad> PendingLoads;
+	FEasyUserInterfacePrefetcher Prefetcher;
+	FEasyUserInterfaceBootPreloader BootPreloader;
+	FEasyUserInterfaceNotificationThrottle NotificationThrottle;
+	FEasyUserInterfaceNotificationBacklog NotificationBacklog;
+	FEasyUserInterfaceNotificationTimingWheel NotificationTimingWheel;
+
+private:
+	/** Reuses a pooled notification widget of the class, or creates one. */
+	UEasyNotificationWidget* AcquireNotificationWidget(UClass* NotificationClass);
+	/** Loads the classes to pre-warm and fills their pools, as set in the project settings. */
+	void PrewarmNotificationPools();
+
+	/** Dismissed notification widgets waiting to be reused, per class */
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UClass>, FEasyNotificationWidgetPool> NotificationPools;
+	TSharedPtr<FStreamableHandle> NotificationPoolPrewarmHandle;
+
+	/** Adds a notification class and the assets of its info to the boot preload list, while it is recorded. */
+	void RecordBootPreloadNotification(const TSoftClassPtr<UEasyNotificationWidget>& NotificationWidgetClass, const FEasyNotificationWidgetInfo& NotificationInfo);
+	/**
+	 * Shows a notification of the loaded class on the root widget's panel for LayerTag, unless it is merged into an identical one,
+	 * dropped by the rate limit of the layer or queued until the layer has a free slot.
+	 * @param OnNotificationAdded Added delegates of the notification, several for the summary of rate limited notifications.
+	 * @param bOutCreated Optional, set to true only if a new widget was shown for the notification.
+	 */
+	UEasyNotificationWidget* SpawnNotificationWidget(const FGameplayTag& LayerTag, UClass* LoadedClass, const FEasyNotificationWidgetInfo& NotificationInfo,
+		TConstArrayView<FOnNotificationAddedToPanel> OnNotificationAdded, bool* bOutCreated = nullptr);
+	/** Creates a notification widget of the loaded class and hands it to the root widget's panel for LayerTag, returns null without broadcasting if the layer has no panel. */
+	UEasyNotificationWidget* CreateNotificationWidget(const FGameplayTag& LayerTag, UClass* LoadedClass, const FEasyNotificationWidgetInfo& NotificationInfo, TConstArrayView<FOnNotificationAddedToPanel> OnNotificationAdded);
 
 public:
 	/**
@@ -105,6 +304,69 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Easy User Interface Management|Input")
 	ECommonInputMode GetCurrentCommonInputMode(const APlayerController* PlayerController) const;
 
+public:
+	/**
+	 * Refreshes the localized text of every live widget of this player that implements IEasyLocalizedWidgetInterface.
+	 * The refresh is spread over multiple frames, stacks, pools and loaded assets are left untouched.
+	 * Called automatically when the culture changes (See "bRefreshLocalizedTextOnCultureChange" in the project settings).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy User Interface Management|Localization")
+	void RefreshLocalizedText();
+	/**
+	 * Checks if a localized text refresh is still in progress.
+	 * @return True if some widgets are still waiting for their localized text to be refreshed.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy User Interface Management|Localization")
+	bool IsRefreshingLocalizedText() const { return LocalizedTextRefreshTickerHandle.IsValid(); }
+
+public:
+	/**
+	 * Marks the User Interface as shutting down, so plugin widgets skip their per-widget teardown work and broadcasts
+	 * (unregistering input bindings, prompt result executions, notification dismiss actions...) until the game exits.
+	 * Pending work of this manager is dropped as well. Intended to be called right before quitting the game.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy User Interface Management")
+	void BeginFastExit();
+	/**
+	 * Checks if the User Interface is shutting down after a call to BeginFastExit.
+	 * @return True if plugin widgets should skip their teardown work.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Easy User Interface Management")
+	static bool IsUserInterfaceShuttingDown() { return bIsUserInterfaceShuttingDown; }
+
+private:
+	friend class FEasyUserInterfaceManagementModule;
+
+	/** Drops the pending work and the helper state of this manager, called again by Deinitialize after a fast exit */
+	void ReleaseManagerState();
+	/** Clears the fast exit once a game instance starts, bound by the module */
+	static void HandleStartGameInstance(UGameInstance* GameInstance);
+
+	/** Global since widgets are torn down after their Local Player (and its subsystems) on exit */
+	static bool bIsUserInterfaceShuttingDown;
+
+private:
+	/** Binds the layer events of the newly created root widget */
+	void BindRootWidgetEvents();
+	void HandleLayerWidgetPushed(const FGameplayTag& LayerTag, UCommonActivatableWidget* Widget);
+	void HandleLayerWidgetPopped(const FGameplayTag& LayerTag, UCommonActivatableWidget* Widget);
+	void HandleLayerTopWidgetChanged(const FGameplayTag& LayerTag, UCommonActivatableWidget* Widget);
+	void HandleNotificationCountChanged(const FGameplayTag& LayerTag, int32 NotificationCount);
+	/** Records the input mode changes of the player on the EasyUI trace channel, only bound when tracing is compiled in */
+	void HandleActiveInputModeChanged(ECommonInputMode NewInputMode);
+
+private:
+	/** Called by the internationalization system when the current culture changes */
+	void HandleCultureChanged();
+	/** Refreshes the next slice of pending widgets, returns false once every widget is refreshed */
+	bool TickLocalizedTextRefresh(float DeltaTime);
+
+	/** Widgets waiting for their localized text to be refreshed */
+	TArray<TWeakObjectPtr<UUserWidget>> PendingLocalizedTextRefresh;
+	/** Index of the next widget to refresh in PendingLocalizedTextRefresh */
+	int32 NextLocalizedTextRefreshIndex = 0;
+	FTSTicker::FDelegateHandle LocalizedTextRefreshTickerHandle;
+
 public:
 	/**
 	 * Globally accessible root widget managed by this User Interface Manager.
@@ -0,0 +1,74 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "EasyUserInterfaceMemory.generated.h"
+
+class UEasyUserInterfaceRootWidget;
+
+/** Low Level Memory Tracker tags of the allocations made by the plugin, shown under "EasyUI" in memreport and LLM stats */
+LLM_DECLARE_TAG_API(EasyUI, EASYUSERINTERFACEMANAGEMENT_API);
+LLM_DECLARE_TAG_API(EasyUI_Widgets, EASYUSERINTERFACEMANAGEMENT_API);
+LLM_DECLARE_TAG_API(EasyUI_Notifications, EASYUSERINTERFACEMANAGEMENT_API);
+LLM_DECLARE_TAG_API(EasyUI_Prompts, EASYUSERINTERFACEMANAGEMENT_API);
+
+/**
+ * Memory held by the widgets of a layer of the root widget.
+ */
+USTRUCT(BlueprintType)
+struct FEasyUserInterfaceLayerMemoryReport
+{
+	GENERATED_BODY()
+
+	/** The widget stack or notification panel layer */
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+	FGameplayTag LayerTag;
+	/** Number of live widgets on the layer (stack widgets or active notifications) */
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+	int32 NumWidgets = 0;
+	/** Number of UObjects owned by those widgets, widgets included */
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+	int32 NumObjects = 0;
+	/** Exclusive size of those UObjects, in bytes */
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+	int64 ObjectBytes = 0;
+	/** Resident size of the distinct textures directly referenced by those UObjects, in bytes */
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+	int64 TextureBytes = 0;
+	/** Number of distinct textures directly referenced by those UObjects */
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+	int32 NumTextures = 0;
+	/** Names of the widget classes resident on the layer */
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+	TArray<FName> ResidentClasses;
+	/** The budget of the layer from the project settings in bytes, 0 if the layer has no budget */
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+	int64 BudgetBytes = 0;
+	/** True if the layer has a budget and its total memory goes over it */
+	UPROPERTY(BlueprintReadOnly, Category = "Memory")
+	bool bIsOverBudget = false;
+
+	/** Total memory accounted to the layer */
+	int64 GetTotalBytes() const { return ObjectBytes + TextureBytes; }
+};
+
+/**
+ * Per layer memory accounting of a root widget, also available through the "EasyUI.MemReport" console command.
+ * Only UObject memory is accounted (widgets, their widget trees and the textures they reference), Slate widgets are not.
+ */
+class EASYUSERINTERFACEMANAGEMENT_API FEasyUserInterfaceMemory
+{
+public:
+	/**
+	 * Builds the memory report of a layer. Walks every object of the layer, not meant to be called every frame.
+	 * @param RootWidget The root widget the layer is registered to.
+	 * @param LayerTag The widget stack or notification panel layer.
+	 * @return The memory report of the layer.
+	 */
+	static FEasyUserInterfaceLayerMemoryReport BuildLayerReport(const UEasyUserInterfaceRootWidget& RootWidget, const FGameplayTag& LayerTag);
+	/** Builds the memory reports of every registered layer of the root widget. */
+	static TArray<FEasyUserInterfaceLayerMemoryReport> BuildReport(const UEasyUserInterfaceRootWidget& RootWidget);
+};
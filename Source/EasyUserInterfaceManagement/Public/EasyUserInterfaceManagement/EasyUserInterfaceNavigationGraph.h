@@ -0,0 +1,66 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GameplayTagContainer.h"
+#include "EasyUserInterfaceNavigationGraph.generated.h"
+
+class UUserWidget;
+
+/**
+ * A widget that can be opened from a screen, by one of its button actions.
+ */
+USTRUCT(BlueprintType)
+struct FEasyUserInterfaceNavigationEdge
+{
+	GENERATED_BODY()
+
+	/** The opened widget class */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Navigation")
+	TSoftClassPtr<UUserWidget> WidgetClass;
+	/** The stack layer the widget is pushed to, or the notification type of a notification */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Navigation")
+	FGameplayTag LayerTag;
+};
+
+/**
+ * The widgets a screen can open.
+ */
+USTRUCT(BlueprintType)
+struct FEasyUserInterfaceNavigationNode
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Navigation")
+	TArray<FEasyUserInterfaceNavigationEdge> Edges;
+};
+
+/**
+ * Which widgets each widget class of the project can open through its button actions (Push Widget, Push Question Prompt,
+ * Add Notification and the nested Multiple actions). Generated by the "EasyUserInterfaceNavigationGraph" commandlet
+ * or at the start of every cook, and used by the User Interface Manager to stream the widgets reachable from the displayed screens
+ * (See "Navigation Graph" in the project settings).
+ */
+UCLASS(BlueprintType)
+class EASYUSERINTERFACEMANAGEMENT_API UEasyUserInterfaceNavigationGraph : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** The widgets each widget class can open, classes without edges are omitted */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Navigation")
+	TMap<TSoftClassPtr<UUserWidget>, FEasyUserInterfaceNavigationNode> Nodes;
+
+public:
+	/**
+	 * Retrieves the widget classes reachable in one hop from a widget class.
+	 * @param WidgetClass The class of the displayed widget.
+	 * @param OutWidgetClasses The reachable classes, without duplicates.
+	 */
+	void GetReachableWidgetClasses(const UClass* WidgetClass, TArray<FSoftObjectPath>& OutWidgetClasses) const;
+
+	/** Retrieves the number of edges of the graph. */
+	int32 GetNumEdges() const;
+};
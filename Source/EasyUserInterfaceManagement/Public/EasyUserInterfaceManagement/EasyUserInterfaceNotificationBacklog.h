@@ -0,0 +1,80 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "GameplayTagContainer.h"
+#include "ExtensionCommonUI/Notification/EasyNotificationWidget.h"
+#include "UObject/StrongObjectPtr.h"
+
+class UEasyUserInterfaceManager;
+
+/**
+ * Bounds the number of notifications visible at once on the layers listed under "Notifications" in the project settings.
+ * Owned by the User Interface Manager, which queues the notifications of a full layer here instead of creating their widget.
+ *
+ * A queued notification only holds its class and info. It is shown once the layer has a free slot, the highest
+ * NotificationPriority first and, among equal priorities, the oldest first. Entries waiting longer than the maximum wait are dropped.
+ */
+class EASYUSERINTERFACEMANAGEMENT_API FEasyUserInterfaceNotificationBacklog
+{
+public:
+	void Initialize(UEasyUserInterfaceManager& InManager);
+	/** Drops the queued notifications. */
+	void Deinitialize();
+
+	/**
+	 * Checks if a new notification of a layer must wait in the backlog.
+	 * @param LayerTag The notification panel layer.
+	 * @return True if the layer shows its maximum number of notifications, or already has notifications waiting.
+	 */
+	bool ShouldQueueNotification(const FGameplayTag& LayerTag) const;
+	/**
+	 * Queues a notification until its layer has a free slot. When the backlog of the layer is full, its lowest priority entry is dropped.
+	 * @param LayerTag The notification panel layer.
+	 * @param NotificationClass The loaded class of the notification, kept loaded while queued.
+	 * @param NotificationInfo The info of the notification.
+	 * @param OnNotificationAdded Delegates to call once the notification is shown, dropped with the entry.
+	 */
+	void EnqueueNotification(const FGameplayTag& LayerTag, UClass* NotificationClass, const FEasyNotificationWidgetInfo& NotificationInfo, TConstArrayView<FOnNotificationAddedToPanel> OnNotificationAdded);
+	/** Schedules the promotion of the queued notifications of a layer once one of its notifications is dismissed. */
+	void HandleNotificationCountChanged(const FGameplayTag& LayerTag, int32 NotificationCount);
+
+	/** Retrieves the number of notifications waiting on a layer. */
+	int32 GetNumQueued(const FGameplayTag& LayerTag) const;
+	/** Retrieves the number of notifications waiting, over every layer. */
+	int32 GetNumQueued() const;
+	/** Retrieves the number of notifications dropped from the backlog without being shown, because they waited longer than the maximum wait. */
+	int32 GetNumExpired() const { return NumExpired; }
+	/** Retrieves the number of notifications dropped without being shown, because the backlog of their layer was full. */
+	int32 GetNumEvicted() const { return NumEvicted; }
+
+private:
+	struct FQueuedNotification
+	{
+		TStrongObjectPtr<UClass> NotificationClass;
+		FEasyNotificationWidgetInfo NotificationInfo;
+		/** Bound added delegates, a summary of rate limited notifications carries the delegates of all of them */
+		TArray<FOnNotificationAddedToPanel> OnNotificationAdded;
+		double QueuedTime = 0.0;
+		/** Order the notification was queued in, breaks priority ties */
+		uint64 Sequence = 0;
+	};
+
+	/** Heap order, the entry shown next is on top */
+	static bool IsShownBefore(const FQueuedNotification& Notification, const FQueuedNotification& OtherNotification);
+	/** Drops the entries waiting longer than the maximum wait */
+	void RemoveExpired(TArray<FQueuedNotification>& Queue, double Now);
+	void RemoveQueued(int32 Count);
+	/** Shows the queued notifications of the layers with free slots */
+	bool TickPromotions(float DeltaTime);
+
+	TWeakObjectPtr<UEasyUserInterfaceManager> Manager;
+	TMap<FGameplayTag, TArray<FQueuedNotification>> Queues;
+	FTSTicker::FDelegateHandle PromotionTickerHandle;
+
+	uint64 NextSequence = 0;
+	int32 NumExpired = 0;
+	int32 NumEvicted = 0;
+};
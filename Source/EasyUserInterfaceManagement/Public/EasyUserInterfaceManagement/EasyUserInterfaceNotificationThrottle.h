@@ -0,0 +1,84 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "GameplayTagContainer.h"
+#include "ExtensionCommonUI/Notification/EasyNotificationWidget.h"
+
+class UEasyUserInterfaceManager;
+
+/**
+ * Bounds the cost of notification storms on the notification panels of the User Interface Manager, configured under
+ * "Notifications" in the project settings. Owned by the manager, which runs every notification through it before creating a widget.
+ *
+ * - A notification identical to one shown on the layer within the coalesce window (same class, header and body) is merged into it:
+ *   its counter is incremented and its lifetime restarts, no widget is created.
+ * - The layers with a rate limit admit notifications through a token bucket. The notifications over the limit are dropped and
+ *   counted, and shown as a single summary notification once the layer has a token again. Their added delegates go with the summary,
+ *   they are called once it is shown, or dropped with it if it never is.
+ *
+ * Both the coalesce window and the buckets run on the world time, the clock the notification lifetimes run on.
+ */
+class EASYUSERINTERFACEMANAGEMENT_API FEasyUserInterfaceNotificationThrottle
+{
+public:
+	void Initialize(UEasyUserInterfaceManager& InManager);
+	/** Forgets the buckets and the pending summaries. */
+	void Deinitialize();
+
+	/**
+	 * Finds the notification shown on a layer that an identical new notification can be merged into.
+	 * @param LayerTag The notification panel layer.
+	 * @param NotificationClass The class of the new notification.
+	 * @param NotificationInfo The info of the new notification.
+	 * @return The notification to merge into, null if none or if coalescing is disabled.
+	 */
+	UEasyNotificationWidget* FindCoalescableNotification(const FGameplayTag& LayerTag, const UClass* NotificationClass, const FEasyNotificationWidgetInfo& NotificationInfo) const;
+	/**
+	 * Takes a token from the bucket of a layer. Without a token, the notification is counted in the summary of the layer.
+	 * @param LayerTag The notification panel layer.
+	 * @param NotificationClass The class of the new notification, used to show the summary.
+	 * @param NotificationInfo The info of the new notification, the summary keeps its icon and duration.
+	 * @param OnNotificationAdded Delegates of the new notification, called with the summary if the notification is dropped.
+	 * @return True if the notification can be shown, always true on layers without a rate limit.
+	 */
+	bool TryAdmitNotification(const FGameplayTag& LayerTag, UClass* NotificationClass, const FEasyNotificationWidgetInfo& NotificationInfo, TConstArrayView<FOnNotificationAddedToPanel> OnNotificationAdded);
+
+	/** Retrieves the number of notifications merged into a shown one. */
+	int32 GetNumCoalesced() const { return NumCoalesced; }
+	/** Retrieves the number of notifications dropped by the rate limits, shown in summaries. */
+	int32 GetNumRateLimited() const { return NumRateLimited; }
+	/** Counts a merged notification. */
+	void RecordCoalesced();
+
+private:
+	struct FLayerBucket
+	{
+		double Tokens = 0.0;
+		double LastRefillTime = 0.0;
+		/** Notifications dropped since the last summary, and the last one of them */
+		int32 NumOverflowed = 0;
+		TWeakObjectPtr<UClass> OverflowClass;
+		FEasyNotificationWidgetInfo OverflowInfo;
+		/** Added delegates of the dropped notifications */
+		TArray<FOnNotificationAddedToPanel> OverflowDelegates;
+	};
+
+	/** Adds the tokens earned since the last refill, returns false if the layer has no rate limit */
+	bool RefillBucket(const FGameplayTag& LayerTag, FLayerBucket& Bucket) const;
+	/** Retrieves the world time of the manager, the clock of the buckets */
+	double GetTime() const;
+	/** Shows the summary of the layers that got a token back */
+	bool TickOverflowSummaries(float DeltaTime);
+
+	TWeakObjectPtr<UEasyUserInterfaceManager> Manager;
+	TMap<FGameplayTag, FLayerBucket> Buckets;
+	FTSTicker::FDelegateHandle SummaryTickerHandle;
+
+	int32 NumCoalesced = 0;
+	int32 NumRateLimited = 0;
+	/** Set while a summary is shown, it is admitted ahead of the notifications that came after it */
+	bool bIsShowingSummary = false;
+};
@@ -0,0 +1,85 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/ObjectKey.h"
+
+class UEasyNotificationWidget;
+class UEasyUserInterfaceManager;
+
+/**
+ * Times the lifetime of every notification of a User Interface Manager, instead of a world timer per notification.
+ * Owned by the manager, notifications created for its player schedule their lifetime here.
+ *
+ * The lifetimes are hashed by expiry time into the slots of a wheel. Each frame only the slots the world time went past
+ * are checked, expired notifications are dismissed in one batch, capped by "NotificationDismissalsPerFrame" in the project settings.
+ * The remaining time of the subscribed notifications is published to them in the same pass, so they do not poll GetTimeRemaining.
+ * Follows the world time, so lifetimes pause and dilate like world timers.
+ */
+class EASYUSERINTERFACEMANAGEMENT_API FEasyUserInterfaceNotificationTimingWheel
+{
+public:
+	void Initialize(UEasyUserInterfaceManager& InManager);
+	/** Forgets the lifetimes, their notifications are not dismissed. */
+	void Deinitialize();
+
+	/**
+	 * Schedules the dismissal of a notification, replacing its previous lifetime.
+	 * @param NotificationWidget The notification.
+	 * @param Duration Lifetime of the notification in seconds, from now.
+	 * @param bPublishProgress If true, the remaining time is published to the notification every frame until it expires.
+	 * @return False if the manager has no world to time the lifetime with.
+	 */
+	bool ScheduleLifetime(UEasyNotificationWidget& NotificationWidget, float Duration, bool bPublishProgress);
+	/** Cancels the lifetime of a notification, if scheduled. */
+	void CancelLifetime(const UEasyNotificationWidget& NotificationWidget);
+
+	/** Retrieves the number of notifications with a scheduled lifetime. */
+	int32 GetNumScheduled() const { return Lifetimes.Num(); }
+
+private:
+	struct FLifetime
+	{
+		TWeakObjectPtr<UEasyNotificationWidget> NotificationWidget;
+		double StartTime = 0.0;
+		float Duration = 0.0f;
+		/** Identifies the slot entry of the lifetime, the entries of replaced lifetimes are skipped */
+		uint32 Serial = 0;
+		bool bPublishProgress = false;
+	};
+	struct FSlotEntry
+	{
+		TObjectKey<UEasyNotificationWidget> NotificationKey;
+		double ExpireTime = 0.0;
+		uint32 Serial = 0;
+	};
+	struct FProgressUpdate
+	{
+		TWeakObjectPtr<UEasyNotificationWidget> NotificationWidget;
+		float TimeRemaining = 0.0f;
+		float Ratio = 0.0f;
+	};
+
+	double GetWorldTime() const;
+	int64 GetSlotTick(double Time) const;
+	void AddSlotEntry(const TObjectKey<UEasyNotificationWidget>& NotificationKey, double ExpireTime, uint32 Serial);
+	/** Expires the lifetimes of a slot, keeps the ones due at a later turn of the wheel */
+	void ExpireSlot(int32 SlotIndex, double Now);
+	bool Tick(float DeltaTime);
+
+	TWeakObjectPtr<UEasyUserInterfaceManager> Manager;
+	TMap<TObjectKey<UEasyNotificationWidget>, FLifetime> Lifetimes;
+	TArray<TArray<FSlotEntry>> Slots;
+	/** Expired notifications waiting for their dismissal, in expiry order */
+	TArray<TWeakObjectPtr<UEasyNotificationWidget>> PendingDismissals;
+	/** Progress published this frame, kept to reuse its allocation */
+	TArray<FProgressUpdate> ProgressUpdates;
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	/** Last wheel tick whose slot was checked */
+	int64 LastSlotTick = 0;
+	uint32 NextSerial = 0;
+	int32 NumPublishingProgress = 0;
+};
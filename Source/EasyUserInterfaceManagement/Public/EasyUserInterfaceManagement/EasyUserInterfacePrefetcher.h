@@ -0,0 +1,101 @@
+// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "GameplayTagContainer.h"
+
+class UEasyUserInterfaceManager;
+class UEasyUserInterfaceNavigationGraph;
+struct FStreamableHandle;
+
+/**
+ * Streams the widget classes likely to be opened next from the widget displayed on each stack layer, so opening the next
+ * screen does not wait for its class to load. Owned by the User Interface Manager, configured under "Preloading" in the project settings.
+ *
+ * Two sources are prefetched:
+ * - The classes reachable in one hop in the navigation graph, as soon as a widget is displayed.
+ * - The classes most often pushed after the displayed one on its layer, learned while playing. They are prefetched once the
+ *   User Interface is idle, within a memory budget, and the model can be saved between sessions.
+ * The classes prefetched for a layer are released once another widget is displayed on it.
+ */
+class EASYUSERINTERFACEMANAGEMENT_API FEasyUserInterfacePrefetcher
+{
+public:
+	/** Starts loading the navigation graph and the saved transition model, as enabled in the project settings. */
+	void Initialize(UEasyUserInterfaceManager& InManager);
+	/** Saves the transition model if enabled, and releases the navigation graph and the prefetched classes. */
+	void Deinitialize();
+
+	/**
+	 * Checks if a requested widget class is already loaded. Counts a hit if it was prefetched, or a miss if it has to be loaded.
+	 * @param WidgetClass The requested class.
+	 */
+	void RecordWidgetRequest(const FSoftObjectPath& WidgetClass);
+	/** Learns that the widget was pushed after the widget displayed on the layer. */
+	void HandleLayerWidgetPushed(const FGameplayTag& LayerTag, const UObject* Widget);
+	/**
+	 * Prefetches the classes reachable from the widget now displayed on a layer, and releases the ones prefetched for the previous one.
+	 * @param LayerTag The stack layer.
+	 * @param Widget The displayed widget, null if the layer got empty.
+	 */
+	void HandleLayerTopWidgetChanged(const FGameplayTag& LayerTag, const UObject* Widget);
+
+	/**
+	 * Retrieves the classes most often pushed after a class on a layer.
+	 * @param LayerTag The stack layer.
+	 * @param FromClass The displayed class, null for an empty layer.
+	 * @param MinProbability The minimum observed probability of the transitions.
+	 * @param OutClasses The classes, the most probable first.
+	 */
+	void GetProbableNextClasses(const FGameplayTag& LayerTag, const UClass* FromClass, float MinProbability, TArray<FSoftObjectPath>& OutClasses) const;
+
+	/** Retrieves the navigation graph, null until it is loaded or if none is set. */
+	const UEasyUserInterfaceNavigationGraph* GetNavigationGraph() const;
+	/** Retrieves the number of classes currently kept loaded by the prefetches. */
+	int32 GetNumPrefetchedClasses() const;
+	/** Retrieves the number of requested widget classes that were loaded thanks to a prefetch. */
+	int32 GetNumHits() const { return NumHits; }
+	/** Retrieves the number of requested widget classes that had to be loaded on request. */
+	int32 GetNumMisses() const { return NumMisses; }
+
+	/** Writes the transition model to GetTransitionModelPath. */
+	bool SaveTransitionModel() const;
+	/** Reads the transition model from GetTransitionModelPath, replacing the learned one. */
+	bool LoadTransitionModel();
+	/** Retrieves the file the transition model is saved to. */
+	static FString GetTransitionModelPath();
+
+private:
+	struct FLayerPrefetch
+	{
+		/** Class displayed on the layer */
+		TWeakObjectPtr<const UClass> TopClass;
+		TSharedPtr<FStreamableHandle> GraphHandle;
+		TSharedPtr<FStreamableHandle> LearnedHandle;
+		/** Classes requested by both handles */
+		TArray<FSoftObjectPath> PrefetchedClasses;
+		/** Estimated size of the classes prefetched from the transition model, counted against the budget */
+		int64 LearnedBytes = 0;
+		FTSTicker::FDelegateHandle LearnedPrefetchTickerHandle;
+	};
+
+	/** Streams the classes reachable from the class displayed on the layer in the navigation graph */
+	void PrefetchFromGraph(const FGameplayTag& LayerTag);
+	/** Waits for the User Interface to be idle, then streams the most probable next classes of the layer */
+	bool TickLearnedPrefetch(float DeltaTime, FGameplayTag LayerTag);
+	/** Checks that no widget is loading and that the layer is done transitioning */
+	bool IsIdle(const FGameplayTag& LayerTag) const;
+	void ReleaseLayer(FLayerPrefetch& LayerPrefetch);
+
+	TWeakObjectPtr<UEasyUserInterfaceManager> Manager;
+	TSharedPtr<FStreamableHandle> NavigationGraphHandle;
+	TMap<FGameplayTag, FLayerPrefetch> Layers;
+
+	/** Number of times each class was pushed after another one, per layer. The source is null when the layer was empty */
+	TMap<FGameplayTag, TMap<FSoftObjectPath, TMap<FSoftObjectPath, uint32>>> TransitionCounts;
+
+	int32 NumHits = 0;
+	int32 NumMisses = 0;
+};
@@ -0,0 +1,102 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CommonInputModeTypes.h"
+#include "GameplayTagContainer.h"
+#include "Engine/EngineBaseTypes.h"
+#include "ExtensionCommonUI/PromptQuestion/EasyPromptQuestion.h"
+
+class FJsonObject;
+class UEasyUserInterfaceManager;
+class ULocalPlayer;
+class UWidget;
+struct FEasyNotificationWidgetInfo;
+
+/** Public User Interface operations captured by the session recorder. */
+enum class EEasyUserInterfaceReplayOperation : uint8
+{
+	PushWidget,
+	AddNotification,
+	PushPrompt,
+	PromptAnswer,
+	TabSelected,
+	InputModeChanged
+};
+
+/**
+ * Parameters of a replay run, parsed from the "EasyUI.Replay" command arguments.
+ */
+struct FEasyUserInterfaceReplayParams
+{
+	/** Trace file to replay ("Input="), defaults to Saved/EasyUI/Session.euitrace */
+	FString InputPath;
+	/** File the JSON results are written to ("Output="), defaults to Saved/EasyUI/Replay.json */
+	FString OutputPath;
+	/** Requests the game to exit once the results are written, with a non zero status on failure ("-Exit") */
+	bool bExitWhenDone = false;
+	/** Seconds to wait for the root widget to be added to the viewport and the classes of the trace to load before failing ("Timeout=") */
+	float RootWidgetTimeout = 30.0f;
+	/** Frames to keep measuring after the last operation, so its loads and transitions are accounted ("SettleFrames=") */
+	int32 SettleFrames = 60;
+
+	/** Parses the parameters from console command arguments. */
+	static FEasyUserInterfaceReplayParams FromArgs(const TArray<FString>& Args);
+};
+
+/**
+ * Records the public operations of a local player's User Interface (pushes, notifications, prompts and their answers,
+ * tab selections and input mode changes) with their frame offsets into a compact binary trace, and replays such a trace.
+ *
+ * Capture a real session with "EasyUI.Record Start" / "EasyUI.Record Stop [Output=Path.euitrace]", then replay it in a
+ * headless build to catch performance regressions, e.g:
+ * -nullrhi -deterministic -ExecCmds="EasyUI.Replay Input=Session.euitrace -Exit"
+ * The classes and assets referenced by the trace are loaded asynchronously before the first operation.
+ * Operations are replayed at the same frame offsets they were recorded at, and the replay writes the latency
+ * summaries of the manager operations and the frame times as JSON.
+ */
+class EASYUSERINTERFACEMANAGEMENT_API FEasyUserInterfaceReplay
+{
+public:
+	/**
+	 * Starts recording the operations of a local player.
+	 * @return False if a recording or a replay is already in progress.
+	 */
+	static bool StartRecording(const ULocalPlayer& LocalPlayer);
+	/**
+	 * Stops the recording and writes the trace.
+	 * @param OutputPath The trace file to write.
+	 * @return True if a recording was in progress and its trace was written.
+	 */
+	static bool StopRecording(const FString& OutputPath);
+	/** Checks if operations are being recorded, the Record functions do nothing otherwise. */
+	static bool IsRecording() { return bIsRecording; }
+
+	/**
+	 * Replays a trace on the manager once its root widget is ready, then writes the results.
+	 * @return False if the trace could not be read or a recording or a replay is already in progress.
+	 */
+	static bool StartReplay(UEasyUserInterfaceManager& Manager, const FEasyUserInterfaceReplayParams& Params);
+	/** Checks if a trace is being replayed. */
+	static bool IsReplaying();
+
+	/** Retrieves the trace path used when no path is given. */
+	static FString GetDefaultTracePath();
+	/** Retrieves the path the replay results are written to when no output is given. */
+	static FString GetDefaultResultsPath();
+
+public:
+	static void RecordPushWidget(const ULocalPlayer* LocalPlayer, const FGameplayTag& LayerTag, const FSoftObjectPath& WidgetClass);
+	static void RecordAddNotification(const ULocalPlayer* LocalPlayer, const FGameplayTagContainer& LayerTags, const FSoftObjectPath& NotificationClass, const FEasyNotificationWidgetInfo& NotificationInfo);
+	static void RecordPushPrompt(const ULocalPlayer* LocalPlayer, const FGameplayTag& LayerTag, const UClass* PromptClass, const FPromptQuestionBodyInfo& QuestionBodyInfo);
+	/** Records a prompt answered by the player, the layer is found from the prompt. */
+	static void RecordPromptAnswer(const UEasyPromptQuestion& Prompt, EPromptQuestionResult Result);
+	/** Records a tab selection, the tab list is identified by its name in the widget tree of the widget displayed on its layer. */
+	static void RecordTabSelected(const UWidget& TabList, FName TabId);
+	static void RecordInputModeChanged(const ULocalPlayer* LocalPlayer, ECommonInputMode InputMode, EMouseCaptureMode MouseCaptureMode, bool bHideMouse);
+
+private:
+	/** Global so the record calls can early out without looking up the recording session */
+	static bool bIsRecording;
+};
@@ -0,0 +1,263 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataTable.h"
+#include "Engine/DeveloperSettings.h"
+#include "GameplayTagContainer.h"
+#include "ExtensionCommonUI/ActivatableWidget/EasyActivatableWidgetBase.h"
+#include "EasyUserInterfaceSettings.generated.h"
+
+class UCommonActivatableWidget;
+class UEasyCommonButtonExtended;
+class UEasyNotificationWidget;
+class UEasyPromptQuestion;
+class UEasyUserInterfaceRootWidget;
+class UEasyUserInterfaceNavigationGraph;
+class UUserWidget;
+
+/**
+ * Size limits of the assets a widget class or a layer keeps loaded through hard references, checked by the
+ * "EasyUserInterfaceReferenceAudit" commandlet. A limit of 0 is not checked.
+ */
+USTRUCT(BlueprintType)
+struct FEasyHardReferenceBudget
+{
+	GENERATED_BODY()
+
+	/** Maximum size on disk of the hard referenced packages, in megabytes */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Budget", meta = (ClampMin = "0", Units = "MB"))
+	float MaxDiskSizeMB = 0.0f;
+	/** Maximum size in memory of the hard referenced assets, in megabytes. Only checked when the commandlet measures memory (-Memory) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Budget", meta = (ClampMin = "0", Units = "MB"))
+	float MaxMemorySizeMB = 0.0f;
+};
+
+/**
+ * Token bucket limiting the notifications shown on a notification layer, the notifications over the limit are summarized.
+ */
+USTRUCT(BlueprintType)
+struct FEasyNotificationRateLimit
+{
+	GENERATED_BODY()
+
+	/** Rate the layer earns the right to show a notification at */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Rate Limit", meta = (ClampMin = "0.01"))
+	float NotificationsPerSecond = 2.0f;
+	/** Maximum number of notifications shown at once after a quiet period */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Rate Limit", meta = (ClampMin = "1"))
+	int32 Burst = 5;
+};
+
+/**
+ * Project wide settings of the Easy User Interface Management system.
+ * Can be found under "Project Settings > Plugins > Easy User Interface Management".
+ */
+UCLASS(Config = Game, DefaultConfig, meta = (DisplayName = "Easy User Interface Management"))
+class EASYUSERINTERFACEMANAGEMENT_API UEasyUserInterfaceSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UEasyUserInterfaceSettings();
+
+	//~UDeveloperSettings interface
+	virtual FName GetCategoryName() const override;
+	//~End of UDeveloperSettings interface
+
+	/** Retrieves the settings object, always valid. */
+	static const UEasyUserInterfaceSettings* Get() { return GetDefault<UEasyUserInterfaceSettings>(); }
+
+public:
+	/**
+	 * If true, the User Interface Manager refreshes the localized text of live widgets when the culture changes,
+	 * instead of requiring the User Interface to be rebuilt.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Localization")
+	bool bRefreshLocalizedTextOnCultureChange = true;
+
+	/**
+	 * Maximum number of widgets whose localized text is refreshed per frame after a culture change.
+	 * Spreads the refresh over multiple frames to avoid a hitch when many widgets are alive.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Localization", meta = (ClampMin = "1", EditCondition = "bRefreshLocalizedTextOnCultureChange"))
+	int32 LocalizedTextRefreshWidgetsPerFrame = 32;
+
+public:
+	/**
+	 * Memory budgets of the stack and notification layers in megabytes, checked by the "EasyUI.MemReport" command and
+	 * reported by UEasyUserInterfaceManager::GetLayerMemoryReport. Layers without a budget are only reported.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Memory", meta = (Categories = "UI", ForceInlineRow, ClampMin = "0"))
+	TMap<FGameplayTag, float> LayerMemoryBudgetsMB;
+
+public:
+	/** Budget of the screens whose Performance Budget leaves a limit unchecked (See the "EasyUI.BudgetAudit" automation test). */
+	UPROPERTY(Config, EditAnywhere, Category = "Budgets")
+	FEasyActivatableWidgetBudget DefaultScreenBudget;
+
+public:
+	/**
+	 * If true, compiling an activatable widget blueprint warns about what is costly at runtime: property bindings,
+	 * volatile and ticking widgets, deep or large widget trees and hard references to heavy assets and widget classes.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Performance Linter")
+	bool bEnablePerformanceLinter = true;
+	/** Widget tree depth above which the performance linter warns. */
+	UPROPERTY(Config, EditAnywhere, Category = "Performance Linter", meta = (ClampMin = "1", EditCondition = "bEnablePerformanceLinter"))
+	int32 LinterMaxWidgetTreeDepth = 16;
+	/** Number of widgets in the widget tree above which the performance linter warns. */
+	UPROPERTY(Config, EditAnywhere, Category = "Performance Linter", meta = (ClampMin = "1", EditCondition = "bEnablePerformanceLinter"))
+	int32 LinterMaxWidgetCount = 250;
+	/** Size of a hard referenced asset above which the performance linter warns, in kilobytes. */
+	UPROPERTY(Config, EditAnywhere, Category = "Performance Linter", meta = (ClampMin = "0", Units = "KB", EditCondition = "bEnablePerformanceLinter"))
+	float LinterHeavyAssetSizeKB = 1024.0f;
+
+public:
+	/**
+	 * If true, the User Interface Manager streams the widget classes the displayed screens can open, following the Navigation Graph,
+	 * so the next screen opens without waiting for its class to load.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Preloading")
+	bool bPrefetchReachableWidgets = true;
+	/** Navigation graph generated by the "EasyUserInterfaceNavigationGraph" commandlet, and by every cook if Build Navigation Graph On Cook is set. */
+	UPROPERTY(Config, EditAnywhere, Category = "Preloading", meta = (EditCondition = "bPrefetchReachableWidgets"))
+	TSoftObjectPtr<UEasyUserInterfaceNavigationGraph> NavigationGraph;
+	/**
+	 * If true, a cook rebuilds and saves the Navigation Graph from the widget blueprints under /Game before it starts, so the cooked graph
+	 * matches the cooked content. Turn it off if the graph asset cannot be written during the cook, and run the commandlet before cooking instead.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Preloading", meta = (EditCondition = "bPrefetchReachableWidgets"))
+	bool bBuildNavigationGraphOnCook = true;
+	/**
+	 * If true, the User Interface Manager learns which widget classes are pushed after which on each layer, and streams the
+	 * most probable next classes once the User Interface is idle.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Preloading")
+	bool bLearnTransitions = true;
+	/** If true, the learned transitions are saved to Saved/EasyUI/TransitionModel.json and reloaded on the next session. */
+	UPROPERTY(Config, EditAnywhere, Category = "Preloading", meta = (EditCondition = "bLearnTransitions"))
+	bool bPersistTransitionModel = false;
+	/** Maximum number of learned classes prefetched from a displayed widget. */
+	UPROPERTY(Config, EditAnywhere, Category = "Preloading", meta = (ClampMin = "0", EditCondition = "bLearnTransitions"))
+	int32 LearnedPrefetchMaxClasses = 3;
+	/** Minimum observed probability of a transition for its class to be prefetched. */
+	UPROPERTY(Config, EditAnywhere, Category = "Preloading", meta = (ClampMin = "0", ClampMax = "1", EditCondition = "bLearnTransitions"))
+	float LearnedPrefetchMinProbability = 0.2f;
+	/** Estimated size the learned prefetches may keep loaded over every layer, from the package sizes. 0 is unlimited. */
+	UPROPERTY(Config, EditAnywhere, Category = "Preloading", meta = (ClampMin = "0", Units = "MB", EditCondition = "bLearnTransitions"))
+	float LearnedPrefetchBudgetMB = 32.0f;
+	/** Time a widget has to stay displayed, with no widget loading, before its learned next classes are prefetched. */
+	UPROPERTY(Config, EditAnywhere, Category = "Preloading", meta = (ClampMin = "0", Units = "s", EditCondition = "bLearnTransitions"))
+	float LearnedPrefetchIdleDelay = 0.5f;
+	/**
+	 * If true, the User Interface Manager of the first local player records the widget classes and assets requested during the
+	 * first seconds of the session to Saved/EasyUI/BootPreload.json, and streams them in a single request on the next boot of the same build.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Preloading")
+	bool bUseBootPreloadList = true;
+	/** Duration from the start of the session during which the requested classes and assets are recorded. */
+	UPROPERTY(Config, EditAnywhere, Category = "Preloading", meta = (ClampMin = "1", Units = "s", EditCondition = "bUseBootPreloadList"))
+	float BootPreloadRecordSeconds = 30.0f;
+	/** Maximum number of classes and assets recorded, the first requested ones are kept. */
+	UPROPERTY(Config, EditAnywhere, Category = "Preloading", meta = (ClampMin = "0", EditCondition = "bUseBootPreloadList"))
+	int32 BootPreloadMaxAssets = 128;
+
+public:
+	/**
+	 * If true, the User Interface Manager keeps the notification widgets removed on dismissal and reuses them for the next
+	 * notifications of their class, instead of creating a widget per notification. Notifications that do not auto dismiss are not reused.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Notifications")
+	bool bPoolNotificationWidgets = true;
+	/** Maximum number of dismissed notification widgets kept per class, the others are left to the garbage collector. */
+	UPROPERTY(Config, EditAnywhere, Category = "Notifications", meta = (ClampMin = "0", EditCondition = "bPoolNotificationWidgets"))
+	int32 NotificationPoolCapacity = 8;
+	/** Notification widgets created per class once the root widget is added, so the first notifications do not create any. Capped by the capacity. */
+	UPROPERTY(Config, EditAnywhere, Category = "Notifications", meta = (ClampMin = "0", ForceInlineRow, EditCondition = "bPoolNotificationWidgets"))
+	TMap<TSoftClassPtr<UEasyNotificationWidget>, int32> NotificationPoolPrewarmCounts;
+	/**
+	 * If true, a notification identical to one shown on the same layer within the coalesce window (same class, header and body)
+	 * is merged into it: its count is incremented and its lifetime restarts, instead of adding a copy.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Notifications")
+	bool bCoalesceNotifications = true;
+	/** Time after a notification is shown (or last merged into) during which an identical notification is merged into it. */
+	UPROPERTY(Config, EditAnywhere, Category = "Notifications", meta = (ClampMin = "0", Units = "s", EditCondition = "bCoalesceNotifications"))
+	float NotificationCoalesceWindow = 1.0f;
+	/**
+	 * Rate limits of the notification layers, layers without one are not limited.
+	 * The notifications over the limit are not created, they are shown as a single summary once the layer is allowed to show one again.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Notifications", meta = (Categories = "UI.NotificationType", ForceInlineRow))
+	TMap<FGameplayTag, FEasyNotificationRateLimit> LayerNotificationRateLimits;
+	/** Header of the summary of the rate limited notifications, {Count} is the number of notifications it stands for. */
+	UPROPERTY(Config, EditAnywhere, Category = "Notifications")
+	FText NotificationOverflowSummaryFormat;
+	/**
+	 * Maximum number of notifications visible at once per notification layer, layers without one are not limited.
+	 * The notifications of a full layer wait in a backlog, without a widget, until one of its notifications is dismissed.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Notifications", meta = (Categories = "UI.NotificationType", ClampMin = "1", ForceInlineRow))
+	TMap<FGameplayTag, int32> LayerMaxVisibleNotifications;
+	/** Maximum number of notifications waiting per layer, the lowest priority one is dropped when a notification arrives on a full backlog. */
+	UPROPERTY(Config, EditAnywhere, Category = "Notifications", meta = (ClampMin = "1"))
+	int32 NotificationBacklogCapacity = 32;
+	/** Time after which a waiting notification is stale and dropped without being shown. 0 keeps them until they are shown. */
+	UPROPERTY(Config, EditAnywhere, Category = "Notifications", meta = (ClampMin = "0", Units = "s"))
+	float NotificationBacklogMaxWait = 10.0f;
+	/** Maximum number of notifications dismissed per frame once their lifetime ends, the others are dismissed on the next frames. 0 is not limited. */
+	UPROPERTY(Config, EditAnywhere, Category = "Notifications", meta = (ClampMin = "0"))
+	int32 NotificationDismissalsPerFrame = 8;
+
+public:
+	/** Budget of every widget blueprint using the plugin widgets, unless overridden in Class Hard Reference Budgets. */
+	UPROPERTY(Config, EditAnywhere, Category = "Reference Audit")
+	FEasyHardReferenceBudget DefaultHardReferenceBudget;
+	/** Budgets of specific widget classes, replacing the default budget. */
+	UPROPERTY(Config, EditAnywhere, Category = "Reference Audit", meta = (ForceInlineRow))
+	TMap<TSoftClassPtr<UUserWidget>, FEasyHardReferenceBudget> ClassHardReferenceBudgets;
+	/**
+	 * Budgets of the layers, checked against every asset hard referenced by the widgets opened on the layer by button actions
+	 * (Push Widget, Push Question Prompt and Add Notification).
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Reference Audit", meta = (Categories = "UI", ForceInlineRow))
+	TMap<FGameplayTag, FEasyHardReferenceBudget> LayerHardReferenceBudgets;
+
+public:
+	/**
+	 * Root widget the "EasyUI.Benchmark", "EasyUI.BudgetAudit" and "EasyUI.Soak" automation tests add in the game world they create,
+	 * its stacks and notification panels are the layers they run on. The tests fail if not set.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Automation")
+	TSoftClassPtr<UEasyUserInterfaceRootWidget> TestRootWidgetClass;
+
+public:
+	/** Widget class pushed and popped on every registered stack layer by the "EasyUI.Benchmark" automation test. Skipped if not set. */
+	UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+	TSoftClassPtr<UCommonActivatableWidget> BenchmarkWidgetClass;
+	/** Notification class added through the manager and dismissed on every registered notification panel by the benchmark. Skipped if not set. */
+	UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+	TSoftClassPtr<UEasyNotificationWidget> BenchmarkNotificationClass;
+	/** Prompt class pushed and resolved by the benchmark. Skipped if not set. */
+	UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+	TSoftClassPtr<UEasyPromptQuestion> BenchmarkPromptClass;
+	/** Tab button class used for the tab registration benchmark. Skipped if not set. */
+	UPROPERTY(Config, EditAnywhere, Category = "Benchmark")
+	TSoftClassPtr<UEasyCommonButtonExtended> BenchmarkTabButtonClass;
+	/** Input action registered and unregistered by the binding benchmark. Skipped if not set. */
+	UPROPERTY(Config, EditAnywhere, Category = "Benchmark", meta = (RowType = "/Script/CommonUI.CommonInputActionDataBase"))
+	FDataTableRowHandle BenchmarkInputAction;
+
+public:
+	/** Widget class pushed and popped on every registered stack layer by the "EasyUI.Soak" automation test. Skipped if not set. */
+	UPROPERTY(Config, EditAnywhere, Category = "Soak")
+	TSoftClassPtr<UCommonActivatableWidget> SoakWidgetClass;
+	/** Notification class added in bursts on every registered notification panel by the soak. Skipped if not set. */
+	UPROPERTY(Config, EditAnywhere, Category = "Soak")
+	TSoftClassPtr<UEasyNotificationWidget> SoakNotificationClass;
+	/** Prompt class pushed and answered at every cycle of the soak. Skipped if not set. */
+	UPROPERTY(Config, EditAnywhere, Category = "Soak")
+	TSoftClassPtr<UEasyPromptQuestion> SoakPromptClass;
+};
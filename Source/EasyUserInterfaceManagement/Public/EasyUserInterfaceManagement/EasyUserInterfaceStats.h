@@ -0,0 +1,114 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("EasyUI"), STATGROUP_EasyUI, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PushWidget Construct"), STAT_EasyUI_PushWidget_Construct, STATGROUP_EasyUI, EASYUSERINTERFACEMANAGEMENT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PushWidget Activate"), STAT_EasyUI_PushWidget_Activate, STATGROUP_EasyUI, EASYUSERINTERFACEMANAGEMENT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AddNotification Construct"), STAT_EasyUI_AddNotification_Construct, STATGROUP_EasyUI, EASYUSERINTERFACEMANAGEMENT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AddNotification Activate"), STAT_EasyUI_AddNotification_Activate, STATGROUP_EasyUI, EASYUSERINTERFACEMANAGEMENT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PushPrompt Construct"), STAT_EasyUI_PushPrompt_Construct, STATGROUP_EasyUI, EASYUSERINTERFACEMANAGEMENT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("PushPrompt Activate"), STAT_EasyUI_PushPrompt_Activate, STATGROUP_EasyUI, EASYUSERINTERFACEMANAGEMENT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AddRootWidget Construct"), STAT_EasyUI_AddRootWidget_Construct, STATGROUP_EasyUI, EASYUSERINTERFACEMANAGEMENT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AddRootWidget Activate"), STAT_EasyUI_AddRootWidget_Activate, STATGROUP_EasyUI, EASYUSERINTERFACEMANAGEMENT_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Notification Lifetimes"), STAT_EasyUI_NotificationLifetimes, STATGROUP_EasyUI, EASYUSERINTERFACEMANAGEMENT_API);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Pending Loads"), STAT_EasyUI_PendingLoads, STATGROUP_EasyUI, EASYUSERINTERFACEMANAGEMENT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Prefetch Hits"), STAT_EasyUI_PrefetchHits, STATGROUP_EasyUI, EASYUSERINTERFACEMANAGEMENT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Prefetch Misses"), STAT_EasyUI_PrefetchMisses, STATGROUP_EasyUI, EASYUSERINTERFACEMANAGEMENT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Sync Loads"), STAT_EasyUI_SyncLoads, STATGROUP_EasyUI, EASYUSERINTERFACEMANAGEMENT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Coalesced Notifications"), STAT_EasyUI_CoalescedNotifications, STATGROUP_EasyUI, EASYUSERINTERFACEMANAGEMENT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Rate Limited Notifications"), STAT_EasyUI_RateLimitedNotifications, STATGROUP_EasyUI, EASYUSERINTERFACEMANAGEMENT_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Queued Notifications"), STAT_EasyUI_QueuedNotifications, STATGROUP_EasyUI, EASYUSERINTERFACEMANAGEMENT_API);
+
+/** Async entry points of the User Interface Manager whose request-to-visible latency is tracked. */
+enum class EEasyUserInterfaceOperation : uint8
+{
+	PushWidget,
+	AddNotification,
+	PushPrompt,
+	AddRootWidget,
+	Num
+};
+
+/** Phases an operation is split into, Total spans from the request to the widget being added to the screen. */
+enum class EEasyUserInterfaceLatencyPhase : uint8
+{
+	/** From the request to the widget class being loaded */
+	LoadWait,
+	/** Creating the widget instance */
+	Construct,
+	/** Adding the widget to its stack, panel or viewport */
+	Activate,
+	Total,
+	Num
+};
+
+/** Latency summary of an operation phase over the recent samples, in milliseconds. */
+struct FEasyUserInterfaceLatencySummary
+{
+	float Min = 0.0f;
+	float Avg = 0.0f;
+	float P95 = 0.0f;
+	float Max = 0.0f;
+	/** Number of samples recorded since the start (or the last reset) */
+	int32 NumSamples = 0;
+};
+
+/**
+ * Records the latency samples of the User Interface Manager entry points and publishes their min/avg/p95/max
+ * to "stat EasyUI" and to the "EasyUI" CSV profiler category. Game thread only.
+ */
+class EASYUSERINTERFACEMANAGEMENT_API FEasyUserInterfaceStats
+{
+public:
+	/** Number of recent samples the summaries are computed over */
+	static constexpr int32 SampleWindowSize = 128;
+
+	/**
+	 * Records a latency sample.
+	 * @param Operation The entry point the sample belongs to.
+	 * @param Phase The phase of the operation that was measured.
+	 * @param Seconds The measured duration in seconds.
+	 */
+	static void RecordLatency(EEasyUserInterfaceOperation Operation, EEasyUserInterfaceLatencyPhase Phase, double Seconds);
+	/** Increments the request counter of the operation. */
+	static void RecordRequest(EEasyUserInterfaceOperation Operation);
+
+	/** Retrieves the latency summary of an operation phase. */
+	static FEasyUserInterfaceLatencySummary GetLatencySummary(EEasyUserInterfaceOperation Operation, EEasyUserInterfaceLatencyPhase Phase);
+	/** Retrieves the number of requests of the operation since the start (or the last reset). */
+	static int32 GetNumRequests(EEasyUserInterfaceOperation Operation);
+	/** Clears every recorded sample and counter. */
+	static void Reset();
+
+	static const TCHAR* LexToString(EEasyUserInterfaceOperation Operation);
+	static const TCHAR* LexToString(EEasyUserInterfaceLatencyPhase Phase);
+};
+
+/**
+ * Records the time spent in its scope as a latency sample of the given operation phase.
+ */
+struct FEasyUserInterfaceLatencyScope
+{
+	FEasyUserInterfaceLatencyScope(EEasyUserInterfaceOperation InOperation, EEasyUserInterfaceLatencyPhase InPhase)
+		: Operation(InOperation)
+		, Phase(InPhase)
+		, StartTime(FPlatformTime::Seconds())
+	{
+	}
+
+	~FEasyUserInterfaceLatencyScope()
+	{
+		FEasyUserInterfaceStats::RecordLatency(Operation, Phase, FPlatformTime::Seconds() - StartTime);
+	}
+
+private:
+	EEasyUserInterfaceOperation Operation;
+	EEasyUserInterfaceLatencyPhase Phase;
+	double StartTime;
+};
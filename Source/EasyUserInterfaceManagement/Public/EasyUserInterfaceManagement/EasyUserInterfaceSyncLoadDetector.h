@@ -0,0 +1,102 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/** Game thread stalls reported by the sync load detector. */
+enum class EEasyUserInterfaceSyncLoadKind : uint8
+{
+	/** A package loaded synchronously (LoadObject, LoadSynchronous, TryLoad...) */
+	SyncLoad,
+	/** The game thread waited for the async loading queue (FlushAsyncLoading) */
+	Flush
+};
+
+/** A sync load or flush that happened while plugin code was running. */
+struct FEasyUserInterfaceSyncLoad
+{
+	EEasyUserInterfaceSyncLoadKind Kind = EEasyUserInterfaceSyncLoadKind::SyncLoad;
+	/** The package loaded synchronously, empty for a flush */
+	FString PackageName;
+	/** Class of the widget running (or being created by) the plugin code */
+	FName WidgetClass;
+	/** Plugin code the stall happened in */
+	const TCHAR* Operation = TEXT("");
+	/** Time from the stall to the next one or to the end of the plugin code, an upper bound of its duration */
+	double Seconds = 0.0;
+};
+
+/**
+ * Debug mode finding the synchronous loads and async loading flushes happening on the User Interface paths: while the
+ * manager creates a widget, or while a plugin widget is constructed, activated, ticked or clicked.
+ *
+ * Enabled with "EasyUI.SyncLoadDetection 1". Each stall is logged with the loaded package, the widget class and its duration
+ * once the plugin code returns. "EasyUI.SyncLoads [Reset]" lists the recent stalls or resets the counters, automation can
+ * assert that GetNumDetections stays at zero. Only the game thread is watched.
+ */
+class EASYUSERINTERFACEMANAGEMENT_API FEasyUserInterfaceSyncLoadDetector
+{
+public:
+	/** Starts or stops watching the sync loads and flushes, the counters are kept. */
+	static void SetEnabled(bool bEnabled);
+	/** Checks if the sync loads and flushes are watched, the load scopes do nothing otherwise. */
+	static bool IsEnabled() { return bIsEnabled; }
+
+	/** Retrieves the number of sync loads found since the last reset. */
+	static int32 GetNumSyncLoads();
+	/** Retrieves the number of async loading flushes found since the last reset. */
+	static int32 GetNumFlushes();
+	/** Retrieves the number of sync loads and flushes found since the last reset. */
+	static int32 GetNumDetections() { return GetNumSyncLoads() + GetNumFlushes(); }
+	/** Retrieves the most recent stalls, the oldest first. */
+	static const TArray<FEasyUserInterfaceSyncLoad>& GetRecentDetections();
+	/** Resets the counters and forgets the recent stalls. */
+	static void Reset();
+
+	static const TCHAR* LexToString(EEasyUserInterfaceSyncLoadKind Kind);
+
+private:
+	friend class FEasyUserInterfaceSyncLoadScope;
+
+	static void PushScope(const UClass* WidgetClass, const TCHAR* Operation);
+	static void PopScope();
+
+	static void HandleSyncLoadPackage(const FString& PackageName);
+	static void HandleAsyncLoadingFlush();
+	static void AddDetection(EEasyUserInterfaceSyncLoadKind Kind, const FString& PackageName);
+	/** Sets the duration of the stalls that happened in a scope ending now, and logs them */
+	static void FinishPendingDetections(int32 ScopeDepth);
+
+	/** Global so the load scopes can early out without touching the scope stack */
+	static bool bIsEnabled;
+};
+
+/** Attributes the sync loads and flushes happening in its scope to a widget class, when the sync load detection is enabled. */
+class FEasyUserInterfaceSyncLoadScope
+{
+public:
+	/**
+	 * @param WidgetClass The class of the widget running, or being created by, the scope.
+	 * @param Operation The plugin code the scope covers.
+	 */
+	FEasyUserInterfaceSyncLoadScope(const UClass* WidgetClass, const TCHAR* Operation)
+		: bIsPushed(FEasyUserInterfaceSyncLoadDetector::IsEnabled() && IsInGameThread())
+	{
+		if (bIsPushed)
+		{
+			FEasyUserInterfaceSyncLoadDetector::PushScope(WidgetClass, Operation);
+		}
+	}
+
+	~FEasyUserInterfaceSyncLoadScope()
+	{
+		if (bIsPushed)
+		{
+			FEasyUserInterfaceSyncLoadDetector::PopScope();
+		}
+	}
+
+private:
+	bool bIsPushed;
+};
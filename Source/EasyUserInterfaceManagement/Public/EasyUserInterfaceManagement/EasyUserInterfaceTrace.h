@@ -0,0 +1,99 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Trace/Config.h"
+#include "Trace/Trace.h"
+
+class UUserWidget;
+
+#if !defined(EASYUI_TRACE_ENABLED)
+#define EASYUI_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+#endif
+
+/** User Interface lifecycle events recorded on the EasyUI trace channel. */
+enum class EEasyUserInterfaceTraceEvent : uint8
+{
+	LoadStarted,
+	LoadFinished,
+	Construct,
+	Activate,
+	Deactivate,
+	Destruct,
+	NotificationAdded,
+	NotificationDismissed,
+	PromptResult,
+	InputModeChanged
+};
+
+#if EASYUI_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(EasyUIChannel, EASYUSERINTERFACEMANAGEMENT_API);
+
+/**
+ * Records the User Interface lifecycle events on the "EasyUI" trace channel (enable it with -trace=cpu,EasyUI).
+ * Every event carries its layer tag and class name. It is recorded both as an "EasyUI.LifecycleEvent" trace event and as a
+ * timing event named after it, so it shows up on the Unreal Insights timeline next to the frame it happened in.
+ * Async loads are recorded as timing regions spanning from the request to the load callback.
+ */
+class EASYUSERINTERFACEMANAGEMENT_API FEasyUserInterfaceTrace
+{
+public:
+	/** Checks if the EasyUI channel is enabled, events are dropped otherwise. */
+	static bool IsEnabled();
+
+	/**
+	 * Records an instant event.
+	 * @param Event The lifecycle event.
+	 * @param LayerTag The layer the event happened on, can be empty.
+	 * @param Class The class of the widget concerned by the event.
+	 * @param Detail Optional additional information (load result, prompt result, input mode...).
+	 */
+	static void OutputEvent(EEasyUserInterfaceTraceEvent Event, const FGameplayTag& LayerTag, const UClass* Class, const FString& Detail = FString());
+	/** Records the start of an async class load and opens its timing region. */
+	static void OutputLoadStarted(const FGameplayTag& LayerTag, const FSoftObjectPath& ClassPath);
+	/** Records the end of an async class load and closes its timing region. */
+	static void OutputLoadFinished(const FGameplayTag& LayerTag, const FSoftObjectPath& ClassPath, bool bSucceeded);
+
+	/** Finds the layer a widget lives on, through the root widget of its owning player. */
+	static FGameplayTag FindWidgetLayer(const UUserWidget& Widget);
+
+	static const TCHAR* LexToString(EEasyUserInterfaceTraceEvent Event);
+};
+
+/**
+ * Records a widget lifecycle event and times its scope on the Insights timeline.
+ */
+class EASYUSERINTERFACEMANAGEMENT_API FEasyUserInterfaceTraceWidgetScope
+{
+public:
+	FEasyUserInterfaceTraceWidgetScope(EEasyUserInterfaceTraceEvent Event, const UUserWidget& Widget);
+	~FEasyUserInterfaceTraceWidgetScope();
+
+private:
+	bool bHasTimingEvent = false;
+};
+
+#define EASYUI_TRACE_EVENT(Event, LayerTag, Class, Detail) \
+	do \
+	{ \
+		if (FEasyUserInterfaceTrace::IsEnabled()) \
+		{ \
+			FEasyUserInterfaceTrace::OutputEvent(EEasyUserInterfaceTraceEvent::Event, LayerTag, Class, Detail); \
+		} \
+	} while (0)
+
+#define EASYUI_TRACE_LOAD_STARTED(LayerTag, ClassPath) FEasyUserInterfaceTrace::OutputLoadStarted(LayerTag, ClassPath)
+#define EASYUI_TRACE_LOAD_FINISHED(LayerTag, ClassPath, bSucceeded) FEasyUserInterfaceTrace::OutputLoadFinished(LayerTag, ClassPath, bSucceeded)
+#define EASYUI_TRACE_WIDGET_SCOPE(Event, Widget) FEasyUserInterfaceTraceWidgetScope PREPROCESSOR_JOIN(EasyUITraceWidgetScope, __LINE__)(EEasyUserInterfaceTraceEvent::Event, Widget)
+
+#else
+
+#define EASYUI_TRACE_EVENT(Event, LayerTag, Class, Detail)
+#define EASYUI_TRACE_LOAD_STARTED(LayerTag, ClassPath)
+#define EASYUI_TRACE_LOAD_FINISHED(LayerTag, ClassPath, bSucceeded)
+#define EASYUI_TRACE_WIDGET_SCOPE(Event, Widget)
+
+#endif // EASYUI_TRACE_ENABLED
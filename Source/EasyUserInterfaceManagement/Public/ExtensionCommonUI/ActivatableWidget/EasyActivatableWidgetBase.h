@@ -72,6 +72,39 @@ struct FUserInterfaceInputActionToRegister
 	FText OverrideDisplayName;
 };
 
+/**
+ * Performance limits of a screen, checked by the "EasyUI.BudgetAudit" automation test. A limit of 0 is not checked.
+ */
+USTRUCT(BlueprintType)
+struct FEasyActivatableWidgetBudget
+{
+	GENERATED_BODY()
+
+	/** Maximum time to create the widget and add it to its stack, in milliseconds */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Budget", meta = (ClampMin = "0", Units = "ms"))
+	float MaxConstructMs = 0.0f;
+	/** Maximum number of widgets in the widget tree, nested user widgets included */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Budget", meta = (ClampMin = "0"))
+	int32 MaxWidgetCount = 0;
+	/** Maximum number of input bindings registered by the widget once activated */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Budget", meta = (ClampMin = "0"))
+	int32 MaxBindings = 0;
+	/** Maximum time from the push request until the widget is activated and its stack done transitioning, in milliseconds */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Budget", meta = (ClampMin = "0", Units = "ms"))
+	float MaxTimeToInteractiveMs = 0.0f;
+
+	/** Retrieves this budget with its unchecked limits taken from Fallback. */
+	FEasyActivatableWidgetBudget WithFallback(const FEasyActivatableWidgetBudget& Fallback) const
+	{
+		FEasyActivatableWidgetBudget Budget = *this;
+		Budget.MaxConstructMs = MaxConstructMs > 0.0f ? MaxConstructMs : Fallback.MaxConstructMs;
+		Budget.MaxWidgetCount = MaxWidgetCount > 0 ? MaxWidgetCount : Fallback.MaxWidgetCount;
+		Budget.MaxBindings = MaxBindings > 0 ? MaxBindings : Fallback.MaxBindings;
+		Budget.MaxTimeToInteractiveMs = MaxTimeToInteractiveMs > 0.0f ? MaxTimeToInteractiveMs : Fallback.MaxTimeToInteractiveMs;
+		return Budget;
+	}
+};
+
 /**
  * Base class for activatable widgets that can register and unregister input actions and setup easy input modes when activated.
  * The main responsibility of this widget is to manage input bindings and modes when the widget is activated or deactivated,
@@ -104,6 +137,19 @@ public:
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
 	bool bEnableAnalogCursor = false;
+
+	/**
+	 * Performance limits of this screen, unchecked limits fall back to the project default budget.
+	 * Enforced by the "EasyUI.BudgetAudit" automation test, which pushes every screen of the project and measures them.
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Performance")
+	FEasyActivatableWidgetBudget PerformanceBudget;
+
+	/** Retrieves the performance budget of this screen, merged with the project default budget. */
+	FEasyActivatableWidgetBudget GetEffectivePerformanceBudget() const;
+
+	/** Retrieves the number of input bindings currently registered by this widget. */
+	int32 GetNumRegisteredBindings() const { return BindingHandles.Num(); }
 	
 #if WITH_EDITOR
 	virtual void ValidateCompiledWidgetTree(const UWidgetTree& BlueprintWidgetTree, class IWidgetCompilerLog& CompileLog) const override;
@@ -112,6 +158,7 @@ public:
 protected:
 	virtual void NativeConstruct() override;
 	virtual void NativeDestruct() override;
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
 	virtual void NativeOnActivated() override;
 	virtual void NativeOnDeactivated() override;
 
@@ -96,6 +96,10 @@ public:
 	
 #if WITH_EDITOR
 	virtual void ValidateCompiledWidgetTree(const UWidgetTree& BlueprintWidgetTree, class IWidgetCompilerLog& CompileLog) const override;
+
+protected:
+	/** Warns about what makes this widget costly at runtime, the thresholds are read from the project settings. */
+	void ValidateWidgetPerformance(const UWidgetTree& BlueprintWidgetTree, class IWidgetCompilerLog& CompileLog) const;
 #endif
 
 };
@@ -10,8 +10,50 @@
 #include "Widgets/CommonActivatableWidgetContainer.h"
 #include "EasyUserInterfaceRootWidget.generated.h"
 
+class UEasyUserInterfaceLayerPanelSlot;
+
 DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnWidgetUpdatedOnStack, FGameplayTag, LayerTag, UCommonActivatableWidget*, ActivatableWidget);
 
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnEasyLayerWidgetChangedNative, const FGameplayTag& /*LayerTag*/, UCommonActivatableWidget* /*Widget*/);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnEasyNotificationCountChangedNative, const FGameplayTag& /*LayerTag*/, int32 /*NotificationCount*/);
+
+/**
+ * Cached state of a registered widget stack layer, updated whenever the stack's displayed widget changes.
+ */
+struct FEasyUserInterfaceLayerState
+{
+	/** The widget currently displayed on the layer */
+	TWeakObjectPtr<UCommonActivatableWidget> TopWidget;
+	/** Number of widgets in the layer's stack */
+	int32 NumWidgets = 0;
+	/** Whether the layer's stack is transitioning between widgets */
+	bool bIsTransitioning = false;
+};
+
+/**
+ * Widget class async load requested by the User Interface and not yet completed.
+ */
+struct FEasyUserInterfacePendingLoad
+{
+	/** The layer the loaded class is meant for */
+	FGameplayTag LayerTag;
+	/** The class being loaded */
+	FSoftObjectPath ClassPath;
+	/** FPlatformTime::Seconds() at the time of the request */
+	double RequestTime = 0.0;
+
+	FEasyUserInterfacePendingLoad() = default;
+	FEasyUserInterfacePendingLoad(const FGameplayTag& InLayerTag, const FSoftObjectPath& InClassPath, double InRequestTime)
+		: LayerTag(InLayerTag), ClassPath(InClassPath), RequestTime(InRequestTime)
+	{
+	}
+
+	bool operator==(const FEasyUserInterfacePendingLoad& Other) const
+	{
+		return LayerTag == Other.LayerTag && ClassPath == Other.ClassPath && RequestTime == Other.RequestTime;
+	}
+};
+
 USTRUCT()
 struct FPushWidgetToStackAsyncParams
 {
@@ -61,6 +103,7 @@ public:
 
 public:
 	virtual void NativeConstruct() override;
+	virtual void NativeDestruct() override;
 
 private:
 	/** Internal map of registered widget stacks by their layer tags */
@@ -84,9 +127,37 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintType, Category = "Root Widget|Activatable Widget Stack", meta = (Categories = "UI.Layer"))
 	void PushWidgetToStackAsync(FGameplayTag LayerTag, TSoftClassPtr<UCommonActivatableWidget> WidgetClass, FOnWidgetUpdatedOnStack OnWidgetAdded);
+	/**
+	 * Removes a widget from the specified stack, the widget below it is displayed if it was the displayed one.
+	 * @param LayerTag The tag representing the activatable widget stack.
+	 * @param Widget The widget to remove.
+	 * @return True if the widget was on the stack and got removed.
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintType, Category = "Root Widget|Activatable Widget Stack", meta = (Categories = "UI.Layer"))
+	bool RemoveWidgetFromStack(FGameplayTag LayerTag, UCommonActivatableWidget* Widget);
 
 	UFUNCTION(BlueprintPure, BlueprintType, Category = "Root Widget|Activatable Widget Stack", meta = (Categories = "UI.Layer"))
 	UCommonActivatableWidgetStack* GetWidgetStack(const FGameplayTag& LayerTag) const;
+	/** Same as GetWidgetStack, without logging when the layer is not registered. */
+	UCommonActivatableWidgetStack* FindWidgetStack(const FGameplayTag& LayerTag) const;
+	/** Retrieves the cached state of the widget stack layer, or nullptr if the layer is not registered. */
+	const FEasyUserInterfaceLayerState* FindLayerState(const FGameplayTag& LayerTag) const { return LayerStates.Find(LayerTag); }
+	/** Retrieves the tags of every registered widget stack layer. */
+	TArray<FGameplayTag> GetRegisteredStackLayers() const;
+	/**
+	 * Finds the layer a widget lives on, either as a widget of a registered stack or as an active notification.
+	 * Linear in the number of widgets of the layers, not meant to be called every frame.
+	 * @return The layer tag, or an empty tag if the widget isn't on any registered layer.
+	 */
+	FGameplayTag FindWidgetLayer(const UUserWidget* Widget) const;
+	/**
+	 * Retrieves the live widgets of a layer: the widgets of a registered stack, or the active notifications of a registered panel.
+	 * @param LayerTag The stack or notification panel layer.
+	 * @param OutWidgets The widgets of the layer, appended to the array.
+	 */
+	void GetLayerWidgets(const FGameplayTag& LayerTag, TArray<UUserWidget*>& OutWidgets) const;
+	/** Retrieves the widget class loads requested by PushWidgetToStackAsync and not yet completed. */
+	const TArray<FEasyUserInterfacePendingLoad>& GetPendingLoads() const { return PendingLoads; }
 
 public:
 	/**
@@ -111,6 +182,15 @@ public:
 	 */
 	UFUNCTION(BlueprintPure, BlueprintType, Category = "Root Widget|Notification", meta = (Categories = "UI.NotificationType"))
 	UWidget* GetNotificationPanel(const FGameplayTag& LayerTag) const;
+	/**
+	 * Retrieves the number of notifications added to the specified panel and not yet removed from it.
+	 * @param LayerTag The tag representing the notification panel layer.
+	 * @return The number of active notifications on the panel.
+	 */
+	UFUNCTION(BlueprintPure, BlueprintType, Category = "Root Widget|Notification", meta = (Categories = "UI.NotificationType"))
+	int32 GetActiveNotificationCount(const FGameplayTag& LayerTag) const;
+	/** Retrieves the tags of every registered notification panel layer. */
+	TArray<FGameplayTag> GetRegisteredNotificationLayers() const;
 
 public:
 	/**
@@ -118,10 +198,50 @@ public:
 	 * @param LayerTag The tag representing the notification panel layer. Note: Simple View: "UI.NotificationType.SimpleView"
 	 * @param NotificationWidget The notification widget to add to the panel.
 	 * @param InNotificationInfo The information struct containing details about the notification.
+	 * @return True if the notification was handed to the panel, false if the layer has no panel implementing IEasyNotificationWidgetPanelInterface.
 	 */
 	UFUNCTION(BlueprintCallable, BlueprintType, Category = "Root Widget")
-	void AddNotificationWidgetToPanel(FGameplayTag LayerTag, UEasyNotificationWidget* NotificationWidget, const FEasyNotificationWidgetInfo& InNotificationInfo);
+	bool AddNotificationWidgetToPanel(FGameplayTag LayerTag, UEasyNotificationWidget* NotificationWidget, const FEasyNotificationWidgetInfo& InNotificationInfo);
 	
+public:
+	/** Native event called when a widget is pushed to a registered stack layer. */
+	FOnEasyLayerWidgetChangedNative& OnLayerWidgetPushed() { return LayerWidgetPushedEvent; }
+	/** Native event called when a widget is popped from a registered stack layer. */
+	FOnEasyLayerWidgetChangedNative& OnLayerWidgetPopped() { return LayerWidgetPoppedEvent; }
+	/** Native event called when the displayed widget of a registered stack layer changes (Widget is null when the layer gets empty). */
+	FOnEasyLayerWidgetChangedNative& OnLayerTopWidgetChanged() { return LayerTopWidgetChangedEvent; }
+	/** Native event called when the number of active notifications of a panel changes. */
+	FOnEasyNotificationCountChangedNative& OnNotificationCountChanged() { return NotificationCountChangedEvent; }
+
+private:
+	/** Updates the cached layer state and broadcasts the layer events */
+	void HandleDisplayedWidgetChanged(UCommonActivatableWidget* DisplayedWidget, FGameplayTag LayerTag);
+	/** Stops tracking a notification removed from its panel and broadcasts the new count */
+	void HandleNotificationRemoved(UEasyNotificationWidget* NotificationWidget, FGameplayTag LayerTag);
+	/** Keeps the layer active while its stack transitions, the transition would never finish on a skipped layer */
+	void HandleTransitioningChanged(UCommonActivatableWidgetContainerBase* Container, bool bIsTransitioning, FGameplayTag LayerTag);
+
+	/**
+	 * Flags the layer panel slots containing registered stacks / notification panels as idle when all of them are empty.
+	 * Only has an effect when the layers are placed in an Easy UI Layer Panel.
+	 */
+	void UpdateLayerPanelIdleStates();
+
+	/** Cached state of each registered widget stack */
+	TMap<FGameplayTag, FEasyUserInterfaceLayerState> LayerStates;
+	/** Widget class loads requested by PushWidgetToStackAsync and not yet completed */
+	TArray<FEasyUserInterfacePendingLoad> PendingLoads;
+	/** Notifications added to each panel and not yet removed from it */
+	TMap<FGameplayTag, TArray<TWeakObjectPtr<UEasyNotificationWidget>>> ActiveNotifications;
+
+	FOnEasyLayerWidgetChangedNative LayerWidgetPushedEvent;
+	FOnEasyLayerWidgetChangedNative LayerWidgetPoppedEvent;
+	FOnEasyLayerWidgetChangedNative LayerTopWidgetChangedEvent;
+	FOnEasyNotificationCountChangedNative NotificationCountChangedEvent;
+
+	/** Layer panel slots managed by UpdateLayerPanelIdleStates, so slots left without registered layers are restored */
+	TArray<TWeakObjectPtr<UEasyUserInterfaceLayerPanelSlot>> ManagedLayerSlots;
+
 private:
 	/** Internal Loading Widget Param */
 	UPROPERTY()
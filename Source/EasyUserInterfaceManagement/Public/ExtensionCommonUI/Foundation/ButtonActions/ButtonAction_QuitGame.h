@@ -23,6 +23,13 @@ public:
 	TEnumAsByte<EQuitPreference::Type> QuitPreference;
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Quit Game")
 	bool bIgnorePlatformRestrictions;
+	/**
+	 * If true, the User Interface Manager is marked as shutting down once the quit is accepted,
+	 * so widgets skip their teardown work (binding unregistration, prompt result executions and broadcasts) on exit.
+	 * Nothing changes if the quit is refused, e.g. on platforms that do not allow it without bIgnorePlatformRestrictions.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Quit Game")
+	bool bFastExit;
 
 public:
 	virtual void ExecuteAction_Implementation(UWidget* InstigatorWidget) override;
@@ -6,6 +6,7 @@
 #include "CommonButtonBase.h"
 #include "CommonTextBlock.h"
 #include "CommonLazyImage.h"
+#include "ExtensionCommonUI/Localization/EasyLocalizedWidgetInterface.h"
 #include "EasyCommonButtonExtended.generated.h"
 
 class UCommonButtonClickActionBase;
@@ -13,7 +14,7 @@ class UCommonButtonClickActionBase;
  * 
  */
 UCLASS()
-class EASYUSERINTERFACEMANAGEMENT_API UEasyCommonButtonExtended : public UCommonButtonBase
+class EASYUSERINTERFACEMANAGEMENT_API UEasyCommonButtonExtended : public UCommonButtonBase, public IEasyLocalizedWidgetInterface
 {
 	GENERATED_BODY()
 
@@ -22,6 +23,10 @@ public:
 	virtual void NativePreConstruct() override;
 	virtual void NativeOnCurrentTextStyleChanged() override;
 
+	//~IEasyLocalizedWidgetInterface interface
+	virtual void RefreshLocalizedText_Implementation() override;
+	//~End of IEasyLocalizedWidgetInterface interface
+
 public:
 	virtual void NativeOnClicked() override;
 
@@ -0,0 +1,136 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/PanelSlot.h"
+#include "Components/PanelWidget.h"
+#include "Layout/Margin.h"
+#include "ExtensionCommonUI/LayerPanel/SEasyUserInterfaceLayerPanel.h"
+#include "EasyUserInterfaceLayerPanel.generated.h"
+
+/**
+ * Slot of a layer inside the Easy User Interface Layer Panel.
+ */
+UCLASS()
+class EASYUSERINTERFACEMANAGEMENT_API UEasyUserInterfaceLayerPanelSlot : public UPanelSlot
+{
+	GENERATED_BODY()
+
+public:
+	UEasyUserInterfaceLayerPanelSlot();
+
+public:
+	/** The padding area between the slot and the layer it contains. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Layout|Layer Panel Slot")
+	FMargin Padding;
+	/** The alignment of the layer horizontally. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Layout|Layer Panel Slot")
+	TEnumAsByte<EHorizontalAlignment> HorizontalAlignment;
+	/** The alignment of the layer vertically. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Layout|Layer Panel Slot")
+	TEnumAsByte<EVerticalAlignment> VerticalAlignment;
+	/**
+	 * If true, the layer is skipped entirely (no layout, paint or hit-test) while it is idle.
+	 * A layer is idle when every widget stack and notification panel registered to the root widget under it is empty.
+	 * Disable it for layers with permanent content besides the registered stacks or panels,
+	 * or with notifications that keep animating after being dismissed.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Layout|Layer Panel Slot")
+	bool bSkipWhenIdle;
+
+public:
+	UFUNCTION(BlueprintCallable, Category = "Layout|Layer Panel Slot")
+	void SetPadding(FMargin InPadding);
+	UFUNCTION(BlueprintCallable, Category = "Layout|Layer Panel Slot")
+	void SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment);
+	UFUNCTION(BlueprintCallable, Category = "Layout|Layer Panel Slot")
+	void SetVerticalAlignment(EVerticalAlignment InVerticalAlignment);
+	UFUNCTION(BlueprintCallable, Category = "Layout|Layer Panel Slot")
+	void SetSkipWhenIdle(bool bInSkipWhenIdle);
+
+	/**
+	 * Sets whether the layer has nothing to display. Managed by the root widget for its registered layers.
+	 * @param bInIsLayerIdle True if the layer is idle.
+	 */
+	void SetLayerIdle(bool bInIsLayerIdle);
+	/** Checks if the layer is flagged as idle. */
+	UFUNCTION(BlueprintPure, Category = "Layout|Layer Panel Slot")
+	bool IsLayerIdle() const { return bIsLayerIdle; }
+
+	/**
+	 * Sets the widget classes the prepass and paint cost of the layer is attributed to. Managed by the root widget for its registered layers.
+	 * @param InCostOwnerClasses The class names of the widgets displayed on the layer, empty if nothing is displayed or the attribution is off.
+	 * @param InCostLayerTag The name of the displayed layer.
+	 */
+	void SetCostOwners(const TArray<FName>& InCostOwnerClasses, FName InCostLayerTag);
+
+public:
+	/** Builds the underlying slot for the slate layer panel. */
+	void BuildSlot(TSharedRef<SEasyUserInterfaceLayerPanel> InLayerPanel);
+
+	//~UPanelSlot interface
+	virtual void SynchronizeProperties() override;
+	//~End of UPanelSlot interface
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+
+private:
+	/** A raw pointer to the slot to allow us to adjust the layout and idle state */
+	SEasyUserInterfaceLayerPanel::FSlot* Slot;
+
+	bool bIsLayerIdle = false;
+	TArray<FName> CostOwnerClasses;
+	FName CostLayerTag;
+};
+
+/**
+ * Panel that stacks the layers of an Easy User Interface Root Widget, a replacement for the generic Overlay.
+ * Layers containing only registered widget stacks / notification panels that are empty are skipped entirely,
+ * instead of taking part in prepass, arrange and hit-test every frame.
+ */
+UCLASS(meta = (DisplayName = "Easy UI Layer Panel"))
+class EASYUSERINTERFACEMANAGEMENT_API UEasyUserInterfaceLayerPanel : public UPanelWidget
+{
+	GENERATED_BODY()
+
+public:
+	UEasyUserInterfaceLayerPanel();
+
+public:
+	/**
+	 * Adds a new layer on top of the existing ones.
+	 * @param Content The widget of the layer.
+	 * @return The slot of the layer.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Widget")
+	UEasyUserInterfaceLayerPanelSlot* AddChildToLayerPanel(UWidget* Content);
+
+	/**
+	 * Finds the layer slot of this kind of panel containing the widget, going up the widget's parents.
+	 * @param Widget The widget (generally a registered widget stack or notification panel) to find the layer of.
+	 * @return The layer slot, or nullptr if the widget isn't inside a layer panel.
+	 */
+	static UEasyUserInterfaceLayerPanelSlot* FindLayerSlotForWidget(const UWidget* Widget);
+
+	//~UVisual interface
+	virtual void ReleaseSlateResources(bool bReleaseChildren) override;
+	//~End of UVisual interface
+
+#if WITH_EDITOR
+	virtual const FText GetPaletteCategory() override;
+#endif
+
+protected:
+	//~UPanelWidget interface
+	virtual UClass* GetSlotClass() const override;
+	virtual void OnSlotAdded(UPanelSlot* InSlot) override;
+	virtual void OnSlotRemoved(UPanelSlot* InSlot) override;
+	//~End of UPanelWidget interface
+
+	//~UWidget interface
+	virtual TSharedRef<SWidget> RebuildWidget() override;
+	//~End of UWidget interface
+
+protected:
+	TSharedPtr<SEasyUserInterfaceLayerPanel> MyLayerPanel;
+};
@@ -0,0 +1,107 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Layout/BasicLayoutWidgetSlot.h"
+#include "Layout/Children.h"
+#include "Widgets/SPanel.h"
+
+/**
+ * Overlay like panel that stacks the layers of a root widget on top of each other.
+ * Layers flagged as idle (an empty widget stack or a notification panel without notifications) are skipped entirely:
+ * they are not prepassed, arranged, painted or hit-tested.
+ * Full screen layers (fill alignment, no padding) share one child geometry, cached until the panel geometry changes,
+ * without any per layer alignment work. Layers are painted on top of each other in slot order, like an overlay.
+ */
+class EASYUSERINTERFACEMANAGEMENT_API SEasyUserInterfaceLayerPanel : public SPanel
+{
+public:
+	class EASYUSERINTERFACEMANAGEMENT_API FSlot : public TBasicLayoutWidgetSlot<FSlot>
+	{
+	public:
+		FSlot()
+			: TBasicLayoutWidgetSlot<FSlot>(HAlign_Fill, VAlign_Fill)
+		{
+		}
+
+		SLATE_SLOT_BEGIN_ARGS(FSlot, TBasicLayoutWidgetSlot<FSlot>)
+			/** If true, the layer is skipped while it is idle */
+			SLATE_ARGUMENT(TOptional<bool>, SkipWhenIdle)
+		SLATE_SLOT_END_ARGS()
+
+		void Construct(const FChildren& SlotOwner, FSlotArguments&& InArgs);
+
+	public:
+		/** Sets whether the layer has nothing to display. */
+		void SetLayerIdle(bool bInIsLayerIdle);
+		bool IsLayerIdle() const { return bIsLayerIdle; }
+
+		/** Sets whether the layer can be skipped while it is idle. */
+		void SetSkipWhenIdle(bool bInSkipWhenIdle);
+		bool GetSkipWhenIdle() const { return bSkipWhenIdle; }
+
+		/** Whether the layer should be left out of prepass, arrange, paint and hit-test. */
+		bool ShouldSkipLayer() const { return bSkipWhenIdle && bIsLayerIdle; }
+		/** Whether the layer fills the whole panel, so its geometry only depends on the panel size. */
+		bool IsFullScreen() const;
+
+		/** Sets the widget classes the cost of the layer is attributed to (See FEasyUserInterfaceCostStats). */
+		void SetCostOwners(const TArray<FName>& InCostOwnerClasses, FName InCostLayerTag);
+		const TArray<FName>& GetCostOwnerClasses() const { return CostOwnerClasses; }
+		FName GetCostLayerTag() const { return CostLayerTag; }
+
+	private:
+		bool bIsLayerIdle = false;
+		bool bSkipWhenIdle = true;
+		TArray<FName> CostOwnerClasses;
+		FName CostLayerTag;
+	};
+
+	using FScopedWidgetSlotArguments = TPanelChildren<FSlot>::FScopedWidgetSlotArguments;
+
+	SLATE_BEGIN_ARGS(SEasyUserInterfaceLayerPanel)
+	{
+		_Visibility = EVisibility::SelfHitTestInvisible;
+	}
+		SLATE_SLOT_ARGUMENT(FSlot, Slots)
+	SLATE_END_ARGS()
+
+	SEasyUserInterfaceLayerPanel();
+
+	void Construct(const FArguments& InArgs);
+
+	static FSlot::FSlotArguments Slot();
+
+	/** Adds a new layer on top of the existing ones. */
+	FScopedWidgetSlotArguments AddSlot();
+	/** Removes the layer containing the given widget, returns false if no layer contains it. */
+	bool RemoveSlot(const TSharedRef<SWidget>& SlotWidget);
+	/** Removes every layer. */
+	void ClearChildren();
+	/** Number of layers, idle or not. */
+	int32 GetNumLayers() const { return Children.Num(); }
+
+public:
+	//~SWidget interface
+	virtual void OnArrangeChildren(const FGeometry& AllottedGeometry, FArrangedChildren& ArrangedChildren) const override;
+	virtual FChildren* GetChildren() override;
+	virtual bool CustomPrepass(float LayoutScaleMultiplier) override;
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+protected:
+	virtual FVector2D ComputeDesiredSize(float LayoutScaleMultiplier) const override;
+	//~End of SWidget interface
+
+private:
+	/** Finds the layer slot of an arranged layer widget */
+	const FSlot* FindSlot(const TSharedRef<SWidget>& LayerWidget) const;
+	/** Retrieves the geometry of the full screen layers, computed again only when the panel geometry changes */
+	const FGeometry& GetFullScreenGeometry(const FGeometry& AllottedGeometry) const;
+
+private:
+	TPanelChildren<FSlot> Children;
+
+	/** Panel geometry the full screen geometry was computed for */
+	mutable TOptional<FGeometry> CachedPanelGeometry;
+	mutable FGeometry CachedFullScreenGeometry;
+};
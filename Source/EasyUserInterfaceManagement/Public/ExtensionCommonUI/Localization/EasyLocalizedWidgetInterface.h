@@ -0,0 +1,31 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "EasyLocalizedWidgetInterface.generated.h"
+
+//
+UINTERFACE(BlueprintType)
+class UEasyLocalizedWidgetInterface : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Interface for widgets that cache localized text and push it to their text widgets themselves.
+ * The User Interface Manager calls RefreshLocalizedText on every live widget implementing it when the culture changes,
+ * so only the text is re-resolved and the widget (and its stack, pool and loaded assets) stays intact.
+ */
+class EASYUSERINTERFACEMANAGEMENT_API IEasyLocalizedWidgetInterface
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Re-applies the cached localized text of this widget to its text widgets.
+	 */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Localization")
+	void RefreshLocalizedText();
+};
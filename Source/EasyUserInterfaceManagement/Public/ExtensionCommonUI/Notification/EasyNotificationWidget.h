@@ -9,11 +9,19 @@
 #include "CommonLazyWidget.h"
 #include "CommonRichTextBlock.h"
 #include "CommonTextBlock.h"
+#include "GameplayTagContainer.h"
+#include "ExtensionCommonUI/Localization/EasyLocalizedWidgetInterface.h"
 #include "EasyNotificationWidget.generated.h"
 
 class UCommonButtonClickActionBase;
 class UEasyCommonButtonExtended;
+class UEasyNotificationWidget;
+class UEasyUserInterfaceManager;
+class UProgressBar;
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnPromptNotificationDismissed);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnEasyNotificationDismissedNative, UEasyNotificationWidget*);
+/** Declared with the widget so the notification helpers of the User Interface Manager can carry it */
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnNotificationAddedToPanel, FGameplayTag, LayerTag, UEasyNotificationWidget*, NotificationWidget);
 
 /**
  * Base class for notification icon content, which can be used to display custom icons in the notification widget.
@@ -43,6 +51,10 @@ struct FEasyNotificationWidgetInfo
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prompt Notification")
 	TSoftClassPtr<UEasyNotificationIconContent> NotificationIconWidgetClass;
 	
+	/** Notifications with a higher priority leave the backlog of a full layer first (See "LayerMaxVisibleNotifications" in the project settings) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prompt Notification")
+	int32 NotificationPriority;
+
 	/** If set <= 0, the notification will not be automatically dismissed, instead developer should handle it dismissal */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prompt Notification")
 	float NotificationDuration;
@@ -58,15 +70,23 @@ struct FEasyNotificationWidgetInfo
 		NotificationIconWidgetClass = nullptr;
 		NotificationDuration = 6.0f;
 		NotificationIcon = nullptr;
+		NotificationPriority = 0;
 		bCanBeManuallyDismissed = true;
 	}
 };
 
+/**
+ * Shared, immutable notification payload.
+ * Built once from the caller's info and carried through the async load, so the same payload can be handed to
+ * several panels (or players) without copying its texts and soft pointers at every step.
+ */
+using FEasyNotificationWidgetInfoRef = TSharedRef<const FEasyNotificationWidgetInfo>;
+
 /**
  * Base class for notification widgets, which can be used to display various notifications in the game.
  */
 UCLASS(Abstract)
-class EASYUSERINTERFACEMANAGEMENT_API UEasyNotificationWidget : public UCommonUserWidget
+class EASYUSERINTERFACEMANAGEMENT_API UEasyNotificationWidget : public UCommonUserWidget, public IEasyLocalizedWidgetInterface
 {
 	GENERATED_BODY()
 
@@ -76,6 +96,13 @@ public:
 protected:
 	virtual void NativePreConstruct() override;
 	virtual void NativeOnInitialized() override;
+	virtual void NativeDestruct() override;
+	virtual void NativeTick(const FGeometry& MyGeometry, float InDeltaTime) override;
+
+public:
+	//~IEasyLocalizedWidgetInterface interface
+	virtual void RefreshLocalizedText_Implementation() override;
+	//~End of IEasyLocalizedWidgetInterface interface
 	
 public:
 	/** Optional Header Text widget bindings **/
@@ -93,6 +120,12 @@ public:
 	/** Optional Dismiss Button widget bindings that will dismiss the notification if exists **/
 	UPROPERTY(meta = (BindWidgetOptional), BlueprintReadWrite, Category = "Prompt Notification|Dismiss")
 	TObjectPtr<UEasyCommonButtonExtended> DismissButtonWidget;
+	/** Optional Count Text widget bindings, displays the number of identical notifications merged into this one and is collapsed while there is only one **/
+	UPROPERTY(meta = (BindWidgetOptional), BlueprintReadWrite, Category = "Prompt Notification")
+	TObjectPtr<UCommonTextBlock> NotificationCountTextWidget;
+	/** Optional Lifetime Bar widget bindings, filled with the remaining lifetime of the notification **/
+	UPROPERTY(meta = (BindWidgetOptional), BlueprintReadWrite, Category = "Prompt Notification")
+	TObjectPtr<UProgressBar> NotificationLifetimeBarWidget;
 	
 public:
 	/** Information about the notification to be displayed **/
@@ -106,6 +139,12 @@ public:
 	 */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prompt Notification|Dismiss")
 	bool bShouldAutoDismiss = true;
+	/**
+	 * If true, OnNotificationLifetimeProgress is called every frame with the remaining lifetime, published by the User Interface Manager
+	 * for every notification at once. Prefer it to polling GetTimeRemaining. Always published when the Lifetime Bar widget is bound.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Prompt Notification")
+	bool bPublishLifetimeProgress = false;
 	/**
 	 * Text to display on the dismiss button (if any)
 	 */
@@ -130,9 +169,15 @@ public:
 	bool bExecuteDismissActionsOnlyOnButtonPress = false;
 	/**
 	 * Delegate called when the notification is dismissed (either automatically or manually)
+	 * Note: Cleared when a pooled widget returns to its pool, bindings made by the widget itself must be made again in OnNotificationTakenFromPool.
 	 */
 	UPROPERTY(BlueprintAssignable, Category = "Prompt Notification")
 	FOnPromptNotificationDismissed OnPromptNotificationDismissed;
+	/**
+	 * Native event called once the notification is removed from its panel, when it is no longer visible.
+	 * Unlike the dismissal, also called for notifications that are not auto dismissed, or are removed with their panel.
+	 */
+	FOnEasyNotificationDismissedNative& OnNotificationRemovedNative() { return NotificationRemovedNativeEvent; }
 	
 public:
 	/**
@@ -184,13 +229,27 @@ public:
 	 * @param FromData The notification info struct containing details about the notification.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Prompt Notification")
-	void RefreshWidget(FEasyNotificationWidgetInfo FromData);
+	void RefreshWidget(const FEasyNotificationWidgetInfo& FromData);
 
 	/**
 	 * Dismisses the notification, either automatically or manually.
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Prompt Notification")
 	void DismissNotification();
+	/**
+	 * Merges an identical notification into this one: increments its count and restarts its lifetime.
+	 * Called by the User Interface Manager when coalescing is enabled (See "bCoalesceNotifications" in the project settings).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Prompt Notification")
+	void CoalesceNotification();
+	/**
+	 * Retrieves the number of identical notifications this one stands for.
+	 * @return 1, plus the number of notifications merged into it.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Prompt Notification")
+	int32 GetCoalescedCount() const { return CoalescedCount; }
+	/** Retrieves the world time the lifetime of the notification started at, -1 if it was not shown yet. */
+	float GetNotificationStartTime() const { return NotificationStartTime; }
 
 public:
 	/**
@@ -199,6 +258,35 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category = "Prompt Notification")
 	void OnNotificationDismissed();
 	virtual void OnNotificationDismissed_Implementation() {};
+	/**
+	 * Event called when an identical notification is merged into this one, can be overridden in Blueprints for custom behavior.
+	 * @param InCoalescedCount The number of identical notifications this one stands for.
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category = "Prompt Notification")
+	void OnNotificationCoalesced(int32 InCoalescedCount);
+	virtual void OnNotificationCoalesced_Implementation(int32 InCoalescedCount) {};
+	/**
+	 * Event called every frame while the notification is timed, if bPublishLifetimeProgress is set or the Lifetime Bar widget is bound.
+	 * @param TimeRemaining The remaining time in seconds before the notification is dismissed.
+	 * @param Ratio The ratio of elapsed time to total duration (0.0 to 1.0).
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category = "Prompt Notification")
+	void OnNotificationLifetimeProgress(float TimeRemaining, float Ratio);
+	virtual void OnNotificationLifetimeProgress_Implementation(float TimeRemaining, float Ratio) {};
+	/**
+	 * Event called when the dismissed notification is kept by the User Interface Manager to be reused for a later notification.
+	 * Override it to reset the state that SetNotificationInfo does not (animations, bindings to gameplay...).
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category = "Prompt Notification")
+	void OnNotificationReturnedToPool();
+	virtual void OnNotificationReturnedToPool_Implementation() {};
+	/**
+	 * Event called when the User Interface Manager reuses the pooled widget for a new notification, before its info is set.
+	 * Override it to bind again to the dismissal delegates, which are cleared when the widget returns to its pool.
+	 */
+	UFUNCTION(BlueprintNativeEvent, Category = "Prompt Notification")
+	void OnNotificationTakenFromPool();
+	virtual void OnNotificationTakenFromPool_Implementation() {};
 	/**
 	 * Retrieves the remaining time before the notification is dismissed automatically. Generally for cosmetic purposes.
 	 * @param OutTimeRemaining - The remaining time in seconds before the notification is dismissed.
@@ -211,11 +299,31 @@ public:
 private:
 	UFUNCTION()
 	void OnDismissButtonClicked();
+	/** Clears the timer, the dismissal state, the info and the dismissal bindings, before the widget waits in its pool. */
+	void ResetForPool();
+	/** Displays the coalesced count on the count text widget, if bound */
+	void RefreshCoalescedCount();
+	/** Stops the lifetime, whether it is timed by the manager or by a world timer */
+	void CancelLifetime();
+	/** Called by the timing wheel of the manager with the remaining lifetime */
+	void PublishLifetimeProgress(float TimeRemaining, float Ratio);
 	
 private:
+	friend class UEasyUserInterfaceManager;
+	friend class FEasyUserInterfaceNotificationTimingWheel;
+
 	float NotificationStartTime = -1.0f;
+	int32 CoalescedCount = 1;
+	/** Times the lifetime when the widget has no User Interface Manager */
 	FTimerHandle NotificationTimerHandle;
+	/** Manager whose timing wheel times the lifetime, unset if it is timed by NotificationTimerHandle */
+	TWeakObjectPtr<UEasyUserInterfaceManager> LifetimeManager;
 	bool bHasNotificationDismissedByButton = false;
+	FOnEasyNotificationDismissedNative NotificationRemovedNativeEvent;
+	/** Manager the widget returns to once removed on dismissal, unset if it is not pooled */
+	TWeakObjectPtr<UEasyUserInterfaceManager> OwningPoolManager;
+	/** True while the widget waits in its pool, it can not be dismissed again */
+	bool bIsInPool = false;
 
 #if WITH_EDITORONLY_DATA
 protected:
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameplayTagContainer.h"
 #include "ExtensionCommonUI/ActivatableWidget/EasyActivatableWidgetBase.h"
+#include "ExtensionCommonUI/Localization/EasyLocalizedWidgetInterface.h"
 #include "EasyPromptQuestion.generated.h"
 
 
@@ -67,7 +68,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnPromtQuestionResult, EPromptQuest
  * Base class for a prompt question widget that can be used to ask the user a question with confirm and cancel options.
  */
 UCLASS(Abstract)
-class EASYUSERINTERFACEMANAGEMENT_API UEasyPromptQuestion : public UEasyActivatableWidgetBase
+class EASYUSERINTERFACEMANAGEMENT_API UEasyPromptQuestion : public UEasyActivatableWidgetBase, public IEasyLocalizedWidgetInterface
 {
 	GENERATED_BODY()
 
@@ -80,6 +81,10 @@ public:
 	virtual void NativeOnActivated() override;
 	virtual void NativeOnDeactivated() override;
 
+	//~IEasyLocalizedWidgetInterface interface
+	virtual void RefreshLocalizedText_Implementation() override;
+	//~End of IEasyLocalizedWidgetInterface interface
+
 public:
 	/** Information about the prompt question body */
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Prompt Question|Body")
@@ -91,6 +96,13 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Prompt Question|Events")
 	void RefreshWidget();
+
+	/**
+	 * Answers the prompt as if its Confirm or Cancel button was clicked, e.g. from tests or replays.
+	 * @param bConfirm Whether to confirm the prompt, cancels it otherwise.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Prompt Question|Events")
+	void AnswerPrompt(bool bConfirm);
 	
 protected:
 	/**
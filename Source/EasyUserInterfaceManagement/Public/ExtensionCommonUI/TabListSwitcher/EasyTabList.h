@@ -52,6 +52,7 @@ public:
 	// Function to initialize action buttons
 	virtual void NativeConstruct() override;
 	virtual void NativePreConstruct() override;
+	virtual void NativeOnInitialized() override;
 	
 public:
 	/**
@@ -158,4 +159,7 @@ private:
 	void UpdateActionWrappers();
 	/** Updates the linked switcher based on the LinkedSwitcherOnScene property */
 	void UpdateLinkedSwitcher();
+	/** Records the tab selections while a User Interface session is being recorded */
+	UFUNCTION()
+	void HandleTabSelectedForRecording(FName TabId);
 };
@@ -0,0 +1,46 @@
+// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#include "EasyUserInterfaceManagementEditor.h"
+#include "CoreGlobals.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSettings.h"
+#include "EasyUserInterfaceManagementEditor/EasyUserInterfaceNavigationGraphCommandlet.h"
+#include "Misc/CoreDelegates.h"
+
+#define LOCTEXT_NAMESPACE "FEasyUserInterfaceManagementEditorModule"
+
+// Initialize Log Category for Easy User Interface Management editor
+DEFINE_LOG_CATEGORY(LogEasyUserInterfaceManagementEditor);
+
+void FEasyUserInterfaceManagementEditorModule::StartupModule()
+{
+	if (IsRunningCookCommandlet())
+	{
+		FCoreDelegates::OnPostEngineInit.AddRaw(this, &FEasyUserInterfaceManagementEditorModule::BuildNavigationGraphForCook);
+	}
+}
+
+void FEasyUserInterfaceManagementEditorModule::ShutdownModule()
+{
+	FCoreDelegates::OnPostEngineInit.RemoveAll(this);
+}
+
+void FEasyUserInterfaceManagementEditorModule::BuildNavigationGraphForCook()
+{
+	const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+	if (!Settings->bPrefetchReachableWidgets || !Settings->bBuildNavigationGraphOnCook || Settings->NavigationGraph.IsNull())
+	{
+		return;
+	}
+
+	// Saved before the cook collects its packages, so the cooked graph is the rebuilt one
+	const FString AssetPath = Settings->NavigationGraph.ToSoftObjectPath().GetLongPackageName();
+	int32 NumFailures = 0;
+	if (!UEasyUserInterfaceNavigationGraphCommandlet::UpdateNavigationGraphAsset(AssetPath, TEXT("/Game"), NumFailures))
+	{
+		UE_LOG(LogEasyUserInterfaceManagementEditor, Warning, TEXT("The navigation graph %s could not be rebuilt for the cook, the saved one is cooked."), *AssetPath);
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FEasyUserInterfaceManagementEditorModule, EasyUserInterfaceManagementEditor)
@@ -0,0 +1,124 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagementEditor/EasyUserInterfaceNavigationGraphCommandlet.h"
+
+#include "EasyUserInterfaceManagementEditor.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Blueprint/UserWidget.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceNavigationGraph.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSettings.h"
+#include "EasyUserInterfaceManagementEditor/EasyUserInterfaceWidgetScanner.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+UEasyUserInterfaceNavigationGraphCommandlet::UEasyUserInterfaceNavigationGraphCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+
+	HelpDescription = TEXT("Saves the widgets each Easy User Interface Management widget blueprint can open into the navigation graph asset.");
+	HelpUsage = TEXT("-run=EasyUserInterfaceNavigationGraph [Path=/Game] [Asset=/Game/UI/NavigationGraph]");
+}
+
+int32 UEasyUserInterfaceNavigationGraphCommandlet::Main(const FString& Params)
+{
+	FString ContentPath = TEXT("/Game");
+	FString AssetPath = UEasyUserInterfaceSettings::Get()->NavigationGraph.ToSoftObjectPath().GetLongPackageName();
+	FParse::Value(*Params, TEXT("Path="), ContentPath);
+	FParse::Value(*Params, TEXT("Asset="), AssetPath);
+
+	if (AssetPath.IsEmpty() || !FPackageName::IsValidLongPackageName(AssetPath))
+	{
+		UE_LOG(LogEasyUserInterfaceManagementEditor, Error, TEXT("No valid navigation graph asset, set one with Asset=/Game/... or in the project settings (got '%s')."), *AssetPath);
+		return 1;
+	}
+
+	int32 NumFailures = 0;
+	if (!UpdateNavigationGraphAsset(AssetPath, ContentPath, NumFailures))
+	{
+		return 1;
+	}
+	return NumFailures > 0 ? 1 : 0;
+}
+
+bool UEasyUserInterfaceNavigationGraphCommandlet::UpdateNavigationGraphAsset(const FString& AssetPath, const FString& ContentPath, int32& OutNumFailures)
+{
+	const FString AssetName = FPackageName::GetLongPackageAssetName(AssetPath);
+	UEasyUserInterfaceNavigationGraph* NavigationGraph = LoadObject<UEasyUserInterfaceNavigationGraph>(nullptr, *FString::Printf(TEXT("%s.%s"), *AssetPath, *AssetName), nullptr, LOAD_NoWarn | LOAD_Quiet);
+	if (!NavigationGraph)
+	{
+		UPackage* Package = CreatePackage(*AssetPath);
+		NavigationGraph = NewObject<UEasyUserInterfaceNavigationGraph>(Package, *AssetName, RF_Public | RF_Standalone);
+		FAssetRegistryModule::AssetCreated(NavigationGraph);
+	}
+
+	OutNumFailures = BuildNavigationGraph(*NavigationGraph, ContentPath);
+	NavigationGraph->MarkPackageDirty();
+
+	UPackage* Package = NavigationGraph->GetOutermost();
+	const FString Filename = FPackageName::LongPackageNameToFilename(AssetPath, FPackageName::GetAssetPackageExtension());
+	FSavePackageArgs SaveArgs;
+	SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+	SaveArgs.SaveFlags = SAVE_NoError;
+	if (!UPackage::SavePackage(Package, NavigationGraph, *Filename, SaveArgs))
+	{
+		UE_LOG(LogEasyUserInterfaceManagementEditor, Error, TEXT("Failed to save the navigation graph to %s, is the file checked out?"), *Filename);
+		return false;
+	}
+
+	UE_LOG(LogEasyUserInterfaceManagementEditor, Display, TEXT("Navigation graph saved to %s: %d node(s), %d edge(s), %d widget blueprint(s) failed to load."),
+		*AssetPath, NavigationGraph->Nodes.Num(), NavigationGraph->GetNumEdges(), OutNumFailures);
+	return true;
+}
+
+int32 UEasyUserInterfaceNavigationGraphCommandlet::BuildNavigationGraph(UEasyUserInterfaceNavigationGraph& NavigationGraph, const FString& ContentPath)
+{
+	NavigationGraph.Nodes.Reset();
+
+	int32 NumFailures = 0;
+	for (const FAssetData& BlueprintAsset : FEasyUserInterfaceWidgetScanner::FindWidgetBlueprints(ContentPath))
+	{
+		const UClass* WidgetClass = FEasyUserInterfaceWidgetScanner::LoadWidgetClass(BlueprintAsset);
+		if (!WidgetClass)
+		{
+			UE_LOG(LogEasyUserInterfaceManagementEditor, Error, TEXT("Failed to load the widget class of %s"), *BlueprintAsset.GetObjectPathString());
+			++NumFailures;
+			continue;
+		}
+
+		TArray<FEasyUserInterfaceOpenedWidget> OpenedWidgets;
+		FEasyUserInterfaceWidgetScanner::CollectOpenedWidgets(*WidgetClass, OpenedWidgets);
+		if (OpenedWidgets.IsEmpty())
+		{
+			continue;
+		}
+
+		FEasyUserInterfaceNavigationNode& Node = NavigationGraph.Nodes.Add(TSoftClassPtr<UUserWidget>(FSoftObjectPath(WidgetClass)));
+		for (const FEasyUserInterfaceOpenedWidget& OpenedWidget : OpenedWidgets)
+		{
+			// Native classes are always loaded, there is nothing to prefetch
+			if (FPackageName::IsScriptPackage(OpenedWidget.WidgetClass.GetLongPackageName()))
+			{
+				continue;
+			}
+
+			FEasyUserInterfaceNavigationEdge& Edge = Node.Edges.AddDefaulted_GetRef();
+			Edge.WidgetClass = TSoftClassPtr<UUserWidget>(OpenedWidget.WidgetClass);
+			Edge.LayerTag = OpenedWidget.LayerTag;
+		}
+	}
+
+	// Nodes left without edges by native classes
+	for (auto NodeIt = NavigationGraph.Nodes.CreateIterator(); NodeIt; ++NodeIt)
+	{
+		if (NodeIt->Value.Edges.IsEmpty())
+		{
+			NodeIt.RemoveCurrent();
+		}
+	}
+	return NumFailures;
+}
@@ -0,0 +1,307 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagementEditor/EasyUserInterfaceReferenceAuditCommandlet.h"
+
+#include "EasyUserInterfaceManagementEditor.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Dom/JsonObject.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceJson.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSettings.h"
+#include "EasyUserInterfaceManagementEditor/EasyUserInterfaceWidgetScanner.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectHash.h"
+
+namespace EasyUserInterfaceReferenceAudit
+{
+	constexpr double BytesPerMB = 1024.0 * 1024.0;
+	/** Classes audited between two garbage collections, the loaded packages are kept in check on large projects */
+	constexpr int32 ClassesPerGarbageCollection = 50;
+
+	struct FFootprint
+	{
+		TSet<FName> Packages;
+		int64 DiskSize = 0;
+		int64 MemorySize = 0;
+	};
+
+	struct FAuditContext
+	{
+		IAssetRegistry* AssetRegistry = nullptr;
+		bool bMeasureMemory = false;
+		int32 NumLargestPackages = 10;
+		TMap<FName, int64> DiskSizes;
+		TMap<FName, int64> MemorySizes;
+		int32 NumViolations = 0;
+	};
+
+	/** Gathers the packages loaded along with the root package, editor only and soft references excluded */
+	void GatherHardReferences(const FAuditContext& Context, FName RootPackage, TSet<FName>& OutPackages)
+	{
+		TArray<FName> PackagesToVisit = { RootPackage };
+		TArray<FName> Dependencies;
+		while (PackagesToVisit.Num() > 0)
+		{
+			const FName PackageName = PackagesToVisit.Pop(EAllowShrinking::No);
+			bool bIsAlreadyVisited = false;
+			OutPackages.Add(PackageName, &bIsAlreadyVisited);
+			if (bIsAlreadyVisited)
+			{
+				continue;
+			}
+
+			Dependencies.Reset();
+			Context.AssetRegistry->GetDependencies(PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package,
+				UE::AssetRegistry::EDependencyQuery::Hard | UE::AssetRegistry::EDependencyQuery::Game);
+			for (const FName Dependency : Dependencies)
+			{
+				// Native classes are always loaded, they are not part of the footprint
+				if (!FPackageName::IsScriptPackage(Dependency.ToString()))
+				{
+					PackagesToVisit.Add(Dependency);
+				}
+			}
+		}
+	}
+
+	int64 GetDiskSize(FAuditContext& Context, FName PackageName)
+	{
+		if (const int64* DiskSize = Context.DiskSizes.Find(PackageName))
+		{
+			return *DiskSize;
+		}
+
+		const TOptional<FAssetPackageData> PackageData = Context.AssetRegistry->GetAssetPackageDataCopy(PackageName);
+		const int64 DiskSize = PackageData.IsSet() ? FMath::Max<int64>(PackageData->DiskSize, 0) : 0;
+		Context.DiskSizes.Add(PackageName, DiskSize);
+		return DiskSize;
+	}
+
+	int64 GetMemorySize(FAuditContext& Context, FName PackageName)
+	{
+		if (const int64* MemorySize = Context.MemorySizes.Find(PackageName))
+		{
+			return *MemorySize;
+		}
+
+		// The package is usually already loaded by the class referencing it
+		const FString PackagePath = PackageName.ToString();
+		UPackage* Package = FindPackage(nullptr, *PackagePath);
+		if (!Package)
+		{
+			Package = LoadPackage(nullptr, *PackagePath, LOAD_NoWarn | LOAD_Quiet);
+		}
+
+		int64 MemorySize = 0;
+		if (Package)
+		{
+			ForEachObjectWithPackage(Package, [&MemorySize](UObject* Object)
+			{
+				MemorySize += Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+				return true;
+			});
+		}
+		Context.MemorySizes.Add(PackageName, MemorySize);
+		return MemorySize;
+	}
+
+	void MeasureFootprint(FAuditContext& Context, FFootprint& Footprint)
+	{
+		Footprint.DiskSize = 0;
+		Footprint.MemorySize = 0;
+		for (const FName PackageName : Footprint.Packages)
+		{
+			Footprint.DiskSize += GetDiskSize(Context, PackageName);
+			Footprint.MemorySize += Context.bMeasureMemory ? GetMemorySize(Context, PackageName) : 0;
+		}
+	}
+
+	/** Finds the budget of the class or of its closest parent, the default budget otherwise */
+	const FEasyHardReferenceBudget& FindClassBudget(const UEasyUserInterfaceSettings& Settings, const UClass* WidgetClass)
+	{
+		for (const UClass* Class = WidgetClass; Class; Class = Class->GetSuperClass())
+		{
+			if (const FEasyHardReferenceBudget* Budget = Settings.ClassHardReferenceBudgets.Find(TSoftClassPtr<UUserWidget>(FSoftObjectPath(Class))))
+			{
+				return *Budget;
+			}
+		}
+		return Settings.DefaultHardReferenceBudget;
+	}
+
+	/** Compares a size to its budget, a zero budget is not checked */
+	void CheckBudget(TArray<TSharedPtr<FJsonValue>>& OutViolations, const TCHAR* Name, double MeasuredMB, float BudgetMB)
+	{
+		if (BudgetMB > 0.0f && MeasuredMB > BudgetMB)
+		{
+			TSharedRef<FJsonObject> Violation = MakeShared<FJsonObject>();
+			Violation->SetStringField(TEXT("Budget"), Name);
+			Violation->SetNumberField(TEXT("Measured"), MeasuredMB);
+			Violation->SetNumberField(TEXT("Limit"), BudgetMB);
+			OutViolations.Add(MakeShared<FJsonValueObject>(Violation));
+		}
+	}
+
+	/** Writes the footprint and its largest packages, and checks it against its budget */
+	TSharedRef<FJsonObject> MakeFootprintResult(FAuditContext& Context, const FString& Name, const FFootprint& Footprint, const FEasyHardReferenceBudget& Budget)
+	{
+		const double DiskSizeMB = Footprint.DiskSize / BytesPerMB;
+		const double MemorySizeMB = Footprint.MemorySize / BytesPerMB;
+
+		TArray<TSharedPtr<FJsonValue>> Violations;
+		CheckBudget(Violations, TEXT("DiskSizeMB"), DiskSizeMB, Budget.MaxDiskSizeMB);
+		if (Context.bMeasureMemory)
+		{
+			CheckBudget(Violations, TEXT("MemorySizeMB"), MemorySizeMB, Budget.MaxMemorySizeMB);
+		}
+
+		TArray<FName> LargestPackages = Footprint.Packages.Array();
+		LargestPackages.Sort([&Context](const FName A, const FName B)
+		{
+			return Context.DiskSizes.FindRef(A) > Context.DiskSizes.FindRef(B);
+		});
+
+		TArray<TSharedPtr<FJsonValue>> LargestPackageValues;
+		for (int32 Index = 0; Index < FMath::Min(LargestPackages.Num(), Context.NumLargestPackages); ++Index)
+		{
+			TSharedRef<FJsonObject> PackageObject = MakeShared<FJsonObject>();
+			PackageObject->SetStringField(TEXT("Package"), LargestPackages[Index].ToString());
+			PackageObject->SetNumberField(TEXT("DiskSizeMB"), Context.DiskSizes.FindRef(LargestPackages[Index]) / BytesPerMB);
+			if (Context.bMeasureMemory)
+			{
+				PackageObject->SetNumberField(TEXT("MemorySizeMB"), Context.MemorySizes.FindRef(LargestPackages[Index]) / BytesPerMB);
+			}
+			LargestPackageValues.Add(MakeShared<FJsonValueObject>(PackageObject));
+		}
+
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		Result->SetNumberField(TEXT("NumPackages"), Footprint.Packages.Num());
+		Result->SetNumberField(TEXT("DiskSizeMB"), DiskSizeMB);
+		if (Context.bMeasureMemory)
+		{
+			Result->SetNumberField(TEXT("MemorySizeMB"), MemorySizeMB);
+		}
+		Result->SetArrayField(TEXT("LargestPackages"), LargestPackageValues);
+		Result->SetArrayField(TEXT("Violations"), Violations);
+
+		if (Violations.Num() > 0)
+		{
+			UE_LOG(LogEasyUserInterfaceManagementEditor, Error, TEXT("%s is over its hard reference budget: %d package(s), %.2f MB on disk%s"),
+				*Name, Footprint.Packages.Num(), DiskSizeMB, Context.bMeasureMemory ? *FString::Printf(TEXT(", %.2f MB in memory"), MemorySizeMB) : TEXT(""));
+			++Context.NumViolations;
+		}
+		return Result;
+	}
+}
+
+UEasyUserInterfaceReferenceAuditCommandlet::UEasyUserInterfaceReferenceAuditCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+
+	HelpDescription = TEXT("Audits the hard reference footprint of the widget blueprints deriving from the Easy User Interface Management classes.");
+	HelpUsage = TEXT("-run=EasyUserInterfaceReferenceAudit [Path=/Game] [Output=<File>] [Top=10] [-Memory]");
+}
+
+int32 UEasyUserInterfaceReferenceAuditCommandlet::Main(const FString& Params)
+{
+	using namespace EasyUserInterfaceReferenceAudit;
+
+	TArray<FString> Tokens;
+	TArray<FString> Switches;
+	ParseCommandLine(*Params, Tokens, Switches);
+
+	FString ContentPath = TEXT("/Game");
+	FString OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyUI"), TEXT("ReferenceAudit.json"));
+	FParse::Value(*Params, TEXT("Path="), ContentPath);
+	FParse::Value(*Params, TEXT("Output="), OutputPath);
+
+	FAuditContext Context;
+	Context.AssetRegistry = &FAssetRegistryModule::GetRegistry();
+	Context.bMeasureMemory = Switches.Contains(TEXT("Memory"));
+	FParse::Value(*Params, TEXT("Top="), Context.NumLargestPackages);
+
+	const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+	const TArray<FAssetData> WidgetBlueprints = FEasyUserInterfaceWidgetScanner::FindWidgetBlueprints(ContentPath);
+	UE_LOG(LogEasyUserInterfaceManagementEditor, Display, TEXT("Auditing the hard references of %d widget blueprint(s) under %s"), WidgetBlueprints.Num(), *ContentPath);
+
+	TArray<TSharedPtr<FJsonValue>> ClassResults;
+	TMap<FGameplayTag, TSet<FSoftObjectPath>> LayerWidgetClasses;
+	int32 NumFailures = 0;
+	for (int32 BlueprintIndex = 0; BlueprintIndex < WidgetBlueprints.Num(); ++BlueprintIndex)
+	{
+		const FAssetData& BlueprintAsset = WidgetBlueprints[BlueprintIndex];
+		const UClass* WidgetClass = FEasyUserInterfaceWidgetScanner::LoadWidgetClass(BlueprintAsset);
+		if (!WidgetClass)
+		{
+			UE_LOG(LogEasyUserInterfaceManagementEditor, Error, TEXT("Failed to load the widget class of %s"), *BlueprintAsset.GetObjectPathString());
+			++NumFailures;
+			continue;
+		}
+
+		FFootprint Footprint;
+		GatherHardReferences(Context, BlueprintAsset.PackageName, Footprint.Packages);
+		MeasureFootprint(Context, Footprint);
+
+		TSharedRef<FJsonObject> ClassResult = MakeFootprintResult(Context, WidgetClass->GetName(), Footprint, FindClassBudget(*Settings, WidgetClass));
+		ClassResult->SetStringField(TEXT("Class"), WidgetClass->GetPathName());
+		ClassResults.Add(MakeShared<FJsonValueObject>(ClassResult));
+
+		TArray<FEasyUserInterfaceOpenedWidget> OpenedWidgets;
+		FEasyUserInterfaceWidgetScanner::CollectOpenedWidgets(*WidgetClass, OpenedWidgets);
+		for (const FEasyUserInterfaceOpenedWidget& OpenedWidget : OpenedWidgets)
+		{
+			if (OpenedWidget.LayerTag.IsValid())
+			{
+				LayerWidgetClasses.FindOrAdd(OpenedWidget.LayerTag).Add(OpenedWidget.WidgetClass);
+			}
+		}
+
+		if ((BlueprintIndex + 1) % ClassesPerGarbageCollection == 0)
+		{
+			CollectGarbage(RF_NoFlags);
+		}
+	}
+
+	// A layer keeps loaded everything referenced by the widgets opened on it
+	TArray<TSharedPtr<FJsonValue>> LayerResults;
+	for (const TPair<FGameplayTag, TSet<FSoftObjectPath>>& LayerPair : LayerWidgetClasses)
+	{
+		FFootprint Footprint;
+		TArray<TSharedPtr<FJsonValue>> WidgetClassValues;
+		for (const FSoftObjectPath& WidgetClassPath : LayerPair.Value)
+		{
+			WidgetClassValues.Add(MakeShared<FJsonValueString>(WidgetClassPath.ToString()));
+			const FName PackageName = WidgetClassPath.GetLongPackageFName();
+			if (!FPackageName::IsScriptPackage(PackageName.ToString()))
+			{
+				GatherHardReferences(Context, PackageName, Footprint.Packages);
+			}
+		}
+		MeasureFootprint(Context, Footprint);
+
+		const FEasyHardReferenceBudget* LayerBudget = Settings->LayerHardReferenceBudgets.Find(LayerPair.Key);
+		TSharedRef<FJsonObject> LayerResult = MakeFootprintResult(Context, LayerPair.Key.ToString(), Footprint, LayerBudget ? *LayerBudget : FEasyHardReferenceBudget());
+		LayerResult->SetStringField(TEXT("Layer"), LayerPair.Key.ToString());
+		LayerResult->SetArrayField(TEXT("WidgetClasses"), WidgetClassValues);
+		LayerResults.Add(MakeShared<FJsonValueObject>(LayerResult));
+	}
+
+	TSharedRef<FJsonObject> Results = MakeShared<FJsonObject>();
+	Results->SetStringField(TEXT("ContentPath"), ContentPath);
+	Results->SetBoolField(TEXT("MeasuredMemory"), Context.bMeasureMemory);
+	Results->SetArrayField(TEXT("Classes"), ClassResults);
+	Results->SetArrayField(TEXT("Layers"), LayerResults);
+	Results->SetNumberField(TEXT("NumViolations"), Context.NumViolations);
+	Results->SetNumberField(TEXT("NumFailures"), NumFailures);
+	FEasyUserInterfaceJson::WriteToFile(Results, OutputPath);
+
+	UE_LOG(LogEasyUserInterfaceManagementEditor, Display, TEXT("Reference audit done: %d class(es), %d layer(s), %d over budget, %d failed to load. Results written to %s"),
+		ClassResults.Num(), LayerResults.Num(), Context.NumViolations, NumFailures, *OutputPath);
+	return Context.NumViolations > 0 || NumFailures > 0 ? 1 : 0;
+}
@@ -0,0 +1,181 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagementEditor/EasyUserInterfaceWidgetScanner.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Blueprint/WidgetBlueprintGeneratedClass.h"
+#include "Blueprint/WidgetTree.h"
+#include "Engine/Blueprint.h"
+#include "ExtensionCommonUI/ActivatableWidget/EasyActivatableWidgetBase.h"
+#include "ExtensionCommonUI/Foundation/EasyCommonButtonExtended.h"
+#include "ExtensionCommonUI/Foundation/ButtonActions/ButtonAction_AddNotification.h"
+#include "ExtensionCommonUI/Foundation/ButtonActions/ButtonAction_Multiple.h"
+#include "ExtensionCommonUI/Foundation/ButtonActions/ButtonAction_PushQuestionPrompt.h"
+#include "ExtensionCommonUI/Foundation/ButtonActions/ButtonAction_PushWidgetToStack.h"
+#include "Misc/PackageName.h"
+
+namespace EasyUserInterfaceWidgetScanner
+{
+	void AddOpenedWidget(TArray<FEasyUserInterfaceOpenedWidget>& OutOpenedWidgets, const FSoftObjectPath& WidgetClass, const FGameplayTag& LayerTag, EEasyUserInterfaceOpenKind Kind)
+	{
+		if (WidgetClass.IsNull())
+		{
+			return;
+		}
+
+		FEasyUserInterfaceOpenedWidget OpenedWidget;
+		OpenedWidget.WidgetClass = WidgetClass;
+		OpenedWidget.LayerTag = LayerTag;
+		OpenedWidget.Kind = Kind;
+		OutOpenedWidgets.AddUnique(OpenedWidget);
+	}
+
+	void CollectFromClass(const UClass& WidgetClass, TSet<const UClass*>& VisitedClasses, TArray<FEasyUserInterfaceOpenedWidget>& OutOpenedWidgets)
+	{
+		bool bIsAlreadyVisited = false;
+		VisitedClasses.Add(&WidgetClass, &bIsAlreadyVisited);
+		if (bIsAlreadyVisited)
+		{
+			return;
+		}
+
+		// Blueprints deriving from a widget blueprint inherit the widget tree of their parent
+		for (const UClass* Class = &WidgetClass; Class; Class = Class->GetSuperClass())
+		{
+			const UWidgetBlueprintGeneratedClass* WidgetBlueprintClass = Cast<UWidgetBlueprintGeneratedClass>(Class);
+			const UWidgetTree* WidgetTree = WidgetBlueprintClass ? WidgetBlueprintClass->GetWidgetTreeArchetype() : nullptr;
+			if (!WidgetTree)
+			{
+				continue;
+			}
+
+			WidgetTree->ForEachWidget([&VisitedClasses, &OutOpenedWidgets](UWidget* Widget)
+			{
+				// The action of a placed button is its own instanced copy, which may differ from the button class default
+				if (const UEasyCommonButtonExtended* Button = Cast<UEasyCommonButtonExtended>(Widget))
+				{
+					FEasyUserInterfaceWidgetScanner::CollectOpenedWidgets(Button->ButtonClickAction, OutOpenedWidgets);
+				}
+				else if (Widget->IsA<UUserWidget>())
+				{
+					CollectFromClass(*Widget->GetClass(), VisitedClasses, OutOpenedWidgets);
+				}
+			});
+		}
+	}
+}
+
+TArray<FAssetData> FEasyUserInterfaceWidgetScanner::FindWidgetBlueprints(const FString& ContentPath)
+{
+	IAssetRegistry& AssetRegistry = FAssetRegistryModule::GetRegistry();
+	AssetRegistry.WaitForCompletion();
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssetsByPaths({ FName(*ContentPath) }, Assets, true);
+
+	// Every plugin class lives in the package of the runtime module
+	const UPackage* PluginPackage = UEasyActivatableWidgetBase::StaticClass()->GetOutermost();
+
+	// A blueprint placing a plugin widget in its tree imports its class, so its package hard depends on the plugin script package
+	TSet<FName> UsingPackages;
+	TArray<FName> OtherPackages;
+	TArray<FName> Dependencies;
+	for (const FAssetData& Asset : Assets)
+	{
+		const FString NativeParentPath = Asset.GetTagValueRef<FString>(FBlueprintTags::NativeParentClassPath);
+		const UClass* NativeParent = NativeParentPath.IsEmpty() ? nullptr : FindObject<UClass>(nullptr, *FPackageName::ExportTextPathToObjectPath(NativeParentPath));
+		if (!NativeParent || !NativeParent->IsChildOf<UUserWidget>())
+		{
+			continue;
+		}
+
+		Dependencies.Reset();
+		AssetRegistry.GetDependencies(Asset.PackageName, Dependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+		if (NativeParent->GetOutermost() == PluginPackage || Dependencies.Contains(PluginPackage->GetFName()))
+		{
+			UsingPackages.Add(Asset.PackageName);
+		}
+		else
+		{
+			OtherPackages.Add(Asset.PackageName);
+		}
+	}
+
+	// Placing or deriving from a blueprint using the plugin uses it too, followed until no blueprint is added
+	bool bIsAnyAdded = true;
+	while (bIsAnyAdded)
+	{
+		bIsAnyAdded = false;
+		for (int32 Index = OtherPackages.Num() - 1; Index >= 0; --Index)
+		{
+			Dependencies.Reset();
+			AssetRegistry.GetDependencies(OtherPackages[Index], Dependencies, UE::AssetRegistry::EDependencyCategory::Package, UE::AssetRegistry::EDependencyQuery::Hard);
+			if (Dependencies.ContainsByPredicate([&UsingPackages](const FName& Dependency) { return UsingPackages.Contains(Dependency); }))
+			{
+				UsingPackages.Add(OtherPackages[Index]);
+				OtherPackages.RemoveAtSwap(Index);
+				bIsAnyAdded = true;
+			}
+		}
+	}
+
+	TArray<FAssetData> WidgetBlueprints;
+	for (const FAssetData& Asset : Assets)
+	{
+		if (UsingPackages.Contains(Asset.PackageName))
+		{
+			WidgetBlueprints.Add(Asset);
+		}
+	}
+	return WidgetBlueprints;
+}
+
+UClass* FEasyUserInterfaceWidgetScanner::LoadWidgetClass(const FAssetData& BlueprintAsset)
+{
+	const FString GeneratedClassPath = BlueprintAsset.GetTagValueRef<FString>(FBlueprintTags::GeneratedClassPath);
+	return GeneratedClassPath.IsEmpty() ? nullptr : LoadObject<UClass>(nullptr, *FPackageName::ExportTextPathToObjectPath(GeneratedClassPath));
+}
+
+void FEasyUserInterfaceWidgetScanner::CollectOpenedWidgets(const UClass& WidgetClass, TArray<FEasyUserInterfaceOpenedWidget>& OutOpenedWidgets)
+{
+	TSet<const UClass*> VisitedClasses;
+	EasyUserInterfaceWidgetScanner::CollectFromClass(WidgetClass, VisitedClasses, OutOpenedWidgets);
+}
+
+void FEasyUserInterfaceWidgetScanner::CollectOpenedWidgets(const UCommonButtonClickActionBase* Action, TArray<FEasyUserInterfaceOpenedWidget>& OutOpenedWidgets)
+{
+	using namespace EasyUserInterfaceWidgetScanner;
+
+	if (const UButtonAction_PushWidgetToStack* PushAction = Cast<UButtonAction_PushWidgetToStack>(Action))
+	{
+		AddOpenedWidget(OutOpenedWidgets, PushAction->WidgetToPush.ToSoftObjectPath(), PushAction->LayerTag, EEasyUserInterfaceOpenKind::Screen);
+	}
+	else if (const UButtonAction_PushQuestionPrompt* PromptAction = Cast<UButtonAction_PushQuestionPrompt>(Action))
+	{
+		AddOpenedWidget(OutOpenedWidgets, FSoftObjectPath(PromptAction->QuestionWidgetClass.Get()), PromptAction->RootStackLayer, EEasyUserInterfaceOpenKind::Prompt);
+	}
+	else if (const UButtonAction_AddNotification* NotificationAction = Cast<UButtonAction_AddNotification>(Action))
+	{
+		AddOpenedWidget(OutOpenedWidgets, NotificationAction->NotificationWidgetClass.ToSoftObjectPath(), NotificationAction->NotificationType, EEasyUserInterfaceOpenKind::Notification);
+	}
+	else if (const UButtonAction_Multiple* MultipleAction = Cast<UButtonAction_Multiple>(Action))
+	{
+		for (const UCommonButtonClickActionBase* NestedAction : MultipleAction->Actions)
+		{
+			CollectOpenedWidgets(NestedAction, OutOpenedWidgets);
+		}
+	}
+}
+
+const TCHAR* FEasyUserInterfaceWidgetScanner::LexToString(EEasyUserInterfaceOpenKind Kind)
+{
+	switch (Kind)
+	{
+	case EEasyUserInterfaceOpenKind::Screen: return TEXT("Screen");
+	case EEasyUserInterfaceOpenKind::Prompt: return TEXT("Prompt");
+	case EEasyUserInterfaceOpenKind::Notification: return TEXT("Notification");
+	default: return TEXT("Unknown");
+	}
+}
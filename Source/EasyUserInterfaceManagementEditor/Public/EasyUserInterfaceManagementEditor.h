@@ -0,0 +1,21 @@
+// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "Modules/ModuleManager.h"
+
+// Declare log category for the Easy User Interface Management editor module
+DECLARE_LOG_CATEGORY_EXTERN(LogEasyUserInterfaceManagementEditor, Log, All);
+
+class FEasyUserInterfaceManagementEditorModule : public IModuleInterface
+{
+public:
+
+	/** IModuleInterface implementation */
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+
+private:
+	/** Rebuilds the navigation graph of the project settings once the cook commandlet initialized the engine, before it cooks anything. */
+	void BuildNavigationGraphForCook();
+};
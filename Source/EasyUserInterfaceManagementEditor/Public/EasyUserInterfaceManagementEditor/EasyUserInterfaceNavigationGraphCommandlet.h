@@ -0,0 +1,47 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "EasyUserInterfaceNavigationGraphCommandlet.generated.h"
+
+class UEasyUserInterfaceNavigationGraph;
+
+/**
+ * Extracts which widgets each widget blueprint using the plugin widgets can open through its button actions, and saves
+ * them into the navigation graph asset the User Interface Manager prefetches from (See "Preloading" in the project settings).
+ *
+ * Usage: UnrealEditor-Cmd <Project> -run=EasyUserInterfaceNavigationGraph [Path=/Game] [Asset=/Game/UI/NavigationGraph]
+ * The asset defaults to the Navigation Graph of the project settings. A cook rebuilds the graph of the project settings before
+ * it starts unless "Build Navigation Graph On Cook" is off, the commandlet is for cooks that run with it off.
+ */
+UCLASS()
+class EASYUSERINTERFACEMANAGEMENTEDITOR_API UEasyUserInterfaceNavigationGraphCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UEasyUserInterfaceNavigationGraphCommandlet();
+
+	//~UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+	//~End of UCommandlet interface
+
+	/**
+	 * Rebuilds the nodes of a navigation graph from the widget blueprints found under a content path. Loads the blueprints.
+	 * @param NavigationGraph The graph to rebuild.
+	 * @param ContentPath The content path to search in, recursively.
+	 * @return The number of widget blueprints that failed to load.
+	 */
+	static int32 BuildNavigationGraph(UEasyUserInterfaceNavigationGraph& NavigationGraph, const FString& ContentPath);
+
+	/**
+	 * Rebuilds the navigation graph asset, created if missing, and saves it.
+	 * @param AssetPath The long package name of the asset.
+	 * @param ContentPath The content path to search in, recursively.
+	 * @param OutNumFailures The number of widget blueprints that failed to load.
+	 * @return True if the asset was saved.
+	 */
+	static bool UpdateNavigationGraphAsset(const FString& AssetPath, const FString& ContentPath, int32& OutNumFailures);
+};
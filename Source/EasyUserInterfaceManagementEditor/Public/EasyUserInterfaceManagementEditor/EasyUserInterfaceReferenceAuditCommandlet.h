@@ -0,0 +1,30 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "EasyUserInterfaceReferenceAuditCommandlet.generated.h"
+
+/**
+ * Computes the hard reference footprint of every widget blueprint using the plugin widgets: the packages that get
+ * loaded along with the class through its TSubclassOf, hard object pointers, styles and instanced button actions, and their
+ * size on disk and optionally in memory. The widgets opened by button actions are grouped by layer, so layers are audited too.
+ *
+ * Usage: UnrealEditor-Cmd <Project> -run=EasyUserInterfaceReferenceAudit [Path=/Game] [Output=<File>] [Top=10] [-Memory]
+ * The budgets are set in the "Reference Audit" project settings. Writes Saved/EasyUI/ReferenceAudit.json by default and
+ * returns a non zero code when a class or a layer is over its budget, so CI can fail the build.
+ * Memory sizes are measured on editor data, they are an estimate of the cooked footprint.
+ */
+UCLASS()
+class EASYUSERINTERFACEMANAGEMENTEDITOR_API UEasyUserInterfaceReferenceAuditCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UEasyUserInterfaceReferenceAuditCommandlet();
+
+	//~UCommandlet interface
+	virtual int32 Main(const FString& Params) override;
+	//~End of UCommandlet interface
+};
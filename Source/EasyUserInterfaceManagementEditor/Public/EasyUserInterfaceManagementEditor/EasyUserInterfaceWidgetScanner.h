@@ -0,0 +1,73 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "GameplayTagContainer.h"
+#include "UObject/SoftObjectPath.h"
+
+class UCommonButtonClickActionBase;
+
+/** How a button action opens a widget. */
+enum class EEasyUserInterfaceOpenKind : uint8
+{
+	/** Push Widget, the widget is pushed to a stack layer */
+	Screen,
+	/** Push Question Prompt, the prompt is pushed to a stack layer */
+	Prompt,
+	/** Add Notification, the notification is added to the panel of its notification type */
+	Notification
+};
+
+/** A widget a button action of a widget class opens when clicked. */
+struct FEasyUserInterfaceOpenedWidget
+{
+	/** The opened widget class */
+	FSoftObjectPath WidgetClass;
+	/** The stack layer the widget is pushed to, or the notification type of a notification */
+	FGameplayTag LayerTag;
+	EEasyUserInterfaceOpenKind Kind = EEasyUserInterfaceOpenKind::Screen;
+
+	bool operator==(const FEasyUserInterfaceOpenedWidget& Other) const
+	{
+		return WidgetClass == Other.WidgetClass && LayerTag == Other.LayerTag && Kind == Other.Kind;
+	}
+};
+
+/**
+ * Finds the widget blueprints using the plugin widgets and what their buttons open, for the editor tools auditing
+ * the User Interface content.
+ */
+class EASYUSERINTERFACEMANAGEMENTEDITOR_API FEasyUserInterfaceWidgetScanner
+{
+public:
+	/**
+	 * Finds the widget blueprints using the plugin, without loading them: the ones whose native parent class is a plugin class,
+	 * the ones whose widget tree places a plugin widget (e.g. an Easy Common Button on a plain Common Activatable Widget) and
+	 * the ones placing or deriving from such a blueprint. The widget tree is known from the package dependencies of the Asset Registry.
+	 * @param ContentPath The content path to search in, recursively.
+	 * @return The blueprint assets.
+	 */
+	static TArray<FAssetData> FindWidgetBlueprints(const FString& ContentPath);
+
+	/** Loads the generated class of a widget blueprint found by FindWidgetBlueprints, null if it failed to load. */
+	static UClass* LoadWidgetClass(const FAssetData& BlueprintAsset);
+
+	/**
+	 * Collects the widgets opened by the button actions of a widget class: the Easy Common Buttons of its widget tree,
+	 * the ones of the user widgets it contains and the actions nested in Multiple actions.
+	 * @param WidgetClass The loaded widget class.
+	 * @param OutOpenedWidgets The opened widgets, without duplicates.
+	 */
+	static void CollectOpenedWidgets(const UClass& WidgetClass, TArray<FEasyUserInterfaceOpenedWidget>& OutOpenedWidgets);
+
+	/**
+	 * Collects the widgets a button action opens.
+	 * @param Action The button action, Multiple actions are followed.
+	 * @param OutOpenedWidgets The opened widgets, without duplicates.
+	 */
+	static void CollectOpenedWidgets(const UCommonButtonClickActionBase* Action, TArray<FEasyUserInterfaceOpenedWidget>& OutOpenedWidgets);
+
+	static const TCHAR* LexToString(EEasyUserInterfaceOpenKind Kind);
+};
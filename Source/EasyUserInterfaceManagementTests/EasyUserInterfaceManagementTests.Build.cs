@@ -0,0 +1,32 @@
+// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+using UnrealBuildTool;
+
+public class EasyUserInterfaceManagementTests : ModuleRules
+{
+	public EasyUserInterfaceManagementTests(ReadOnlyTargetRules Target) : base(Target)
+	{
+		PCHUsage = ModuleRules.PCHUsageMode.UseExplicitOrSharedPCHs;
+
+		PublicDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"Core",
+				"CoreUObject",
+				"Engine",
+				"GameplayTags",
+				"EasyUserInterfaceManagement"
+			}
+			);
+
+		PrivateDependencyModuleNames.AddRange(
+			new string[]
+			{
+				"AssetRegistry",
+				"CommonUI",
+				"Json",
+				"UMG"
+			}
+			);
+	}
+}
@@ -0,0 +1,20 @@
+// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#include "EasyUserInterfaceManagementTests.h"
+
+#define LOCTEXT_NAMESPACE "FEasyUserInterfaceManagementTestsModule"
+
+// Initialize Log Category for Easy User Interface Management tests
+DEFINE_LOG_CATEGORY(LogEasyUserInterfaceManagementTests);
+
+void FEasyUserInterfaceManagementTestsModule::StartupModule()
+{
+}
+
+void FEasyUserInterfaceManagementTestsModule::ShutdownModule()
+{
+}
+
+#undef LOCTEXT_NAMESPACE
+
+IMPLEMENT_MODULE(FEasyUserInterfaceManagementTestsModule, EasyUserInterfaceManagementTests)
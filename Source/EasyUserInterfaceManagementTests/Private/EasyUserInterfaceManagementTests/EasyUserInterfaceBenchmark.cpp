@@ -0,0 +1,718 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagementTests.h"
+#include "Components/Spacer.h"
+#include "Dom/JsonObject.h"
+#include "Engine/StreamableManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceJson.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSettings.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceStats.h"
+#include "EasyUserInterfaceManagementTests/EasyUserInterfaceBenchmarkListener.h"
+#include "EasyUserInterfaceManagementTests/EasyUserInterfaceBenchmarkWidget.h"
+#include "EasyUserInterfaceManagementTests/EasyUserInterfaceTestUtils.h"
+#include "ExtensionCommonUI/EasyUserInterfaceRootWidget.h"
+#include "ExtensionCommonUI/Foundation/EasyCommonButtonExtended.h"
+#include "ExtensionCommonUI/Notification/EasyNotificationWidget.h"
+#include "ExtensionCommonUI/PromptQuestion/EasyPromptQuestion.h"
+#include "ExtensionCommonUI/TabListSwitcher/EasyTabList.h"
+#include "Misc/App.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/Paths.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Widgets/CommonActivatableWidgetContainer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Benchmark of the User Interface Manager core operations with repeatable iteration counts:
+ * push/pop through the manager per stack layer, notifications through AddNotificationToPanel per panel (pool, throttle, backlog and timing wheel included),
+ * prompt push/resolve, tab registration at increasing tab counts and input binding registration.
+ * The classes are set in the "Benchmark" project settings, the benchmarks without a class are skipped.
+ *
+ * Runs in a game world of its own with the test root widget of the project settings, so it needs no map nor PIE session, e.g:
+ * -nullrhi -ExecCmds="Automation RunTests EasyUI.Benchmark; Quit" -EasyUIBenchmarkIterations=1000
+ * Results are written as JSON so CI can compare them against a baseline.
+ */
+namespace EasyUserInterfaceBenchmark
+{
+	/** Parameters of a benchmark run, parsed from the command line */
+	struct FParams
+	{
+		/** Iterations of the push/pop, notification and binding benchmarks ("-EasyUIBenchmarkIterations=") */
+		int32 Iterations = 1000;
+		/** Iterations of the prompt benchmark ("-EasyUIBenchmarkPromptIterations=") */
+		int32 PromptIterations = 200;
+		/** Number of tabs registered by each pass of the tab benchmark */
+		TArray<int32> TabCounts = { 10, 100, 1000 };
+		/** File the JSON results are written to ("-EasyUIBenchmarkOutput="), defaults to Saved/EasyUI/Benchmark.json */
+		FString OutputPath;
+		/** Only layer to benchmark ("-EasyUIBenchmarkLayer="), every registered layer otherwise */
+		FGameplayTag LayerTag;
+		/** Seconds to wait for the root widget, the classes and the pushes or the notifications of a layer before failing ("-EasyUIBenchmarkTimeout=") */
+		float Timeout = 30.0f;
+
+		static FParams FromCommandLine(const TCHAR* CommandLine)
+		{
+			FParams Params;
+			FParse::Value(CommandLine, TEXT("EasyUIBenchmarkIterations="), Params.Iterations);
+			FParse::Value(CommandLine, TEXT("EasyUIBenchmarkPromptIterations="), Params.PromptIterations);
+			FParse::Value(CommandLine, TEXT("EasyUIBenchmarkOutput="), Params.OutputPath);
+			FParse::Value(CommandLine, TEXT("EasyUIBenchmarkTimeout="), Params.Timeout);
+
+			FString LayerName;
+			if (FParse::Value(CommandLine, TEXT("EasyUIBenchmarkLayer="), LayerName))
+			{
+				Params.LayerTag = FGameplayTag::RequestGameplayTag(FName(*LayerName), false);
+			}
+
+			Params.Iterations = FMath::Max(1, Params.Iterations);
+			Params.PromptIterations = FMath::Max(1, Params.PromptIterations);
+			if (Params.OutputPath.IsEmpty())
+			{
+				Params.OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyUI"), TEXT("Benchmark.json"));
+			}
+			return Params;
+		}
+	};
+
+	/** State shared by the latent commands of a run */
+	struct FRun
+	{
+		FAutomationTestBase* Test = nullptr;
+		FParams Params;
+		TSharedRef<FEasyUserInterfaceTestWorld> TestWorld = MakeShared<FEasyUserInterfaceTestWorld>();
+		TWeakObjectPtr<UEasyUserInterfaceManager> Manager;
+		/** Keeps the benchmark classes loaded for the whole run */
+		TSharedPtr<FStreamableHandle> ClassesHandle;
+		TStrongObjectPtr<UEasyUserInterfaceBenchmarkListener> Listener;
+		TArray<TSharedPtr<FJsonValue>> Results;
+		double StartTime = 0.0;
+		/** Set when the run cannot go on, the remaining commands only write the results */
+		bool bAborted = false;
+	};
+
+	TSharedRef<FJsonObject> MakeResultObject(const FString& Name, const FString& Layer, int32 Iterations, double Seconds)
+	{
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		Result->SetStringField(TEXT("Name"), Name);
+		Result->SetStringField(TEXT("Layer"), Layer);
+		Result->SetNumberField(TEXT("Iterations"), Iterations);
+		Result->SetNumberField(TEXT("TotalMs"), Seconds * 1000.0);
+		Result->SetNumberField(TEXT("AvgUs"), Iterations > 0 ? Seconds * 1000000.0 / Iterations : 0.0);
+		Result->SetNumberField(TEXT("OpsPerSecond"), Seconds > 0.0 ? Iterations / Seconds : 0.0);
+		return Result;
+	}
+
+	TSharedPtr<FJsonValue> MakeResult(const FString& Name, const FString& Layer, int32 Iterations, double Seconds)
+	{
+		return MakeShared<FJsonValueObject>(MakeResultObject(Name, Layer, Iterations, Seconds));
+	}
+
+	/** A benchmark that could not run, failed ones fail the test */
+	TSharedPtr<FJsonValue> MakeSkippedResult(const FString& Name, const FString& Reason, bool bIsFailure)
+	{
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		Result->SetStringField(TEXT("Name"), Name);
+		Result->SetBoolField(TEXT("Skipped"), true);
+		Result->SetBoolField(TEXT("Failed"), bIsFailure);
+		Result->SetStringField(TEXT("Reason"), Reason);
+		return MakeShared<FJsonValueObject>(Result);
+	}
+
+	/** Latency of the manager phases of an operation, as recorded by the manager over its recent samples */
+	TSharedPtr<FJsonValue> MakeLatencyResult(const FString& Name, const FString& Layer, EEasyUserInterfaceOperation Operation)
+	{
+		TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+		Result->SetStringField(TEXT("Name"), Name);
+		Result->SetStringField(TEXT("Layer"), Layer);
+		Result->SetNumberField(TEXT("Samples"), FEasyUserInterfaceStats::GetLatencySummary(Operation, EEasyUserInterfaceLatencyPhase::Total).NumSamples);
+		for (const EEasyUserInterfaceLatencyPhase Phase : { EEasyUserInterfaceLatencyPhase::Construct, EEasyUserInterfaceLatencyPhase::Activate })
+		{
+			const FEasyUserInterfaceLatencySummary Summary = FEasyUserInterfaceStats::GetLatencySummary(Operation, Phase);
+			const FString PhaseName = FEasyUserInterfaceStats::LexToString(Phase);
+			Result->SetNumberField(PhaseName + TEXT("AvgMs"), Summary.Avg);
+			Result->SetNumberField(PhaseName + TEXT("P95Ms"), Summary.P95);
+			Result->SetNumberField(PhaseName + TEXT("MaxMs"), Summary.Max);
+		}
+		return MakeShared<FJsonValueObject>(Result);
+	}
+
+	void BenchmarkPrompts(FRun& Run, UEasyUserInterfaceManager& Manager, UEasyUserInterfaceRootWidget& RootWidget)
+	{
+		const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+		if (Settings->BenchmarkPromptClass.IsNull())
+		{
+			Run.Results.Add(MakeSkippedResult(TEXT("Prompt"), TEXT("No benchmark prompt class set in the project settings."), false));
+			return;
+		}
+
+		const TSubclassOf<UEasyPromptQuestion> PromptClass = Settings->BenchmarkPromptClass.Get();
+		const TArray<FGameplayTag> StackLayers = FEasyUserInterfaceTestUtils::SortLayers(RootWidget.GetRegisteredStackLayers(), Run.Params.LayerTag);
+		if (!PromptClass || StackLayers.IsEmpty())
+		{
+			Run.Results.Add(MakeSkippedResult(TEXT("Prompt"), TEXT("Benchmark prompt class failed to load or no widget stack registered."), true));
+			return;
+		}
+
+		const FGameplayTag& LayerTag = StackLayers[0];
+		FPromptQuestionBodyInfo QuestionBodyInfo;
+		QuestionBodyInfo.QuestionHeaderText = FText::FromString(TEXT("Benchmark"));
+		QuestionBodyInfo.QuestionBodyText = FText::FromString(TEXT("Benchmark prompt"));
+
+		double PushSeconds = 0.0;
+		double ResolveSeconds = 0.0;
+		for (int32 Iteration = 0; Iteration < Run.Params.PromptIterations; ++Iteration)
+		{
+			double StartTime = FPlatformTime::Seconds();
+			UEasyPromptQuestion* PromptWidget = Manager.PushQuestionPromptToLayer(PromptClass, LayerTag, QuestionBodyInfo, FPromtResultEventDelegate());
+			PushSeconds += FPlatformTime::Seconds() - StartTime;
+
+			if (!PromptWidget)
+			{
+				Run.Results.Add(MakeSkippedResult(TEXT("Prompt"), TEXT("Failed to push the prompt."), true));
+				return;
+			}
+
+			StartTime = FPlatformTime::Seconds();
+			PromptWidget->AnswerPrompt(false);
+			ResolveSeconds += FPlatformTime::Seconds() - StartTime;
+		}
+
+		Run.Results.Add(MakeResult(TEXT("PushPrompt"), LayerTag.ToString(), Run.Params.PromptIterations, PushSeconds));
+		Run.Results.Add(MakeResult(TEXT("ResolvePrompt"), LayerTag.ToString(), Run.Params.PromptIterations, ResolveSeconds));
+	}
+
+	void BenchmarkTabRegistration(FRun& Run, UEasyUserInterfaceManager& Manager)
+	{
+		const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+		if (Settings->BenchmarkTabButtonClass.IsNull())
+		{
+			Run.Results.Add(MakeSkippedResult(TEXT("RegisterTab"), TEXT("No benchmark tab button class set in the project settings."), false));
+			return;
+		}
+
+		const TSubclassOf<UEasyCommonButtonExtended> TabButtonClass = Settings->BenchmarkTabButtonClass.Get();
+		UEasyTabList* TabList = CreateWidget<UEasyTabList>(FEasyUserInterfaceTestUtils::GetPlayerController(Manager), UEasyTabList::StaticClass());
+		if (!TabList || !TabButtonClass)
+		{
+			Run.Results.Add(MakeSkippedResult(TEXT("RegisterTab"), TEXT("Failed to create the tab list or to load the tab button class."), true));
+			return;
+		}
+		TabList->SetTabButtonClass(TabButtonClass);
+
+		for (const int32 TabCount : Run.Params.TabCounts)
+		{
+			// Tab contents are created up front, only the registration is measured
+			TArray<UWidget*> TabContents;
+			TabContents.Reserve(TabCount);
+			for (int32 TabIndex = 0; TabIndex < TabCount; ++TabIndex)
+			{
+				TabContents.Add(NewObject<USpacer>(TabList));
+			}
+
+			FCommonTabListExtendedTabButtonInfo TabButtonInfo;
+			double StartTime = FPlatformTime::Seconds();
+			for (int32 TabIndex = 0; TabIndex < TabCount; ++TabIndex)
+			{
+				TabButtonInfo.TabNameID = FName(TEXT("BenchmarkTab"), TabIndex + 1);
+				TabList->RegisterTabDynamic(TabContents[TabIndex], TabIndex, TabButtonInfo);
+			}
+			const double RegisterSeconds = FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			TabList->RemoveAllTabs();
+			const double RemoveSeconds = FPlatformTime::Seconds() - StartTime;
+
+			const FString TabCountName = FString::Printf(TEXT("%d Tabs"), TabCount);
+			Run.Results.Add(MakeResult(TEXT("RegisterTab"), TabCountName, TabCount, RegisterSeconds));
+			Run.Results.Add(MakeResult(TEXT("RemoveAllTabs"), TabCountName, TabCount, RemoveSeconds));
+		}
+	}
+
+	void BenchmarkBindingRegistration(FRun& Run, UEasyUserInterfaceManager& Manager)
+	{
+		const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+		if (Settings->BenchmarkInputAction.IsNull())
+		{
+			Run.Results.Add(MakeSkippedResult(TEXT("RegisterBinding"), TEXT("No benchmark input action set in the project settings."), false));
+			return;
+		}
+
+		UEasyUserInterfaceBenchmarkWidget* Widget = CreateWidget<UEasyUserInterfaceBenchmarkWidget>(FEasyUserInterfaceTestUtils::GetPlayerController(Manager), UEasyUserInterfaceBenchmarkWidget::StaticClass());
+		if (!Widget)
+		{
+			Run.Results.Add(MakeSkippedResult(TEXT("RegisterBinding"), TEXT("Failed to create the widget."), true));
+			return;
+		}
+
+		FUserInterfaceInputActionToRegister InputAction;
+		InputAction.InputAction = Settings->BenchmarkInputAction;
+		InputAction.bDisplayInActionBarByDefault = false;
+		const FInputActionExecutedDelegate Callback;
+
+		double StartTime = FPlatformTime::Seconds();
+		for (int32 Iteration = 0; Iteration < Run.Params.Iterations; ++Iteration)
+		{
+			Widget->RegisterBenchmarkBinding(InputAction, Callback);
+		}
+		const double RegisterSeconds = FPlatformTime::Seconds() - StartTime;
+
+		StartTime = FPlatformTime::Seconds();
+		Widget->UnregisterBenchmarkBindings();
+		const double UnregisterSeconds = FPlatformTime::Seconds() - StartTime;
+
+		Run.Results.Add(MakeResult(TEXT("RegisterBinding"), FString(), Run.Params.Iterations, RegisterSeconds));
+		Run.Results.Add(MakeResult(TEXT("UnregisterAllBindings"), FString(), Run.Params.Iterations, UnregisterSeconds));
+	}
+
+	/** Runs the benchmarks that complete within a frame */
+	class FRunFrameBenchmarksCommand : public IAutomationLatentCommand
+	{
+	public:
+		explicit FRunFrameBenchmarksCommand(const TSharedRef<FRun>& InRun) : Run(InRun) {}
+
+		virtual bool Update() override
+		{
+			UEasyUserInterfaceManager* Manager = Run->Manager.Get();
+			UEasyUserInterfaceRootWidget* RootWidget = Manager ? Manager->GetRootWidget() : nullptr;
+			if (Run->bAborted || !RootWidget)
+			{
+				return true;
+			}
+
+			UE_LOG(LogEasyUserInterfaceManagementTests, Display, TEXT("Running benchmark with %d iterations."), Run->Params.Iterations);
+
+			BenchmarkPrompts(*Run, *Manager, *RootWidget);
+			BenchmarkTabRegistration(*Run, *Manager);
+			BenchmarkBindingRegistration(*Run, *Manager);
+			return true;
+		}
+
+	private:
+		TSharedRef<FRun> Run;
+	};
+
+	/**
+	 * Pushes the benchmark widget on each stack layer through PushWidgetToStackAsync, then pops them through PopWidgetFromStack.
+	 * The manager skips a push of a class already loading on the layer, so the next push is requested once the previous one is
+	 * on the stack, a frame later as the streamable manager completes loaded classes on its next tick.
+	 * The requests and the pops are timed, the construction and the activation are reported from the latencies the manager records.
+	 */
+	class FBenchmarkPushPopCommand : public IAutomationLatentCommand
+	{
+	public:
+		explicit FBenchmarkPushPopCommand(const TSharedRef<FRun>& InRun) : Run(InRun) {}
+
+		virtual bool Update() override
+		{
+			UEasyUserInterfaceManager* Manager = Run->Manager.Get();
+			UEasyUserInterfaceRootWidget* RootWidget = Manager ? Manager->GetRootWidget() : nullptr;
+			if (Run->bAborted || !RootWidget)
+			{
+				return true;
+			}
+
+			if (!bStarted)
+			{
+				bStarted = true;
+				if (!Start(*RootWidget))
+				{
+					return true;
+				}
+				StartLayer(*Manager);
+			}
+			return PushNext(*Manager);
+		}
+
+	private:
+		bool Start(const UEasyUserInterfaceRootWidget& RootWidget)
+		{
+			const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+			if (Settings->BenchmarkWidgetClass.IsNull())
+			{
+				Run->Results.Add(MakeSkippedResult(TEXT("PushPop"), TEXT("No benchmark widget class set in the project settings."), false));
+				return false;
+			}
+
+			if (!Settings->BenchmarkWidgetClass.Get())
+			{
+				Run->Results.Add(MakeSkippedResult(TEXT("PushPop"), TEXT("Benchmark widget class failed to load."), true));
+				return false;
+			}
+
+			Layers = FEasyUserInterfaceTestUtils::SortLayers(RootWidget.GetRegisteredStackLayers(), Run->Params.LayerTag);
+			if (Layers.IsEmpty())
+			{
+				Run->Results.Add(MakeSkippedResult(TEXT("PushPop"), TEXT("No widget stack registered."), true));
+				return false;
+			}
+
+			Run->Listener.Reset(NewObject<UEasyUserInterfaceBenchmarkListener>());
+			OnWidgetAdded.BindUFunction(Run->Listener.Get(), GET_FUNCTION_NAME_CHECKED(UEasyUserInterfaceBenchmarkListener, HandleWidgetAdded));
+			return true;
+		}
+
+		void StartLayer(const UEasyUserInterfaceManager& Manager)
+		{
+			// The latencies of the layer are read back from the manager once every widget is pushed
+			FEasyUserInterfaceStats::Reset();
+			Run->Listener->Reset();
+			NumRequested = 0;
+			RequestSeconds = 0.0;
+			NumWidgetsBefore = GetNumWidgets(Manager, Layers[LayerIndex]);
+			LayerStartTime = FPlatformTime::Seconds();
+		}
+
+		/** Counted on the stack itself, the cached layer state only follows the displayed widget */
+		static int32 GetNumWidgets(const UEasyUserInterfaceManager& Manager, const FGameplayTag& LayerTag)
+		{
+			const UCommonActivatableWidgetStack* Stack = Manager.FindWidgetStack(LayerTag);
+			return Stack ? Stack->GetNumWidgets() : 0;
+		}
+
+		/** Requests the next push once the previous one is on the stack, pops every pushed widget once all are pushed */
+		bool PushNext(UEasyUserInterfaceManager& Manager)
+		{
+			const FGameplayTag& LayerTag = Layers[LayerIndex];
+			const bool bTimedOut = FPlatformTime::Seconds() - LayerStartTime > Run->Params.Timeout;
+			if (Run->Listener->GetNumWidgetCallbacks() < NumRequested && !bTimedOut)
+			{
+				return false;
+			}
+
+			if (NumRequested < Run->Params.Iterations && !bTimedOut)
+			{
+				const double StartTime = FPlatformTime::Seconds();
+				const bool bIsRequested = Manager.PushWidgetToStackAsync(LayerTag, UEasyUserInterfaceSettings::Get()->BenchmarkWidgetClass, OnWidgetAdded);
+				RequestSeconds += FPlatformTime::Seconds() - StartTime;
+				if (bIsRequested)
+				{
+					++NumRequested;
+					return false;
+				}
+			}
+
+			const int32 NumPushed = GetNumWidgets(Manager, LayerTag) - NumWidgetsBefore;
+			if (NumPushed < Run->Params.Iterations)
+			{
+				Run->Results.Add(MakeSkippedResult(TEXT("PushPop"), FString::Printf(TEXT("Only %d of %d widget(s) pushed on layer %s."),
+					NumPushed, Run->Params.Iterations, *LayerTag.ToString()), true));
+			}
+			else
+			{
+				Run->Results.Add(MakeResult(TEXT("PushWidgetRequest"), LayerTag.ToString(), NumRequested, RequestSeconds));
+				Run->Results.Add(MakeLatencyResult(TEXT("PushWidget"), LayerTag.ToString(), EEasyUserInterfaceOperation::PushWidget));
+			}
+
+			const double StartTime = FPlatformTime::Seconds();
+			int32 NumPopped = 0;
+			while (NumPopped < NumPushed && Manager.PopWidgetFromStack(LayerTag))
+			{
+				++NumPopped;
+			}
+			const double PopSeconds = FPlatformTime::Seconds() - StartTime;
+			Run->Results.Add(MakeResult(TEXT("PopWidget"), LayerTag.ToString(), NumPopped, PopSeconds));
+
+			++LayerIndex;
+			if (!Layers.IsValidIndex(LayerIndex))
+			{
+				return true;
+			}
+			StartLayer(Manager);
+			return false;
+		}
+
+		TSharedRef<FRun> Run;
+		bool bStarted = false;
+		TArray<FGameplayTag> Layers;
+		int32 LayerIndex = 0;
+		FOnWidgetUpdatedOnStack OnWidgetAdded;
+		int32 NumRequested = 0;
+		int32 NumWidgetsBefore = 0;
+		double RequestSeconds = 0.0;
+		double LayerStartTime = 0.0;
+	};
+
+	/**
+	 * Adds the notifications of each panel through AddNotificationToPanel and waits for their OnNotificationAdded callbacks,
+	 * so the class load, the pool, the throttle, the backlog and the timing wheel are all part of the measure.
+	 * Each notification has its own body so none is coalesced, the overflow of the rate limit is reported.
+	 */
+	class FBenchmarkNotificationsCommand : public IAutomationLatentCommand
+	{
+	public:
+		explicit FBenchmarkNotificationsCommand(const TSharedRef<FRun>& InRun) : Run(InRun) {}
+
+		virtual bool Update() override
+		{
+			UEasyUserInterfaceManager* Manager = Run->Manager.Get();
+			UEasyUserInterfaceRootWidget* RootWidget = Manager ? Manager->GetRootWidget() : nullptr;
+			if (Run->bAborted || !RootWidget)
+			{
+				return true;
+			}
+
+			switch (Step)
+			{
+			case EStep::Start:
+				return Start(*RootWidget);
+			case EStep::Submit:
+				Submit(*Manager);
+				return false;
+			case EStep::WaitForShown:
+				WaitForShown(*Manager);
+				return false;
+			case EStep::Drain:
+				return Drain(*Manager);
+			default:
+				return true;
+			}
+		}
+
+	private:
+		enum class EStep : uint8
+		{
+			Start,
+			Submit,
+			WaitForShown,
+			Drain
+		};
+
+		bool Start(UEasyUserInterfaceRootWidget& RootWidget)
+		{
+			const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+			if (Settings->BenchmarkNotificationClass.IsNull())
+			{
+				Run->Results.Add(MakeSkippedResult(TEXT("Notification"), TEXT("No benchmark notification class set in the project settings."), false));
+				return true;
+			}
+
+			if (!Settings->BenchmarkNotificationClass.Get())
+			{
+				Run->Results.Add(MakeSkippedResult(TEXT("Notification"), TEXT("Benchmark notification class failed to load."), true));
+				return true;
+			}
+
+			Layers = FEasyUserInterfaceTestUtils::SortLayers(RootWidget.GetRegisteredNotificationLayers(), Run->Params.LayerTag);
+			if (Layers.IsEmpty())
+			{
+				Run->Results.Add(MakeSkippedResult(TEXT("Notification"), TEXT("No notification panel registered."), true));
+				return true;
+			}
+
+			// Built up front, only the requests are measured
+			NotificationInfos.Reserve(Run->Params.Iterations);
+			for (int32 Iteration = 0; Iteration < Run->Params.Iterations; ++Iteration)
+			{
+				FEasyNotificationWidgetInfo NotificationInfo;
+				NotificationInfo.NotificationHeader = FText::FromString(TEXT("Benchmark"));
+				NotificationInfo.NotificationBody = FText::AsNumber(Iteration);
+				// Scheduled on the timing wheel, dismissed by the benchmark itself
+				NotificationInfo.NotificationDuration = Run->Params.Timeout * 2.0f;
+				NotificationInfos.Add(MakeShared<const FEasyNotificationWidgetInfo>(MoveTemp(NotificationInfo)));
+			}
+
+			Run->Listener.Reset(NewObject<UEasyUserInterfaceBenchmarkListener>());
+			Step = EStep::Submit;
+			return false;
+		}
+
+		void Submit(UEasyUserInterfaceManager& Manager)
+		{
+			const FGameplayTag& LayerTag = Layers[LayerIndex];
+			const TSoftClassPtr<UEasyNotificationWidget> NotificationClass = UEasyUserInterfaceSettings::Get()->BenchmarkNotificationClass;
+
+			FOnNotificationAddedToPanel OnNotificationAdded;
+			OnNotificationAdded.BindUFunction(Run->Listener.Get(), GET_FUNCTION_NAME_CHECKED(UEasyUserInterfaceBenchmarkListener, HandleNotificationAdded));
+			Run->Listener->Reset();
+
+			NumCoalesced = Manager.GetNotificationThrottle().GetNumCoalesced();
+			NumRateLimited = Manager.GetNotificationThrottle().GetNumRateLimited();
+			NumDropped = Manager.GetNotificationBacklog().GetNumEvicted() + Manager.GetNotificationBacklog().GetNumExpired();
+			NumAccepted = 0;
+			NumDismissed = 0;
+
+			LayerStartTime = FPlatformTime::Seconds();
+			for (const FEasyNotificationWidgetInfoRef& NotificationInfo : NotificationInfos)
+			{
+				NumAccepted += Manager.AddNotificationToPanel(LayerTag, NotificationClass, NotificationInfo, OnNotificationAdded) ? 1 : 0;
+			}
+			const double SubmitSeconds = FPlatformTime::Seconds() - LayerStartTime;
+
+			Run->Results.Add(MakeResult(TEXT("AddNotificationToPanel"), LayerTag.ToString(), NotificationInfos.Num(), SubmitSeconds));
+			Step = EStep::WaitForShown;
+		}
+
+		void WaitForShown(UEasyUserInterfaceManager& Manager)
+		{
+			const FGameplayTag& LayerTag = Layers[LayerIndex];
+			const FEasyUserInterfaceNotificationBacklog& Backlog = Manager.GetNotificationBacklog();
+			const int32 NumQueued = Backlog.GetNumQueued(LayerTag);
+			const int32 NumLayerDropped = Backlog.GetNumEvicted() + Backlog.GetNumExpired() - NumDropped;
+			const bool bTimedOut = FPlatformTime::Seconds() - LayerStartTime > Run->Params.Timeout;
+			if (Run->Listener->GetNumCallbacks() + NumQueued + NumLayerDropped < NumAccepted && !bTimedOut)
+			{
+				return;
+			}
+
+			const int32 NumCallbacks = Run->Listener->GetNumCallbacks();
+			const double ShowSeconds = NumCallbacks > 0 ? Run->Listener->GetLastCallbackTime() - LayerStartTime : 0.0;
+			TSharedRef<FJsonObject> ShowResult = MakeResultObject(TEXT("ShowNotification"), LayerTag.ToString(), NumCallbacks, ShowSeconds);
+			ShowResult->SetNumberField(TEXT("Requested"), NotificationInfos.Num());
+			ShowResult->SetNumberField(TEXT("Shown"), Run->Listener->GetNotifications().Num());
+			ShowResult->SetNumberField(TEXT("Coalesced"), Manager.GetNotificationThrottle().GetNumCoalesced() - NumCoalesced);
+			ShowResult->SetNumberField(TEXT("RateLimited"), Manager.GetNotificationThrottle().GetNumRateLimited() - NumRateLimited);
+			ShowResult->SetNumberField(TEXT("Queued"), NumQueued);
+			ShowResult->SetNumberField(TEXT("Dropped"), NumLayerDropped);
+			ShowResult->SetNumberField(TEXT("Scheduled"), Manager.GetNotificationTimingWheel().GetNumScheduled());
+			ShowResult->SetBoolField(TEXT("TimedOut"), bTimedOut);
+			Run->Results.Add(MakeShared<FJsonValueObject>(ShowResult));
+
+			const int32 NumShown = Run->Listener->GetNotifications().Num();
+			const double StartTime = FPlatformTime::Seconds();
+			DismissShownNotifications();
+			Run->Results.Add(MakeResult(TEXT("DismissNotification"), LayerTag.ToString(), NumShown, FPlatformTime::Seconds() - StartTime));
+
+			Step = EStep::Drain;
+		}
+
+		/** Dismisses the queued notifications as the backlog shows them, then moves to the next layer */
+		bool Drain(UEasyUserInterfaceManager& Manager)
+		{
+			DismissShownNotifications();
+
+			const bool bTimedOut = FPlatformTime::Seconds() - LayerStartTime > Run->Params.Timeout * 2.0f;
+			if (Manager.GetNotificationBacklog().GetNumQueued(Layers[LayerIndex]) > 0 && !bTimedOut)
+			{
+				return false;
+			}
+
+			// Notifications that are not auto dismissed are left to their panel otherwise
+			for (UEasyNotificationWidget* NotificationWidget : Run->Listener->GetNotifications())
+			{
+				if (NotificationWidget)
+				{
+					NotificationWidget->RemoveFromParent();
+				}
+			}
+
+			++LayerIndex;
+			Step = EStep::Submit;
+			return !Layers.IsValidIndex(LayerIndex);
+		}
+
+		void DismissShownNotifications()
+		{
+			const TArray<TObjectPtr<UEasyNotificationWidget>>& Notifications = Run->Listener->GetNotifications();
+			for (; NumDismissed < Notifications.Num(); ++NumDismissed)
+			{
+				if (Notifications[NumDismissed])
+				{
+					Notifications[NumDismissed]->DismissNotification();
+				}
+			}
+		}
+
+		TSharedRef<FRun> Run;
+		EStep Step = EStep::Start;
+		TArray<FGameplayTag> Layers;
+		int32 LayerIndex = 0;
+		TArray<FEasyNotificationWidgetInfoRef> NotificationInfos;
+		double LayerStartTime = 0.0;
+		int32 NumAccepted = 0;
+		int32 NumDismissed = 0;
+		int32 NumCoalesced = 0;
+		int32 NumRateLimited = 0;
+		int32 NumDropped = 0;
+	};
+
+	/** Writes the results and fails the test for every benchmark that could not run */
+	class FWriteResultsCommand : public IAutomationLatentCommand
+	{
+	public:
+		explicit FWriteResultsCommand(const TSharedRef<FRun>& InRun) : Run(InRun) {}
+
+		virtual bool Update() override
+		{
+			int32 NumFailures = 0;
+			for (const TSharedPtr<FJsonValue>& BenchmarkResult : Run->Results)
+			{
+				const TSharedPtr<FJsonObject> ResultObject = BenchmarkResult->AsObject();
+				bool bHasFailed = false;
+				if (ResultObject->TryGetBoolField(TEXT("Failed"), bHasFailed) && bHasFailed)
+				{
+					++NumFailures;
+					Run->Test->AddError(FString::Printf(TEXT("Benchmark %s failed: %s"), *ResultObject->GetStringField(TEXT("Name")), *ResultObject->GetStringField(TEXT("Reason"))));
+				}
+			}
+
+			TSharedRef<FJsonObject> Results = MakeShared<FJsonObject>();
+			Results->SetStringField(TEXT("EngineVersion"), FEngineVersion::Current().ToString());
+			Results->SetStringField(TEXT("Platform"), FPlatformProperties::IniPlatformName());
+			Results->SetStringField(TEXT("BuildConfiguration"), LexToString(FApp::GetBuildConfiguration()));
+			Results->SetStringField(TEXT("Timestamp"), FDateTime::UtcNow().ToIso8601());
+			Results->SetNumberField(TEXT("Iterations"), Run->Params.Iterations);
+			Results->SetNumberField(TEXT("Failures"), NumFailures);
+			Results->SetArrayField(TEXT("Results"), Run->Results);
+
+			if (!FEasyUserInterfaceJson::WriteToFile(Results, Run->Params.OutputPath))
+			{
+				Run->Test->AddError(FString::Printf(TEXT("Could not write the benchmark results to %s"), *Run->Params.OutputPath));
+			}
+
+			UE_LOG(LogEasyUserInterfaceManagementTests, Display, TEXT("Benchmark finished with %d failure(s) in %.2fs, results: %s"),
+				NumFailures, FPlatformTime::Seconds() - Run->StartTime, *Run->Params.OutputPath);
+
+			Run->Listener.Reset();
+			Run->ClassesHandle.Reset();
+			return true;
+		}
+
+	private:
+		TSharedRef<FRun> Run;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyUserInterfaceBenchmarkTest, "EasyUI.Benchmark",
+	EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FEasyUserInterfaceBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace EasyUserInterfaceBenchmark;
+
+	const TSharedRef<FRun> Run = MakeShared<FRun>();
+	Run->Test = this;
+	Run->Params = FParams::FromCommandLine(FCommandLine::Get());
+	Run->StartTime = FPlatformTime::Seconds();
+
+	ADD_LATENT_AUTOMATION_COMMAND(FEasyUICreateTestWorldCommand(Run->TestWorld, Run->Params.Timeout, [Run](UEasyUserInterfaceManager* Manager)
+	{
+		Run->Manager = Manager;
+		if (!Manager)
+		{
+			Run->Results.Add(MakeSkippedResult(TEXT("Benchmark"), TEXT("The test world could not be created or its root widget was not in the viewport in time."), true));
+			Run->bAborted = true;
+		}
+	}));
+
+	// Classes that did not load are reported by their benchmark
+	const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+	TArray<FSoftObjectPath> ClassPaths = { Settings->BenchmarkWidgetClass.ToSoftObjectPath(), Settings->BenchmarkNotificationClass.ToSoftObjectPath(),
+		Settings->BenchmarkPromptClass.ToSoftObjectPath(), Settings->BenchmarkTabButtonClass.ToSoftObjectPath() };
+	ADD_LATENT_AUTOMATION_COMMAND(FEasyUIWaitForLoadCommand(MoveTemp(ClassPaths), Run->Params.Timeout, [Run](TSharedPtr<FStreamableHandle> Handle)
+	{
+		Run->ClassesHandle = MoveTemp(Handle);
+	}));
+	ADD_LATENT_AUTOMATION_COMMAND(FBenchmarkPushPopCommand(Run));
+	ADD_LATENT_AUTOMATION_COMMAND(FRunFrameBenchmarksCommand(Run));
+	ADD_LATENT_AUTOMATION_COMMAND(FBenchmarkNotificationsCommand(Run));
+	ADD_LATENT_AUTOMATION_COMMAND(FWriteResultsCommand(Run));
+	ADD_LATENT_AUTOMATION_COMMAND(FEasyUIDestroyTestWorldCommand(Run->TestWorld));
+	return true;
+}
+
+#endif
@@ -0,0 +1,29 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagementTests/EasyUserInterfaceBenchmarkListener.h"
+
+#include "ExtensionCommonUI/Notification/EasyNotificationWidget.h"
+
+void UEasyUserInterfaceBenchmarkListener::HandleWidgetAdded(FGameplayTag LayerTag, UCommonActivatableWidget* Widget)
+{
+	++NumWidgetCallbacks;
+}
+
+void UEasyUserInterfaceBenchmarkListener::HandleNotificationAdded(FGameplayTag LayerTag, UEasyNotificationWidget* NotificationWidget)
+{
+	++NumCallbacks;
+	LastCallbackTime = FPlatformTime::Seconds();
+	if (NotificationWidget)
+	{
+		Notifications.AddUnique(NotificationWidget);
+	}
+}
+
+void UEasyUserInterfaceBenchmarkListener::Reset()
+{
+	Notifications.Reset();
+	NumWidgetCallbacks = 0;
+	NumCallbacks = 0;
+	LastCallbackTime = 0.0;
+}
@@ -0,0 +1,415 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagementTests.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Components/Widget.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Blueprint.h"
+#include "Engine/StreamableManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceJson.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceStats.h"
+#include "EasyUserInterfaceManagementTests/EasyUserInterfaceTestUtils.h"
+#include "ExtensionCommonUI/EasyUserInterfaceRootWidget.h"
+#include "ExtensionCommonUI/ActivatableWidget/EasyActivatableWidgetBase.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectHash.h"
+#include "Widgets/CommonActivatableWidgetContainer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Pushes every Easy Activatable Widget Base screen found in the Asset Registry through the manager, one test per screen, and checks
+ * the measured construction time, widget count, binding count and time to interactive against the budget of its class.
+ *
+ * Each screen runs in a game world of its own with the test root widget of the project settings, so no map nor PIE session is needed, e.g:
+ * -nullrhi -ExecCmds="Automation RunTests EasyUI.BudgetAudit; Quit" -EasyUIBudgetAuditPath=/Game/UI
+ * A screen over its budget fails its test, so CI can fail the build. The measures of each screen are also written as JSON.
+ */
+namespace EasyUserInterfaceBudgetAudit
+{
+	/** Parameters of the audit, parsed from the command line */
+	struct FParams
+	{
+		/** Content path the screens are searched in ("-EasyUIBudgetAuditPath="), recursively */
+		FString ContentPath = TEXT("/Game");
+		/** Stack layer the screens are pushed to ("-EasyUIBudgetAuditLayer="), the first registered stack layer by name if not set */
+		FGameplayTag LayerTag;
+		/** Directory the JSON results of each screen are written to ("-EasyUIBudgetAuditOutput="), defaults to Saved/EasyUI/BudgetAudit */
+		FString OutputDirectory;
+		/** Seconds to wait for the root widget and the screen class before failing ("-EasyUIBudgetAuditTimeout=") */
+		float Timeout = 30.0f;
+		/** Frames a screen has to become interactive before it fails ("-EasyUIBudgetAuditMaxFrames=") */
+		int32 MaxFramesPerScreen = 300;
+
+		static FParams FromCommandLine(const TCHAR* CommandLine)
+		{
+			FParams Params;
+			FParse::Value(CommandLine, TEXT("EasyUIBudgetAuditPath="), Params.ContentPath);
+			FParse::Value(CommandLine, TEXT("EasyUIBudgetAuditOutput="), Params.OutputDirectory);
+			FParse::Value(CommandLine, TEXT("EasyUIBudgetAuditTimeout="), Params.Timeout);
+			FParse::Value(CommandLine, TEXT("EasyUIBudgetAuditMaxFrames="), Params.MaxFramesPerScreen);
+
+			FString LayerName;
+			if (FParse::Value(CommandLine, TEXT("EasyUIBudgetAuditLayer="), LayerName))
+			{
+				Params.LayerTag = FGameplayTag::RequestGameplayTag(FName(*LayerName), false);
+			}
+
+			Params.MaxFramesPerScreen = FMath::Max(1, Params.MaxFramesPerScreen);
+			if (Params.OutputDirectory.IsEmpty())
+			{
+				Params.OutputDirectory = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyUI"), TEXT("BudgetAudit"));
+			}
+			return Params;
+		}
+	};
+
+	/**
+	 * Finds the screens to audit without loading them, the native parent of the widget blueprints is read from their tags.
+	 * @param ContentPath The content path to search in, recursively.
+	 * @param OutNames The names of the screens.
+	 * @param OutClassPaths The generated class paths of the screens.
+	 */
+	void FindScreens(const FString& ContentPath, TArray<FString>& OutNames, TArray<FString>& OutClassPaths)
+	{
+		IAssetRegistry& AssetRegistry = FAssetRegistryModule::GetRegistry();
+		AssetRegistry.WaitForCompletion();
+
+		TArray<FAssetData> Assets;
+		AssetRegistry.GetAssetsByPaths({ FName(*ContentPath) }, Assets, true);
+		Assets.Sort([](const FAssetData& Asset, const FAssetData& OtherAsset) { return Asset.PackageName.LexicalLess(OtherAsset.PackageName); });
+
+		for (const FAssetData& Asset : Assets)
+		{
+			const FString NativeParentPath = Asset.GetTagValueRef<FString>(FBlueprintTags::NativeParentClassPath);
+			const UClass* NativeParent = NativeParentPath.IsEmpty() ? nullptr : FindObject<UClass>(nullptr, *FPackageName::ExportTextPathToObjectPath(NativeParentPath));
+			const FString GeneratedClassPath = Asset.GetTagValueRef<FString>(FBlueprintTags::GeneratedClassPath);
+			if (NativeParent && NativeParent->IsChildOf<UEasyActivatableWidgetBase>() && !GeneratedClassPath.IsEmpty())
+			{
+				OutNames.Add(Asset.AssetName.ToString());
+				OutClassPaths.Add(FPackageName::ExportTextPathToObjectPath(GeneratedClassPath));
+			}
+		}
+	}
+
+	/** State shared by the latent commands of a screen */
+	struct FScreenAudit
+	{
+		FAutomationTestBase* Test = nullptr;
+		FParams Params;
+		FSoftObjectPath ClassPath;
+		TSharedRef<FEasyUserInterfaceTestWorld> TestWorld = MakeShared<FEasyUserInterfaceTestWorld>();
+		TWeakObjectPtr<UEasyUserInterfaceManager> Manager;
+		/** Keeps the screen class loaded until it is audited */
+		TSharedPtr<FStreamableHandle> ClassHandle;
+
+		/** Measures of the screen */
+		double ConstructMs = 0.0;
+		double TimeToInteractiveMs = 0.0;
+		int32 WidgetCount = 0;
+		int32 NumBindings = 0;
+		FString Error;
+	};
+
+	int32 CountWidgets(const UUserWidget& Widget)
+	{
+		// Nested user widgets are outered to the widget tree of their parent, so the recursive search counts them too
+		TArray<UObject*> Objects;
+		GetObjectsWithOuter(&Widget, Objects, true);
+
+		int32 NumWidgets = 0;
+		for (const UObject* Object : Objects)
+		{
+			NumWidgets += Object->IsA<UWidget>() ? 1 : 0;
+		}
+		return NumWidgets;
+	}
+
+	/** Compares a measure to its budget, a zero budget is not checked */
+	void CheckBudget(TArray<TSharedPtr<FJsonValue>>& OutViolations, const TCHAR* Name, double Measured, double Budget)
+	{
+		if (Budget > 0.0 && Measured > Budget)
+		{
+			TSharedRef<FJsonObject> Violation = MakeShared<FJsonObject>();
+			Violation->SetStringField(TEXT("Budget"), Name);
+			Violation->SetNumberField(TEXT("Measured"), Measured);
+			Violation->SetNumberField(TEXT("Limit"), Budget);
+			OutViolations.Add(MakeShared<FJsonValueObject>(Violation));
+		}
+	}
+
+	/** Interactive once the screen is activated, displayed by its stack and the stack transition is over */
+	bool IsInteractive(const UEasyUserInterfaceRootWidget& RootWidget, const FGameplayTag& LayerTag, const UEasyActivatableWidgetBase& Screen)
+	{
+		const UCommonActivatableWidgetStack* Stack = RootWidget.FindWidgetStack(LayerTag);
+		const FEasyUserInterfaceLayerState* LayerState = RootWidget.FindLayerState(LayerTag);
+		return Screen.IsActivated() && Stack && Stack->GetActiveWidget() == &Screen && (!LayerState || !LayerState->bIsTransitioning);
+	}
+
+	/**
+	 * Pushes the screen through the manager, measures it until it is interactive, then pops it through the manager and waits for
+	 * the stack to settle. Time to interactive runs from the push request.
+	 */
+	class FAuditScreenCommand : public IAutomationLatentCommand
+	{
+	public:
+		explicit FAuditScreenCommand(const TSharedRef<FScreenAudit>& InAudit) : Audit(InAudit) {}
+
+		virtual bool Update() override
+		{
+			UEasyUserInterfaceManager* Manager = Audit->Manager.Get();
+			UEasyUserInterfaceRootWidget* RootWidget = Manager ? Manager->GetRootWidget() : nullptr;
+			// A screen that is not interactive in time is still popped before its world is destroyed
+			if (Phase == EPhase::Push && !Audit->Error.IsEmpty())
+			{
+				return true;
+			}
+			if (!RootWidget)
+			{
+				Audit->Error = TEXT("The root widget is not added to the viewport.");
+				return true;
+			}
+
+			++PhaseFrames;
+			switch (Phase)
+			{
+			case EPhase::Push:
+				return Push(*Manager, *RootWidget);
+			case EPhase::WaitForPush:
+				return WaitForPush(*RootWidget);
+			case EPhase::WaitForInteractive:
+				return WaitForInteractive(*Manager, *RootWidget);
+			case EPhase::WaitForRemoval:
+				return WaitForRemoval(*RootWidget);
+			default:
+				return true;
+			}
+		}
+
+	private:
+		enum class EPhase : uint8
+		{
+			Push,
+			WaitForPush,
+			WaitForInteractive,
+			WaitForRemoval
+		};
+
+		bool Push(UEasyUserInterfaceManager& Manager, const UEasyUserInterfaceRootWidget& RootWidget)
+		{
+			const TSubclassOf<UEasyActivatableWidgetBase> ScreenClass = Cast<UClass>(Audit->ClassPath.ResolveObject());
+			if (!ScreenClass || ScreenClass->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated))
+			{
+				Audit->Error = TEXT("The screen class failed to load or is abstract.");
+				return true;
+			}
+
+			if (!Audit->Params.LayerTag.IsValid())
+			{
+				const TArray<FGameplayTag> StackLayers = FEasyUserInterfaceTestUtils::SortLayers(RootWidget.GetRegisteredStackLayers());
+				Audit->Params.LayerTag = StackLayers.Num() > 0 ? StackLayers[0] : FGameplayTag();
+			}
+
+			const UCommonActivatableWidgetStack* Stack = RootWidget.FindWidgetStack(Audit->Params.LayerTag);
+			if (!Stack)
+			{
+				Audit->Error = FString::Printf(TEXT("No stack registered for layer '%s'."), *Audit->Params.LayerTag.ToString());
+				return true;
+			}
+
+			// The construction time is read back from the latency the manager records for the push
+			FEasyUserInterfaceStats::Reset();
+			NumWidgetsBefore = Stack->GetNumWidgets();
+			PushTime = FPlatformTime::Seconds();
+			if (!Manager.PushWidgetToStackAsync(Audit->Params.LayerTag, TSoftClassPtr<UCommonActivatableWidget>(Audit->ClassPath), FOnWidgetUpdatedOnStack()))
+			{
+				Audit->Error = TEXT("The manager did not accept the push.");
+				return true;
+			}
+
+			Phase = EPhase::WaitForPush;
+			PhaseFrames = 0;
+			return false;
+		}
+
+		/** The manager adds the screen once the streamable manager completes its class, on the next tick at the earliest */
+		bool WaitForPush(const UEasyUserInterfaceRootWidget& RootWidget)
+		{
+			const UCommonActivatableWidgetStack* Stack = RootWidget.FindWidgetStack(Audit->Params.LayerTag);
+			if (Stack && Stack->GetNumWidgets() > NumWidgetsBefore)
+			{
+				Screen = Cast<UEasyActivatableWidgetBase>(Stack->GetWidgetList().Last());
+			}
+
+			UEasyActivatableWidgetBase* PushedScreen = Screen.Get();
+			if (!PushedScreen)
+			{
+				if (PhaseFrames > Audit->Params.MaxFramesPerScreen)
+				{
+					Audit->Error = FString::Printf(TEXT("The screen was not pushed after %d frame(s)."), Audit->Params.MaxFramesPerScreen);
+					return true;
+				}
+				return false;
+			}
+
+			Audit->ConstructMs = FEasyUserInterfaceStats::GetLatencySummary(EEasyUserInterfaceOperation::PushWidget, EEasyUserInterfaceLatencyPhase::Construct).Max;
+			Audit->WidgetCount = CountWidgets(*PushedScreen);
+			Phase = EPhase::WaitForInteractive;
+			PhaseFrames = 0;
+			return false;
+		}
+
+		bool WaitForInteractive(UEasyUserInterfaceManager& Manager, const UEasyUserInterfaceRootWidget& RootWidget)
+		{
+			UEasyActivatableWidgetBase* PushedScreen = Screen.Get();
+			if (!PushedScreen)
+			{
+				Audit->Error = TEXT("The screen was destroyed before becoming interactive.");
+				return true;
+			}
+
+			if (IsInteractive(RootWidget, Audit->Params.LayerTag, *PushedScreen))
+			{
+				Audit->TimeToInteractiveMs = (FPlatformTime::Seconds() - PushTime) * 1000.0;
+				Audit->NumBindings = PushedScreen->GetNumRegisteredBindings();
+			}
+			else if (PhaseFrames > Audit->Params.MaxFramesPerScreen)
+			{
+				Audit->Error = FString::Printf(TEXT("Not interactive after %d frame(s)."), Audit->Params.MaxFramesPerScreen);
+			}
+			else
+			{
+				return false;
+			}
+
+			Manager.RemoveWidgetFromStack(Audit->Params.LayerTag, PushedScreen);
+			Phase = EPhase::WaitForRemoval;
+			PhaseFrames = 0;
+			return false;
+		}
+
+		bool WaitForRemoval(const UEasyUserInterfaceRootWidget& RootWidget)
+		{
+			const FEasyUserInterfaceLayerState* LayerState = RootWidget.FindLayerState(Audit->Params.LayerTag);
+			if (PhaseFrames <= Audit->Params.MaxFramesPerScreen && LayerState && LayerState->bIsTransitioning)
+			{
+				return false;
+			}
+
+			Screen.Reset();
+			return true;
+		}
+
+		TSharedRef<FScreenAudit> Audit;
+		EPhase Phase = EPhase::Push;
+		int32 PhaseFrames = 0;
+		int32 NumWidgetsBefore = 0;
+		double PushTime = 0.0;
+		TWeakObjectPtr<UEasyActivatableWidgetBase> Screen;
+	};
+
+	/** Checks the measures against the budget of the screen and writes them */
+	class FReportScreenCommand : public IAutomationLatentCommand
+	{
+	public:
+		explicit FReportScreenCommand(const TSharedRef<FScreenAudit>& InAudit) : Audit(InAudit) {}
+
+		virtual bool Update() override
+		{
+			TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+			Result->SetStringField(TEXT("Class"), Audit->ClassPath.ToString());
+			Result->SetStringField(TEXT("Layer"), Audit->Params.LayerTag.ToString());
+
+			const UClass* ScreenClass = Cast<UClass>(Audit->ClassPath.ResolveObject());
+			if (!Audit->Error.IsEmpty() || !ScreenClass)
+			{
+				Audit->Test->AddError(FString::Printf(TEXT("Budget audit of %s failed: %s"), *Audit->ClassPath.GetAssetName(), *Audit->Error));
+				Result->SetBoolField(TEXT("Failed"), true);
+				Result->SetStringField(TEXT("Reason"), Audit->Error);
+			}
+			else
+			{
+				const FEasyActivatableWidgetBudget Budget = GetDefault<UEasyActivatableWidgetBase>(ScreenClass)->GetEffectivePerformanceBudget();
+				TArray<TSharedPtr<FJsonValue>> Violations;
+				CheckBudget(Violations, TEXT("ConstructMs"), Audit->ConstructMs, Budget.MaxConstructMs);
+				CheckBudget(Violations, TEXT("WidgetCount"), Audit->WidgetCount, Budget.MaxWidgetCount);
+				CheckBudget(Violations, TEXT("Bindings"), Audit->NumBindings, Budget.MaxBindings);
+				CheckBudget(Violations, TEXT("TimeToInteractiveMs"), Audit->TimeToInteractiveMs, Budget.MaxTimeToInteractiveMs);
+
+				Result->SetNumberField(TEXT("ConstructMs"), Audit->ConstructMs);
+				Result->SetNumberField(TEXT("WidgetCount"), Audit->WidgetCount);
+				Result->SetNumberField(TEXT("Bindings"), Audit->NumBindings);
+				Result->SetNumberField(TEXT("TimeToInteractiveMs"), Audit->TimeToInteractiveMs);
+				Result->SetBoolField(TEXT("Failed"), false);
+				Result->SetArrayField(TEXT("Violations"), Violations);
+
+				const FString Measures = FString::Printf(TEXT("construct %.2f ms, %d widget(s), %d binding(s), interactive after %.2f ms"),
+					Audit->ConstructMs, Audit->WidgetCount, Audit->NumBindings, Audit->TimeToInteractiveMs);
+				if (Violations.Num() > 0)
+				{
+					Audit->Test->AddError(FString::Printf(TEXT("%s is over %d of its performance budget(s): %s"), *ScreenClass->GetName(), Violations.Num(), *Measures));
+				}
+				else
+				{
+					Audit->Test->AddInfo(FString::Printf(TEXT("%s: %s"), *ScreenClass->GetName(), *Measures));
+				}
+			}
+
+			const FString OutputPath = FPaths::Combine(Audit->Params.OutputDirectory, Audit->ClassPath.GetAssetName() + TEXT(".json"));
+			if (!FEasyUserInterfaceJson::WriteToFile(Result, OutputPath))
+			{
+				Audit->Test->AddError(FString::Printf(TEXT("Could not write the budget audit results to %s"), *OutputPath));
+			}
+
+			Audit->ClassHandle.Reset();
+			return true;
+		}
+
+	private:
+		TSharedRef<FScreenAudit> Audit;
+	};
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FEasyUserInterfaceBudgetAuditTest, "EasyUI.BudgetAudit",
+	EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FEasyUserInterfaceBudgetAuditTest::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	const EasyUserInterfaceBudgetAudit::FParams Params = EasyUserInterfaceBudgetAudit::FParams::FromCommandLine(FCommandLine::Get());
+	EasyUserInterfaceBudgetAudit::FindScreens(Params.ContentPath, OutBeautifiedNames, OutTestCommands);
+}
+
+bool FEasyUserInterfaceBudgetAuditTest::RunTest(const FString& Parameters)
+{
+	using namespace EasyUserInterfaceBudgetAudit;
+
+	const TSharedRef<FScreenAudit> Audit = MakeShared<FScreenAudit>();
+	Audit->Test = this;
+	Audit->Params = FParams::FromCommandLine(FCommandLine::Get());
+	Audit->ClassPath = FSoftObjectPath(Parameters);
+
+	ADD_LATENT_AUTOMATION_COMMAND(FEasyUICreateTestWorldCommand(Audit->TestWorld, Audit->Params.Timeout, [Audit](UEasyUserInterfaceManager* Manager)
+	{
+		Audit->Manager = Manager;
+		if (!Manager)
+		{
+			Audit->Error = TEXT("The test world could not be created or its root widget was not in the viewport in time.");
+		}
+	}));
+	ADD_LATENT_AUTOMATION_COMMAND(FEasyUIWaitForLoadCommand({ Audit->ClassPath }, Audit->Params.Timeout, [Audit](TSharedPtr<FStreamableHandle> Handle)
+	{
+		Audit->ClassHandle = MoveTemp(Handle);
+	}));
+	ADD_LATENT_AUTOMATION_COMMAND(FAuditScreenCommand(Audit));
+	ADD_LATENT_AUTOMATION_COMMAND(FReportScreenCommand(Audit));
+	ADD_LATENT_AUTOMATION_COMMAND(FEasyUIDestroyTestWorldCommand(Audit->TestWorld));
+	return true;
+}
+
+#endif
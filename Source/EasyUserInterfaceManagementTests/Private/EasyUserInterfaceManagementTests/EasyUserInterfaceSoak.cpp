@@ -0,0 +1,432 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagementTests.h"
+#include "Components/Widget.h"
+#include "Dom/JsonObject.h"
+#include "Engine/StreamableManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceJson.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceLeakTracker.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSettings.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSyncLoadDetector.h"
+#include "EasyUserInterfaceManagementTests/EasyUserInterfaceTestUtils.h"
+#include "ExtensionCommonUI/EasyUserInterfaceRootWidget.h"
+#include "ExtensionCommonUI/Notification/EasyNotificationWidget.h"
+#include "ExtensionCommonUI/PromptQuestion/EasyPromptQuestion.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectIterator.h"
+#include "Widgets/CommonActivatableWidgetContainer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Cycles a User Interface through the public Manager API for a long time to find leaks that
+ * only show after hours of menu navigation: pushes and pops on every stack layer, notification bursts on every panel
+ * and prompts answered right away. The classes are set in the "Soak" project settings, the operations without a class are skipped.
+ *
+ * UObject count, widget count and used physical memory are sampled after a full garbage collection. The test fails when one
+ * of them grows at every sample after the warmup. Runs in a game world of its own with the test root widget of the project settings,
+ * so unattended headless CI sessions need no map nor PIE session, e.g:
+ * -nullrhi -ExecCmds="Automation RunTests EasyUI.Soak; Quit" -EasyUISoakDuration=14400
+ */
+namespace EasyUserInterfaceSoak
+{
+	/** Parameters of a soak run, parsed from the command line */
+	struct FParams
+	{
+		/** Seconds to keep cycling the User Interface for ("-EasyUISoakDuration=") */
+		float Duration = 3600.0f;
+		/** Seconds between two samples, a full garbage collection runs before each sample ("-EasyUISoakSampleInterval=") */
+		float SampleInterval = 60.0f;
+		/** Samples ignored at the start of the run, while caches and pools are still filling up ("-EasyUISoakWarmupSamples=") */
+		int32 WarmupSamples = 2;
+		/** Growth in percent between the first and the last sample under which a monotonic growth is not reported ("-EasyUISoakTolerance=") */
+		float TolerancePercent = 1.0f;
+		/** Frames between two operations of the cycle ("-EasyUISoakCycleFrames=") */
+		int32 CycleFrames = 5;
+		/** Notifications added to every notification panel by each burst ("-EasyUISoakBurstSize=") */
+		int32 NotificationBurstSize = 8;
+		/** File the JSON results are written to ("-EasyUISoakOutput="), defaults to Saved/EasyUI/Soak.json */
+		FString OutputPath;
+		/** Seconds to wait for the root widget and the soak classes before failing ("-EasyUISoakTimeout=") */
+		float Timeout = 30.0f;
+
+		static FParams FromCommandLine(const TCHAR* CommandLine)
+		{
+			FParams Params;
+			FParse::Value(CommandLine, TEXT("EasyUISoakDuration="), Params.Duration);
+			FParse::Value(CommandLine, TEXT("EasyUISoakSampleInterval="), Params.SampleInterval);
+			FParse::Value(CommandLine, TEXT("EasyUISoakWarmupSamples="), Params.WarmupSamples);
+			FParse::Value(CommandLine, TEXT("EasyUISoakTolerance="), Params.TolerancePercent);
+			FParse::Value(CommandLine, TEXT("EasyUISoakCycleFrames="), Params.CycleFrames);
+			FParse::Value(CommandLine, TEXT("EasyUISoakBurstSize="), Params.NotificationBurstSize);
+			FParse::Value(CommandLine, TEXT("EasyUISoakOutput="), Params.OutputPath);
+			FParse::Value(CommandLine, TEXT("EasyUISoakTimeout="), Params.Timeout);
+
+			Params.SampleInterval = FMath::Max(1.0f, Params.SampleInterval);
+			Params.WarmupSamples = FMath::Max(0, Params.WarmupSamples);
+			Params.CycleFrames = FMath::Max(1, Params.CycleFrames);
+			Params.NotificationBurstSize = FMath::Max(0, Params.NotificationBurstSize);
+			if (Params.OutputPath.IsEmpty())
+			{
+				Params.OutputPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("EasyUI"), TEXT("Soak.json"));
+			}
+			return Params;
+		}
+	};
+
+	/** A sample of the soak run, taken right after a full garbage collection */
+	struct FSample
+	{
+		double Time = 0.0;
+		int32 NumCycles = 0;
+		int32 NumObjects = 0;
+		int32 NumWidgets = 0;
+		uint64 UsedPhysicalBytes = 0;
+	};
+
+	/** Operations of a cycle, executed in order, one every few frames */
+	enum class ECycleStep : uint8
+	{
+		PushWidgets,
+		NotificationBurst,
+		PushPrompt,
+		PopWidgets,
+		AnswerPrompt,
+		Num
+	};
+
+	/** State shared by the latent commands of a run */
+	struct FSoakRun
+	{
+		FAutomationTestBase* Test = nullptr;
+		FParams Params;
+		TSharedRef<FEasyUserInterfaceTestWorld> TestWorld = MakeShared<FEasyUserInterfaceTestWorld>();
+		TWeakObjectPtr<UEasyUserInterfaceManager> Manager;
+		/** Keeps the soak classes loaded across the garbage collections of the samples */
+		TSharedPtr<FStreamableHandle> ClassesHandle;
+		TWeakObjectPtr<UEasyPromptQuestion> PendingPrompt;
+
+		int32 NumCycles = 0;
+		int32 NumFailedOperations = 0;
+		TArray<FSample> Samples;
+		FString Error;
+	};
+
+	/**
+	 * Checks if a series of samples keeps growing: never decreases and ends above the first sample by more than the tolerance.
+	 * @param Values The sampled values, in order.
+	 * @param TolerancePercent Growth in percent under which the series is not reported.
+	 * @return True if the series grows monotonically.
+	 */
+	bool IsMonotonicGrowth(const TArray<double>& Values, float TolerancePercent)
+	{
+		// Any noise between two samples would read as a trend, at least three are needed to call it a growth
+		if (Values.Num() < 3)
+		{
+			return false;
+		}
+
+		for (int32 Index = 1; Index < Values.Num(); ++Index)
+		{
+			if (Values[Index] < Values[Index - 1])
+			{
+				return false;
+			}
+		}
+		return Values.Last() > Values[0] * (1.0 + TolerancePercent / 100.0);
+	}
+
+	/** Cycles the User Interface and samples it until the end of the run */
+	class FSoakCommand : public IAutomationLatentCommand
+	{
+	public:
+		explicit FSoakCommand(const TSharedRef<FSoakRun>& InRun) : Run(InRun) {}
+
+		virtual bool Update() override
+		{
+			if (!Run->Error.IsEmpty())
+			{
+				return true;
+			}
+
+			UEasyUserInterfaceManager* Manager = Run->Manager.Get();
+			UEasyUserInterfaceRootWidget* RootWidget = Manager ? Manager->GetRootWidget() : nullptr;
+			if (!RootWidget)
+			{
+				Run->Error = TEXT("The root widget is not added to the viewport.");
+				return true;
+			}
+
+			const double Now = FPlatformTime::Seconds();
+			if (StartTime == 0.0)
+			{
+				StartTime = Now;
+				NextSampleTime = Now;
+				UE_LOG(LogEasyUserInterfaceManagementTests, Display, TEXT("Soaking the User Interface for %.0f s, sampling every %.0f s"), Run->Params.Duration, Run->Params.SampleInterval);
+			}
+
+			if (Now >= NextSampleTime)
+			{
+				TakeSample();
+				NextSampleTime = Now + Run->Params.SampleInterval;
+			}
+
+			if (Now - StartTime >= Run->Params.Duration)
+			{
+				// The run ends on a sample so the last cycles are accounted
+				TakeSample();
+				return true;
+			}
+
+			if (++FrameInStep >= Run->Params.CycleFrames)
+			{
+				FrameInStep = 0;
+				ExecuteStep(*Manager, *RootWidget);
+			}
+			return false;
+		}
+
+	private:
+		void TakeSample()
+		{
+			// Only what survives a full collection is accounted, garbage waiting for the next incremental pass is not a leak
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+
+			FSample Sample;
+			Sample.Time = FPlatformTime::Seconds() - StartTime;
+			Sample.NumCycles = Run->NumCycles;
+			Sample.NumObjects = GUObjectArray.GetObjectArrayNumMinusAvailable();
+			for (TObjectIterator<UWidget> It; It; ++It)
+			{
+				++Sample.NumWidgets;
+			}
+			Sample.UsedPhysicalBytes = FPlatformMemory::GetStats().UsedPhysical;
+			Run->Samples.Add(Sample);
+
+			UE_LOG(LogEasyUserInterfaceManagementTests, Display, TEXT("Soak sample at %.0f s, %d cycle(s): %d object(s), %d widget(s), %.1f MB used"),
+				Sample.Time, Sample.NumCycles, Sample.NumObjects, Sample.NumWidgets, Sample.UsedPhysicalBytes / (1024.0 * 1024.0));
+		}
+
+		void ExecuteStep(UEasyUserInterfaceManager& Manager, UEasyUserInterfaceRootWidget& RootWidget)
+		{
+			const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+			const TArray<FGameplayTag> StackLayers = FEasyUserInterfaceTestUtils::SortLayers(RootWidget.GetRegisteredStackLayers());
+
+			switch (Step)
+			{
+			case ECycleStep::PushWidgets:
+				if (!Settings->SoakWidgetClass.IsNull())
+				{
+					for (const FGameplayTag& LayerTag : StackLayers)
+					{
+						if (!Manager.PushWidgetToStackAsync(LayerTag, Settings->SoakWidgetClass, FOnWidgetUpdatedOnStack()))
+						{
+							++Run->NumFailedOperations;
+						}
+					}
+				}
+				break;
+			case ECycleStep::NotificationBurst:
+				if (!Settings->SoakNotificationClass.IsNull())
+				{
+					FEasyNotificationWidgetInfo NotificationInfo;
+					NotificationInfo.NotificationHeader = FText::FromString(TEXT("Soak"));
+					NotificationInfo.NotificationBody = FText::FromString(TEXT("Soak notification"));
+					NotificationInfo.NotificationDuration = 1.0f;
+					for (const FGameplayTag& LayerTag : FEasyUserInterfaceTestUtils::SortLayers(RootWidget.GetRegisteredNotificationLayers()))
+					{
+						for (int32 Index = 0; Index < Run->Params.NotificationBurstSize; ++Index)
+						{
+							if (!Manager.AddNotificationToPanel(LayerTag, Settings->SoakNotificationClass, NotificationInfo, FOnNotificationAddedToPanel()))
+							{
+								++Run->NumFailedOperations;
+							}
+						}
+					}
+				}
+				break;
+			case ECycleStep::PushPrompt:
+				if (const TSubclassOf<UEasyPromptQuestion> PromptClass = Settings->SoakPromptClass.Get())
+				{
+					FPromptQuestionBodyInfo QuestionBodyInfo;
+					QuestionBodyInfo.QuestionHeaderText = FText::FromString(TEXT("Soak"));
+					QuestionBodyInfo.QuestionBodyText = FText::FromString(TEXT("Soak prompt"));
+					Run->PendingPrompt = StackLayers.Num() > 0 ? Manager.PushQuestionPromptToLayer(PromptClass, StackLayers[0], QuestionBodyInfo, FPromtResultEventDelegate()) : nullptr;
+					Run->NumFailedOperations += Run->PendingPrompt.IsValid() ? 0 : 1;
+				}
+				break;
+			case ECycleStep::PopWidgets:
+				// Every soak widget is removed, including the ones whose push completed late, so the stacks cannot grow
+				for (const FGameplayTag& LayerTag : StackLayers)
+				{
+					const UCommonActivatableWidgetStack* Stack = RootWidget.FindWidgetStack(LayerTag);
+					const UClass* WidgetClass = Settings->SoakWidgetClass.Get();
+					if (!Stack || !WidgetClass)
+					{
+						continue;
+					}
+
+					const TArray<UCommonActivatableWidget*> Widgets = Stack->GetWidgetList();
+					for (int32 Index = Widgets.Num() - 1; Index >= 0; --Index)
+					{
+						if (Widgets[Index] && Widgets[Index]->GetClass() == WidgetClass && !Manager.RemoveWidgetFromStack(LayerTag, Widgets[Index]))
+						{
+							++Run->NumFailedOperations;
+						}
+					}
+				}
+				break;
+			case ECycleStep::AnswerPrompt:
+				if (UEasyPromptQuestion* Prompt = Run->PendingPrompt.Get())
+				{
+					Prompt->AnswerPrompt(false);
+				}
+				Run->PendingPrompt.Reset();
+				++Run->NumCycles;
+				break;
+			default:
+				break;
+			}
+
+			Step = static_cast<ECycleStep>((static_cast<uint8>(Step) + 1) % static_cast<uint8>(ECycleStep::Num));
+		}
+
+		TSharedRef<FSoakRun> Run;
+		ECycleStep Step = ECycleStep::PushWidgets;
+		double StartTime = 0.0;
+		double NextSampleTime = 0.0;
+		int32 FrameInStep = 0;
+	};
+
+	/** Checks the samples for growths and writes the results */
+	class FReportSoakCommand : public IAutomationLatentCommand
+	{
+	public:
+		explicit FReportSoakCommand(const TSharedRef<FSoakRun>& InRun) : Run(InRun) {}
+
+		virtual bool Update() override
+		{
+			FAutomationTestBase& Test = *Run->Test;
+			TSharedRef<FJsonObject> Results = MakeShared<FJsonObject>();
+			Results->SetNumberField(TEXT("DurationSeconds"), Run->Samples.Num() > 0 ? Run->Samples.Last().Time : 0.0);
+			Results->SetNumberField(TEXT("Cycles"), Run->NumCycles);
+			Results->SetNumberField(TEXT("FailedOperations"), Run->NumFailedOperations);
+			if (!Run->Error.IsEmpty())
+			{
+				Test.AddError(FString::Printf(TEXT("Soak failed: %s"), *Run->Error));
+				Results->SetStringField(TEXT("Error"), Run->Error);
+			}
+
+			TArray<TSharedPtr<FJsonValue>> SampleValues;
+			TArray<double> NumObjects, NumWidgets, UsedPhysicalBytes;
+			for (int32 Index = 0; Index < Run->Samples.Num(); ++Index)
+			{
+				const FSample& Sample = Run->Samples[Index];
+				TSharedRef<FJsonObject> SampleObject = MakeShared<FJsonObject>();
+				SampleObject->SetNumberField(TEXT("Time"), Sample.Time);
+				SampleObject->SetNumberField(TEXT("Cycles"), Sample.NumCycles);
+				SampleObject->SetNumberField(TEXT("Objects"), Sample.NumObjects);
+				SampleObject->SetNumberField(TEXT("Widgets"), Sample.NumWidgets);
+				SampleObject->SetNumberField(TEXT("UsedPhysicalMB"), Sample.UsedPhysicalBytes / (1024.0 * 1024.0));
+				SampleValues.Add(MakeShared<FJsonValueObject>(SampleObject));
+
+				if (Index >= Run->Params.WarmupSamples)
+				{
+					NumObjects.Add(Sample.NumObjects);
+					NumWidgets.Add(Sample.NumWidgets);
+					UsedPhysicalBytes.Add(static_cast<double>(Sample.UsedPhysicalBytes));
+				}
+			}
+			Results->SetArrayField(TEXT("Samples"), SampleValues);
+
+			TArray<TSharedPtr<FJsonValue>> Growths;
+			const TPair<const TCHAR*, const TArray<double>*> Metrics[] = {
+				{ TEXT("Objects"), &NumObjects },
+				{ TEXT("Widgets"), &NumWidgets },
+				{ TEXT("UsedPhysicalMemory"), &UsedPhysicalBytes }
+			};
+			for (const TPair<const TCHAR*, const TArray<double>*>& Metric : Metrics)
+			{
+				if (IsMonotonicGrowth(*Metric.Value, Run->Params.TolerancePercent))
+				{
+					Test.AddError(FString::Printf(TEXT("Soak: %s grew at every sample, from %.0f to %.0f"), Metric.Key, (*Metric.Value)[0], Metric.Value->Last()));
+					Growths.Add(MakeShared<FJsonValueString>(Metric.Key));
+				}
+			}
+			Results->SetArrayField(TEXT("MonotonicGrowth"), Growths);
+
+			// Leaked widgets are only known when the soak runs with EasyUI.LeakTracking enabled
+			if (FEasyUserInterfaceLeakTracker::IsTracking())
+			{
+				const int32 NumLeakedWidgets = FEasyUserInterfaceLeakTracker::CheckNow();
+				Results->SetNumberField(TEXT("LeakedWidgets"), NumLeakedWidgets);
+				if (NumLeakedWidgets > 0)
+				{
+					Test.AddError(FString::Printf(TEXT("Soak: %d leaked widget(s)"), NumLeakedWidgets));
+				}
+			}
+			// Same for the stalls, with EasyUI.SyncLoadDetection enabled
+			if (FEasyUserInterfaceSyncLoadDetector::IsEnabled())
+			{
+				const int32 NumSyncLoads = FEasyUserInterfaceSyncLoadDetector::GetNumDetections();
+				Results->SetNumberField(TEXT("SyncLoads"), NumSyncLoads);
+				if (NumSyncLoads > 0)
+				{
+					Test.AddError(FString::Printf(TEXT("Soak: %d sync load(s) or flush(es) on the User Interface paths"), NumSyncLoads));
+				}
+			}
+
+			if (!FEasyUserInterfaceJson::WriteToFile(Results, Run->Params.OutputPath))
+			{
+				Test.AddError(FString::Printf(TEXT("Could not write the soak results to %s"), *Run->Params.OutputPath));
+			}
+
+			UE_LOG(LogEasyUserInterfaceManagementTests, Display, TEXT("Soak of %d cycle(s) finished, results: %s"), Run->NumCycles, *Run->Params.OutputPath);
+			Run->ClassesHandle.Reset();
+			return true;
+		}
+
+	private:
+		TSharedRef<FSoakRun> Run;
+	};
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEasyUserInterfaceSoakTest, "EasyUI.Soak",
+	EAutomationTestFlags::ClientContext | EAutomationTestFlags::EditorContext | EAutomationTestFlags::StressFilter)
+
+bool FEasyUserInterfaceSoakTest::RunTest(const FString& Parameters)
+{
+	using namespace EasyUserInterfaceSoak;
+
+	const TSharedRef<FSoakRun> Run = MakeShared<FSoakRun>();
+	Run->Test = this;
+	Run->Params = FParams::FromCommandLine(FCommandLine::Get());
+
+	ADD_LATENT_AUTOMATION_COMMAND(FEasyUICreateTestWorldCommand(Run->TestWorld, Run->Params.Timeout, [Run](UEasyUserInterfaceManager* Manager)
+	{
+		Run->Manager = Manager;
+		if (!Manager)
+		{
+			Run->Error = TEXT("The test world could not be created or its root widget was not in the viewport in time.");
+		}
+	}));
+
+	// Loaded up front so the cycles never measure the first load of a class
+	const UEasyUserInterfaceSettings* Settings = UEasyUserInterfaceSettings::Get();
+	TArray<FSoftObjectPath> ClassPaths = { Settings->SoakWidgetClass.ToSoftObjectPath(), Settings->SoakNotificationClass.ToSoftObjectPath(), Settings->SoakPromptClass.ToSoftObjectPath() };
+	ADD_LATENT_AUTOMATION_COMMAND(FEasyUIWaitForLoadCommand(MoveTemp(ClassPaths), Run->Params.Timeout, [Run](TSharedPtr<FStreamableHandle> Handle)
+	{
+		Run->ClassesHandle = MoveTemp(Handle);
+	}));
+	ADD_LATENT_AUTOMATION_COMMAND(FSoakCommand(Run));
+	ADD_LATENT_AUTOMATION_COMMAND(FReportSoakCommand(Run));
+	ADD_LATENT_AUTOMATION_COMMAND(FEasyUIDestroyTestWorldCommand(Run->TestWorld));
+	return true;
+}
+
+#endif
@@ -0,0 +1,181 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+
+#include "EasyUserInterfaceManagementTests/EasyUserInterfaceTestUtils.h"
+
+#include "Engine/AssetManager.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceManager.h"
+#include "EasyUserInterfaceManagement/EasyUserInterfaceSettings.h"
+#include "EasyUserInterfaceManagementTests.h"
+
+APlayerController* FEasyUserInterfaceTestUtils::GetPlayerController(const UEasyUserInterfaceManager& Manager)
+{
+	const ULocalPlayer* LocalPlayer = Manager.GetLocalPlayer();
+	return LocalPlayer ? LocalPlayer->GetPlayerController(Manager.GetWorld()) : nullptr;
+}
+
+TArray<FGameplayTag> FEasyUserInterfaceTestUtils::SortLayers(TArray<FGameplayTag> Layers, const FGameplayTag& OnlyLayer)
+{
+	if (OnlyLayer.IsValid())
+	{
+		Layers.RemoveAll([&OnlyLayer](const FGameplayTag& LayerTag) { return LayerTag != OnlyLayer; });
+	}
+	Layers.Sort([](const FGameplayTag& Tag, const FGameplayTag& OtherTag) { return Tag.GetTagName().LexicalLess(OtherTag.GetTagName()); });
+	return Layers;
+}
+
+FEasyUserInterfaceTestWorld::~FEasyUserInterfaceTestWorld()
+{
+	Destroy();
+}
+
+bool FEasyUserInterfaceTestWorld::Create(const TSoftClassPtr<UEasyUserInterfaceRootWidget>& RootWidgetClass, FString& OutError)
+{
+	if (RootWidgetClass.IsNull())
+	{
+		OutError = TEXT("No test root widget class set in the project settings.");
+		return false;
+	}
+
+	Destroy();
+	GameInstance.Reset(NewObject<UGameInstance>(GEngine));
+	GameInstance->InitializeStandalone(TEXT("EasyUITestWorld"));
+	UWorld* World = GameInstance->GetWorld();
+	FWorldContext* WorldContext = GameInstance->GetWorldContext();
+	if (!World || !WorldContext)
+	{
+		OutError = TEXT("Could not create the test world.");
+		Destroy();
+		return false;
+	}
+
+	// The root widget is added to the viewport of the world, it has no window to draw to
+	UGameViewportClient* ViewportClient = NewObject<UGameViewportClient>(GEngine);
+	ViewportClient->Init(*WorldContext, GameInstance.Get(), false);
+	WorldContext->GameViewport = ViewportClient;
+
+	const FURL URL;
+	World->SetGameMode(URL);
+	World->InitializeActorsForPlay(URL);
+	World->BeginPlay();
+
+	const ULocalPlayer* LocalPlayer = GameInstance->CreateLocalPlayer(-1, OutError, true);
+	UEasyUserInterfaceManager* Manager = LocalPlayer ? LocalPlayer->GetSubsystem<UEasyUserInterfaceManager>() : nullptr;
+	if (!Manager || !LocalPlayer->GetPlayerController(World))
+	{
+		OutError = FString::Printf(TEXT("Could not create the local player of the test world. %s"), *OutError);
+		Destroy();
+		return false;
+	}
+
+	Manager->AddRootWidgetToViewport(RootWidgetClass);
+	return true;
+}
+
+void FEasyUserInterfaceTestWorld::Destroy()
+{
+	if (!GameInstance)
+	{
+		return;
+	}
+
+	UWorld* World = GameInstance->GetWorld();
+	FWorldContext* WorldContext = GameInstance->GetWorldContext();
+	// Shutting the game instance down removes its local players, which deinitializes their manager
+	GameInstance->Shutdown();
+	if (WorldContext && WorldContext->GameViewport)
+	{
+		WorldContext->GameViewport->DetachViewportClient();
+		WorldContext->GameViewport = nullptr;
+	}
+	if (World)
+	{
+		World->BeginTearingDown();
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+	GameInstance.Reset();
+}
+
+UEasyUserInterfaceManager* FEasyUserInterfaceTestWorld::GetManager() const
+{
+	const ULocalPlayer* LocalPlayer = GameInstance ? GameInstance->GetFirstGamePlayer() : nullptr;
+	return LocalPlayer ? LocalPlayer->GetSubsystem<UEasyUserInterfaceManager>() : nullptr;
+}
+
+FEasyUICreateTestWorldCommand::FEasyUICreateTestWorldCommand(const TSharedRef<FEasyUserInterfaceTestWorld>& InTestWorld, float InTimeout,
+	TFunction<void(UEasyUserInterfaceManager*)>&& InOnFinished)
+	: TestWorld(InTestWorld)
+	, Timeout(InTimeout)
+	, OnFinished(MoveTemp(InOnFinished))
+{
+}
+
+bool FEasyUICreateTestWorldCommand::Update()
+{
+	if (!bCreateRequested)
+	{
+		bCreateRequested = true;
+		FString Error;
+		if (!TestWorld->Create(UEasyUserInterfaceSettings::Get()->TestRootWidgetClass, Error))
+		{
+			UE_LOG(LogEasyUserInterfaceManagementTests, Warning, TEXT("%s"), *Error);
+			OnFinished(nullptr);
+			return true;
+		}
+	}
+
+	UEasyUserInterfaceManager* Manager = TestWorld->GetManager();
+	if (Manager && Manager->IsRootWidgetReady())
+	{
+		OnFinished(Manager);
+		return true;
+	}
+
+	if (GetCurrentRunTime() > Timeout)
+	{
+		OnFinished(nullptr);
+		return true;
+	}
+	return false;
+}
+
+bool FEasyUIDestroyTestWorldCommand::Update()
+{
+	TestWorld->Destroy();
+	return true;
+}
+
+FEasyUIWaitForLoadCommand::FEasyUIWaitForLoadCommand(TArray<FSoftObjectPath>&& InAssetPaths, float InTimeout, TFunction<void(TSharedPtr<FStreamableHandle>)>&& InOnFinished)
+	: AssetPaths(MoveTemp(InAssetPaths))
+	, Timeout(InTimeout)
+	, OnFinished(MoveTemp(InOnFinished))
+{
+}
+
+bool FEasyUIWaitForLoadCommand::Update()
+{
+	if (!bLoadRequested)
+	{
+		bLoadRequested = true;
+		AssetPaths.RemoveAll([](const FSoftObjectPath& AssetPath) { return AssetPath.IsNull(); });
+		if (!AssetPaths.IsEmpty())
+		{
+			Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(AssetPaths), FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+		}
+	}
+
+	if (Handle.IsValid() && !Handle->HasLoadCompleted() && GetCurrentRunTime() <= Timeout)
+	{
+		return false;
+	}
+
+	OnFinished(MoveTemp(Handle));
+	return true;
+}
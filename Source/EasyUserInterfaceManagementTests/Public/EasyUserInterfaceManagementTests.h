@@ -0,0 +1,17 @@
+// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "Modules/ModuleManager.h"
+
+// Declare log category for the Easy User Interface Management tests module
+DECLARE_LOG_CATEGORY_EXTERN(LogEasyUserInterfaceManagementTests, Log, All);
+
+class FEasyUserInterfaceManagementTestsModule : public IModuleInterface
+{
+public:
+
+	/** IModuleInterface implementation */
+	virtual void StartupModule() override;
+	virtual void ShutdownModule() override;
+};
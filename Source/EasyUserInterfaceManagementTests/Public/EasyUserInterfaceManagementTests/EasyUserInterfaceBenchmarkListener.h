@@ -0,0 +1,46 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "UObject/Object.h"
+#include "EasyUserInterfaceBenchmarkListener.generated.h"
+
+class UCommonActivatableWidget;
+class UEasyNotificationWidget;
+
+/**
+ * Receives the OnWidgetAdded callbacks of the widgets pushed by the benchmark and the OnNotificationAdded callbacks of its notifications.
+ */
+UCLASS(Transient)
+class EASYUSERINTERFACEMANAGEMENTTESTS_API UEasyUserInterfaceBenchmarkListener : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION()
+	void HandleWidgetAdded(FGameplayTag LayerTag, UCommonActivatableWidget* Widget);
+	UFUNCTION()
+	void HandleNotificationAdded(FGameplayTag LayerTag, UEasyNotificationWidget* NotificationWidget);
+
+	/** Forgets the callbacks received so far. */
+	void Reset();
+
+	/** Retrieves the number of OnWidgetAdded callbacks received, a push whose class failed to load is reported with no widget. */
+	int32 GetNumWidgetCallbacks() const { return NumWidgetCallbacks; }
+	/** Retrieves the number of callbacks received, a summary or a coalesced notification is reported once per request. */
+	int32 GetNumCallbacks() const { return NumCallbacks; }
+	/** Retrieves the time of the last callback, 0 if none was received. */
+	double GetLastCallbackTime() const { return LastCallbackTime; }
+	/** Retrieves the distinct notifications shown, in the order they were reported. */
+	const TArray<TObjectPtr<UEasyNotificationWidget>>& GetNotifications() const { return Notifications; }
+
+private:
+	UPROPERTY()
+	TArray<TObjectPtr<UEasyNotificationWidget>> Notifications;
+
+	int32 NumWidgetCallbacks = 0;
+	int32 NumCallbacks = 0;
+	double LastCallbackTime = 0.0;
+};
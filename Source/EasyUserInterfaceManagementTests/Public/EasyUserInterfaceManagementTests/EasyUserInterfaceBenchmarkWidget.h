@@ -0,0 +1,30 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ExtensionCommonUI/ActivatableWidget/EasyActivatableWidgetBase.h"
+#include "EasyUserInterfaceBenchmarkWidget.generated.h"
+
+/**
+ * Activatable widget of the benchmark, exposes the runtime binding registration of its base so it can be measured.
+ */
+UCLASS()
+class EASYUSERINTERFACEMANAGEMENTTESTS_API UEasyUserInterfaceBenchmarkWidget : public UEasyActivatableWidgetBase
+{
+	GENERATED_BODY()
+
+public:
+	/** Registers a binding for an input action, see RegisterBinding. */
+	void RegisterBenchmarkBinding(const FUserInterfaceInputActionToRegister& InputAction, const FInputActionExecutedDelegate& Callback)
+	{
+		FInputActionBindingHandle BindingHandle;
+		RegisterBinding(InputAction, Callback, BindingHandle);
+	}
+
+	/** Unregisters every binding registered by this widget, see UnregisterAllBindings. */
+	void UnregisterBenchmarkBindings()
+	{
+		UnregisterAllBindings();
+	}
+};
@@ -0,0 +1,105 @@
+﻿// Copyright Elmarath Studio 2025 All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/StrongObjectPtr.h"
+
+class APlayerController;
+class UEasyUserInterfaceManager;
+class UEasyUserInterfaceRootWidget;
+class UGameInstance;
+struct FStreamableHandle;
+
+/**
+ * Helpers of the automation tests that run on a User Interface of their own.
+ */
+class EASYUSERINTERFACEMANAGEMENTTESTS_API FEasyUserInterfaceTestUtils
+{
+public:
+	/** Retrieves the player controller of the local player of the manager. */
+	static APlayerController* GetPlayerController(const UEasyUserInterfaceManager& Manager);
+	/**
+	 * Sorts layers by name, so every run goes through them in the same order.
+	 * @param Layers The registered layers.
+	 * @param OnlyLayer The only layer to keep, every layer is kept if not valid.
+	 * @return The sorted layers.
+	 */
+	static TArray<FGameplayTag> SortLayers(TArray<FGameplayTag> Layers, const FGameplayTag& OnlyLayer = FGameplayTag());
+};
+
+/**
+ * Game world of a test, with its own game instance, local player and player controller. The root widget is added through
+ * the manager of the local player, so a test runs headless (e.g. -nullrhi) without a map, a viewport or a PIE session.
+ */
+class EASYUSERINTERFACEMANAGEMENTTESTS_API FEasyUserInterfaceTestWorld
+{
+public:
+	~FEasyUserInterfaceTestWorld();
+
+	/**
+	 * Creates the world and its local player, then requests the root widget through the manager.
+	 * @param RootWidgetClass The root widget added to the viewport of the world.
+	 * @param OutError The reason the world could not be created.
+	 * @return True if the root widget was requested, it is ready once the manager reports it.
+	 */
+	bool Create(const TSoftClassPtr<UEasyUserInterfaceRootWidget>& RootWidgetClass, FString& OutError);
+	/** Removes the local player, which tears its User Interface down, then destroys the world. Does nothing if not created. */
+	void Destroy();
+	/** Retrieves the manager of the local player, nullptr if the world is not created. */
+	UEasyUserInterfaceManager* GetManager() const;
+
+private:
+	TStrongObjectPtr<UGameInstance> GameInstance;
+};
+
+/**
+ * Creates the test world with the root widget class of the project settings and waits for the root widget to be in its viewport.
+ * Calls back with the manager, or with nullptr if the world could not be created or once the timeout is over.
+ */
+class EASYUSERINTERFACEMANAGEMENTTESTS_API FEasyUICreateTestWorldCommand : public IAutomationLatentCommand
+{
+public:
+	FEasyUICreateTestWorldCommand(const TSharedRef<FEasyUserInterfaceTestWorld>& InTestWorld, float InTimeout, TFunction<void(UEasyUserInterfaceManager*)>&& InOnFinished);
+
+	virtual bool Update() override;
+
+private:
+	TSharedRef<FEasyUserInterfaceTestWorld> TestWorld;
+	float Timeout;
+	TFunction<void(UEasyUserInterfaceManager*)> OnFinished;
+	bool bCreateRequested = false;
+};
+
+/** Destroys the test world, added last so it runs even after a failure. */
+class EASYUSERINTERFACEMANAGEMENTTESTS_API FEasyUIDestroyTestWorldCommand : public IAutomationLatentCommand
+{
+public:
+	explicit FEasyUIDestroyTestWorldCommand(const TSharedRef<FEasyUserInterfaceTestWorld>& InTestWorld) : TestWorld(InTestWorld) {}
+
+	virtual bool Update() override;
+
+private:
+	TSharedRef<FEasyUserInterfaceTestWorld> TestWorld;
+};
+
+/**
+ * Loads assets asynchronously and waits for them, so loading is never part of a measure.
+ * Calls back with the handle keeping them loaded once done or once the timeout is over, assets that did not load are left to the caller.
+ */
+class EASYUSERINTERFACEMANAGEMENTTESTS_API FEasyUIWaitForLoadCommand : public IAutomationLatentCommand
+{
+public:
+	FEasyUIWaitForLoadCommand(TArray<FSoftObjectPath>&& InAssetPaths, float InTimeout, TFunction<void(TSharedPtr<FStreamableHandle>)>&& InOnFinished);
+
+	virtual bool Update() override;
+
+private:
+	TArray<FSoftObjectPath> AssetPaths;
+	float Timeout;
+	TFunction<void(TSharedPtr<FStreamableHandle>)> OnFinished;
+	TSharedPtr<FStreamableHandle> Handle;
+	bool bLoadRequested = false;
+};